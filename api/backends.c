@@ -0,0 +1,164 @@
+// backends.c — Verse API providers behind one interface
+
+#include "backends.h"
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================
+// Shared helpers
+// ============================================================
+
+// Spaces become '+'; references need nothing else escaped
+static void url_encode(const char* src, char* dst, size_t dst_sz) {
+    size_t di = 0;
+    for(size_t i = 0; src[i] && di < dst_sz - 1; i++)
+        dst[di++] = (src[i] == ' ') ? '+' : src[i];
+    dst[di] = '\0';
+}
+
+// Copy s[0..n) with line breaks blanked and trailing spaces dropped
+static bool copy_trimmed(const char* s, size_t n, char* out, size_t out_sz) {
+    size_t wi = 0;
+    for(size_t i = 0; i < n && wi < out_sz - 1; i++)
+        out[wi++] = (s[i] == '\r' || s[i] == '\n') ? ' ' : s[i];
+    while(wi > 0 && out[wi - 1] == ' ') wi--;
+    out[wi] = '\0';
+    return wi > 0;
+}
+
+static bool json_extract_str(const char* json, const char* key,
+                              char* out, size_t out_sz) {
+    if(!json || !key || !out || out_sz < 2) return false;
+    char pat[64];
+    snprintf(pat, sizeof(pat), "\"%s\":\"", key);
+    size_t plen = strlen(pat);
+    const char* found = NULL, *p = json;
+    while((p = strstr(p, pat)) != NULL) { found = p; p += plen; }
+    if(!found) return false;
+    const char* start = found + plen;
+    size_t wi = 0; bool escaped = false;
+    for(const char* c = start; *c && wi < out_sz - 1; c++) {
+        if(escaped) {
+            if(*c == 'n' || *c == 'r') out[wi++] = ' ';
+            else if(*c == '"')          out[wi++] = '"';
+            else if(*c == '\\')         out[wi++] = '\\';
+            else { if(wi < out_sz-2) { out[wi++] = '\\'; out[wi++] = *c; } }
+            escaped = false;
+        } else if(*c == '\\') {
+            escaped = true;
+        } else if(*c == '"') {
+            break;
+        } else {
+            out[wi++] = *c;
+        }
+    }
+    out[wi] = '\0';
+    while(wi > 0 && (out[wi-1] == ' ' || out[wi-1] == '\n' || out[wi-1] == '\r'))
+        out[--wi] = '\0';
+    return wi > 0;
+}
+
+// ============================================================
+// bible-api.com: JSON with "reference" and "text", or "error"
+// ============================================================
+
+static bool bibleapi_url(const ApiBackend* b, const char* trans, const char* query,
+                         char* out, size_t out_sz) {
+    char encoded[96];
+    url_encode(query, encoded, sizeof(encoded));
+    int n = snprintf(out, out_sz, "%s/%s?translation=%s", b->base, encoded, trans);
+    return n > 0 && (size_t)n < out_sz;
+}
+
+static ApiAnswer bibleapi_parse(const char* resp, char* ref, size_t ref_sz,
+                                char* text, size_t text_sz) {
+    if(strstr(resp, "\"error\"")) return ApiAnswerMissing;
+    if(json_extract_str(resp, "reference", ref, ref_sz) &&
+       json_extract_str(resp, "text", text, text_sz))
+        return ApiAnswerFound;
+    return ApiAnswerBad;
+}
+
+// ============================================================
+// Local mirror: GET <base>/<trans>/<query> answers one verse-file
+// line "Ref|text", or "-" for a verse it doesn't have
+// ============================================================
+
+static bool mirror_url(const ApiBackend* b, const char* trans, const char* query,
+                       char* out, size_t out_sz) {
+    char encoded[96];
+    url_encode(query, encoded, sizeof(encoded));
+    int n = snprintf(out, out_sz, "%s/%s/%s", b->base, trans, encoded);
+    return n > 0 && (size_t)n < out_sz;
+}
+
+static ApiAnswer mirror_parse(const char* resp, char* ref, size_t ref_sz,
+                              char* text, size_t text_sz) {
+    if(resp[0] == '-' && (resp[1] == '\0' || resp[1] == '\r' || resp[1] == '\n'))
+        return ApiAnswerMissing;
+    const char* bar = strchr(resp, '|');
+    if(!bar) return ApiAnswerBad;
+    if(copy_trimmed(resp, (size_t)(bar - resp), ref, ref_sz) &&
+       copy_trimmed(bar + 1, strlen(bar + 1), text, text_sz))
+        return ApiAnswerFound;
+    return ApiAnswerBad;
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void backends_init(ApiBackends* bs, const char* mirror_base, uint32_t cool_ticks) {
+    memset(bs, 0, sizeof(*bs));
+    bs->cool_ticks = cool_ticks;
+    ApiBackend* b = &bs->list[bs->count++];
+    b->name  = "bible-api";
+    b->url   = bibleapi_url;
+    b->parse = bibleapi_parse;
+    strncpy(b->base, "https://bible-api.com", sizeof(b->base) - 1);
+
+    if(!mirror_base) return;
+    size_t n = strcspn(mirror_base, "\r\n");
+    while(n > 0 && (mirror_base[n - 1] == '/' || mirror_base[n - 1] == ' ')) n--;
+    if(n == 0 || n >= API_BACKEND_BASE_LEN) return;
+    b = &bs->list[bs->count++];
+    b->name  = "mirror";
+    b->url   = mirror_url;
+    b->parse = mirror_parse;
+    memcpy(b->base, mirror_base, n);
+    b->base[n] = '\0';
+}
+
+int8_t backends_pick(const ApiBackends* bs, uint8_t tried, uint32_t now) {
+    int8_t best = -1;
+    bool   best_down = false;
+    for(uint8_t i = 0; i < bs->count; i++) {
+        if(tried & (1u << i)) continue;
+        const ApiBackend* b = &bs->list[i];
+        bool down = b->fails >= API_BACKEND_FAILS && (int32_t)(now - b->down_until) < 0;
+        if(best < 0 || (best_down && !down) ||
+           (down == best_down && b->ewma < bs->list[best].ewma)) {
+            best      = (int8_t)i;
+            best_down = down;
+        }
+    }
+    return best;
+}
+
+void backends_report(ApiBackends* bs, uint8_t i, bool answered, uint32_t elapsed, uint32_t now) {
+    if(i >= bs->count) return;
+    ApiBackend* b = &bs->list[i];
+    if(answered) {
+        // EWMA with alpha 1/4; nonzero so a measured backend never
+        // looks unmeasured
+        if(!elapsed) elapsed = 1;
+        b->ewma  = b->ewma ? (3 * b->ewma + elapsed) / 4 : elapsed;
+        b->fails = 0;
+        return;
+    }
+    if(b->fails < 255) b->fails++;
+    // Past the threshold every failure restarts the cool-down, so a
+    // backend that is still down after one is skipped again at once
+    if(b->fails >= API_BACKEND_FAILS)
+        b->down_until = now + bs->cool_ticks;
+}
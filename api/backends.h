@@ -0,0 +1,67 @@
+// backends.h — Verse API providers behind one interface
+//
+// Each backend builds its own request URL and turns its own response
+// shape into a reference and a text. Every backend keeps an EWMA of
+// its answer latency and a count of consecutive failures. A lookup goes
+// to the fastest backend that is not cooling down, and fails over to
+// the next one it has not tried yet.
+// Pure C (no Furi dependencies) so it can be checked on the host; the
+// caller reads the mirror file and passes times in ticks.
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define API_BACKEND_MAX      2
+#define API_BACKEND_FAILS    2       // consecutive failures before a cool-down
+#define API_BACKEND_COOL_MS  60000
+#define API_BACKEND_BASE_LEN 80
+
+typedef enum {
+    ApiAnswerFound,
+    ApiAnswerMissing,   // the provider answered but doesn't have the verse
+    ApiAnswerBad,       // not an answer in this provider's shape
+} ApiAnswer;
+
+typedef struct ApiBackend ApiBackend;
+
+struct ApiBackend {
+    const char* name;
+    // Request URL for a lookup; false if it doesn't fit
+    bool      (*url)(const ApiBackend* b, const char* trans, const char* query,
+                     char* out, size_t out_sz);
+    // Runs on the FlipperHTTP RX thread
+    ApiAnswer (*parse)(const char* resp, char* ref, size_t ref_sz, char* text, size_t text_sz);
+    char      base[API_BACKEND_BASE_LEN];
+    uint32_t  ewma;         // answer latency in ticks, 0 = not measured yet
+    uint32_t  down_until;   // tick the cool-down ends
+    uint8_t   fails;        // consecutive failures
+};
+
+typedef struct {
+    ApiBackend list[API_BACKEND_MAX];
+    uint8_t    count;
+    uint32_t   cool_ticks;   // API_BACKEND_COOL_MS in ticks
+} ApiBackends;
+
+// bible-api.com, and the local mirror at mirror_base (the first line of
+// the mirror file, trailing slashes allowed) unless it is NULL or blank
+void backends_init(ApiBackends* bs, const char* mirror_base, uint32_t cool_ticks);
+
+// Backend for the next attempt at a lookup, skipping the ones in tried
+// (bit i = list[i]). Unmeasured backends go first, then the fastest;
+// cooling-down ones only when nothing else is left. -1 once all were
+// tried.
+int8_t backends_pick(const ApiBackends* bs, uint8_t tried, uint32_t now);
+
+// Record one attempt: an answer (found or missing) updates the latency,
+// a timeout or bad answer counts toward the cool-down
+void backends_report(ApiBackends* bs, uint8_t i, bool answered, uint32_t elapsed, uint32_t now);
+
+#ifdef __cplusplus
+}
+#endif
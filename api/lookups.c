@@ -0,0 +1,294 @@
+// lookups.c — Response cache and offline queue for Bible API lookups
+
+#include "lookups.h"
+#include <string.h>
+
+#define LOOKUP_LINE_LEN   640
+#define LOOKUP_QUEUE_LINE (LOOKUP_TRANS_LEN + LOOKUP_QUERY_LEN + 2)
+#define LOOKUP_TRIM_STEP  1024   // cache bytes copied per compaction step
+
+// ============================================================
+// Lines and fields
+// ============================================================
+
+typedef struct {
+    File*    f;
+    char     buf[128];
+    uint16_t pos;
+    uint16_t len;
+} LineReader;
+
+// Next line without its terminator, cut to out_sz - 1; false at EOF
+static bool line_read(LineReader* r, char* out, size_t out_sz) {
+    size_t n = 0;
+    bool any = false;
+    for(;;) {
+        if(r->pos == r->len) {
+            r->len = (uint16_t)storage_file_read(r->f, r->buf, sizeof(r->buf));
+            r->pos = 0;
+            if(!r->len) break;
+        }
+        char ch = r->buf[r->pos++];
+        any = true;
+        if(ch == '\n') break;
+        if(ch != '\r' && n < out_sz - 1) out[n++] = ch;
+    }
+    out[n] = '\0';
+    return any;
+}
+
+// Split a line at its first n - 1 bars; returns the field count
+static uint8_t fields_split(char* line, char** field, uint8_t n) {
+    uint8_t count = 0;
+    field[count++] = line;
+    while(count < n) {
+        char* bar = strchr(field[count - 1], '|');
+        if(!bar) break;
+        *bar = '\0';
+        field[count++] = bar + 1;
+    }
+    return count;
+}
+
+static bool field_eq(const char* a, const char* b) {
+    for(; *a && *b; a++, b++) {
+        char x = (*a >= 'A' && *a <= 'Z') ? (char)(*a + 32) : *a;
+        char y = (*b >= 'A' && *b <= 'Z') ? (char)(*b + 32) : *b;
+        if(x != y) return false;
+    }
+    return *a == *b;
+}
+
+static bool key_storable(const char* s, size_t max) {
+    size_t n = strlen(s);
+    return n > 0 && n < max && !strpbrk(s, "|\r\n");
+}
+
+// Append s to line at *n, with separators and line breaks blanked
+static void field_put(char* line, size_t* n, const char* s, char end) {
+    for(; *s && *n < LOOKUP_LINE_LEN - 2; s++)
+        line[(*n)++] = (*s == '|' || *s == '\r' || *s == '\n') ? ' ' : *s;
+    line[(*n)++] = end;
+}
+
+// ============================================================
+// Response cache
+// ============================================================
+
+bool lookup_cache_get(const LookupStore* ls, const char* trans, const char* query,
+                      char* ref, size_t ref_sz, char* text, size_t text_sz) {
+    char* line = malloc(LOOKUP_LINE_LEN);
+    if(!line) return false;
+    bool found = false;
+    File* f = storage_file_alloc(ls->storage);
+    if(storage_file_open(f, ls->cache_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        LineReader r = { .f = f };
+        while(line_read(&r, line, LOOKUP_LINE_LEN)) {
+            char* fld[4];
+            if(fields_split(line, fld, 4) != 4) continue;
+            if(!field_eq(fld[0], trans) || !field_eq(fld[1], query)) continue;
+            strncpy(ref,  fld[2], ref_sz - 1);  ref[ref_sz - 1]   = '\0';
+            strncpy(text, fld[3], text_sz - 1); text[text_sz - 1] = '\0';
+            found = true;
+        }
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    free(line);
+    return found;
+}
+
+// One step of rewriting the cache without its older half, at most
+// LOOKUP_TRIM_STEP bytes. The first step finds the first whole line past
+// the middle and starts the copy; each later step reopens both files and
+// copies on from *cursor, so lines appended between steps are carried
+// over. The last step swaps the copy in.
+bool lookup_cache_trim_step(const LookupStore* ls, uint32_t* cursor) {
+    char tmp[112];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", ls->cache_path);
+    File* src = storage_file_alloc(ls->storage);
+    File* dst = storage_file_alloc(ls->storage);
+    bool start = *cursor == 0;
+    bool ok = false, more = false, skip = false;
+    if(storage_file_open(src, ls->cache_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint32_t size = (uint32_t)storage_file_size(src);
+        char buf[128];
+        size_t n;
+        if(start && size <= LOOKUP_CACHE_MAX_BYTES) {
+            skip = true;
+        } else if(storage_file_open(dst, tmp, FSAM_WRITE,
+                                    start ? FSOM_CREATE_ALWAYS : FSOM_OPEN_APPEND)) {
+            ok = true;
+            if(start) {
+                uint32_t at = size / 2;
+                bool found = false;
+                storage_file_seek(src, at, true);
+                while(!found && (n = storage_file_read(src, buf, sizeof(buf))) > 0) {
+                    const char* nl = memchr(buf, '\n', n);
+                    found = nl != NULL;
+                    at += found ? (uint32_t)(nl - buf) + 1 : (uint32_t)n;
+                }
+                *cursor = at;
+            }
+            storage_file_seek(src, *cursor, true);
+            uint32_t copied = 0;
+            while(ok && copied < LOOKUP_TRIM_STEP &&
+                  (n = storage_file_read(src, buf, sizeof(buf))) > 0) {
+                ok = storage_file_write(dst, buf, n) == n;
+                copied += (uint32_t)n;
+            }
+            *cursor += copied;
+            more = ok && *cursor < size;
+            storage_file_close(dst);
+        }
+        storage_file_close(src);
+    }
+    storage_file_free(src);
+    storage_file_free(dst);
+    if(skip || more) return !more;
+    if(ok) {
+        storage_common_remove(ls->storage, ls->cache_path);
+        storage_common_rename(ls->storage, tmp, ls->cache_path);
+    } else {
+        storage_common_remove(ls->storage, tmp);
+    }
+    return true;
+}
+
+bool lookup_cache_put(const LookupStore* ls, const char* trans, const char* query,
+                      const char* ref, const char* text) {
+    if(!key_storable(trans, LOOKUP_TRANS_LEN) || !key_storable(query, LOOKUP_QUERY_LEN))
+        return false;
+    char* line = malloc(LOOKUP_LINE_LEN);
+    if(!line) return false;
+    size_t n = 0;
+    field_put(line, &n, trans, '|');
+    field_put(line, &n, query, '|');
+    field_put(line, &n, ref,   '|');
+    field_put(line, &n, text,  '\n');
+
+    // Compaction is left to the caller's idle time; only a cache that
+    // reached twice the limit without one is trimmed here
+    FileInfo fi;
+    uint64_t size = 0;
+    bool trimmed = false;
+    if(storage_common_stat(ls->storage, ls->cache_path, &fi) == FSE_OK) size = fi.size;
+    if(size + n > 2 * LOOKUP_CACHE_MAX_BYTES) {
+        uint32_t cursor = 0;
+        while(!lookup_cache_trim_step(ls, &cursor)) {}
+        trimmed = true;
+    }
+
+    File* f = storage_file_alloc(ls->storage);
+    if(storage_file_open(f, ls->cache_path, FSAM_WRITE, FSOM_OPEN_APPEND)) {
+        storage_file_write(f, line, n);
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    free(line);
+    return trimmed || (size <= LOOKUP_CACHE_MAX_BYTES && size + n > LOOKUP_CACHE_MAX_BYTES);
+}
+
+// ============================================================
+// Offline queue
+//
+// At most LOOKUP_QUEUE_MAX short lines, so every operation reads the
+// whole file and pop rewrites it.
+// ============================================================
+
+// Whole queue file, NUL-terminated, in a buffer the caller frees
+static char* queue_load(const LookupStore* ls) {
+    size_t cap = LOOKUP_QUEUE_MAX * LOOKUP_QUEUE_LINE;
+    char* buf = malloc(cap + 1);
+    if(!buf) return NULL;
+    size_t n = 0;
+    File* f = storage_file_alloc(ls->storage);
+    if(storage_file_open(f, ls->queue_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        n = storage_file_read(f, buf, cap);
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    buf[n] = '\0';
+    return buf;
+}
+
+static uint16_t queue_lines(const char* buf) {
+    uint16_t count = 0;
+    for(const char* p = buf; *p; p++)
+        if(*p == '\n') count++;
+    return count;
+}
+
+bool lookup_queue_add(const LookupStore* ls, const char* trans, const char* query) {
+    if(!key_storable(trans, LOOKUP_TRANS_LEN) || !key_storable(query, LOOKUP_QUERY_LEN)) return false;
+    char* buf = queue_load(ls);
+    if(!buf) return false;
+    bool dup = false;
+    uint16_t count = queue_lines(buf);
+    for(char* line = buf; *line && !dup;) {
+        char* next = line + strcspn(line, "\n");
+        if(*next) *next++ = '\0';
+        char* fld[2];
+        dup = fields_split(line, fld, 2) == 2 && field_eq(fld[0], trans) && field_eq(fld[1], query);
+        line = next;
+    }
+    free(buf);
+    if(dup) return true;
+    if(count >= LOOKUP_QUEUE_MAX) return false;
+
+    char line[LOOKUP_QUEUE_LINE + 1];
+    int n = snprintf(line, sizeof(line), "%s|%s\n", trans, query);
+    bool ok = false;
+    File* f = storage_file_alloc(ls->storage);
+    if(n > 0 && storage_file_open(f, ls->queue_path, FSAM_WRITE, FSOM_OPEN_APPEND)) {
+        ok = storage_file_write(f, line, (size_t)n) == (size_t)n;
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    return ok;
+}
+
+uint16_t lookup_queue_count(const LookupStore* ls) {
+    char* buf = queue_load(ls);
+    if(!buf) return 0;
+    uint16_t count = queue_lines(buf);
+    free(buf);
+    return count;
+}
+
+bool lookup_queue_peek(const LookupStore* ls, char* trans, char* query) {
+    char line[LOOKUP_QUEUE_LINE + 1];
+    bool ok = false;
+    File* f = storage_file_alloc(ls->storage);
+    if(storage_file_open(f, ls->queue_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        LineReader r = { .f = f };
+        char* fld[2];
+        if(line_read(&r, line, sizeof(line)) && fields_split(line, fld, 2) == 2) {
+            strncpy(trans, fld[0], LOOKUP_TRANS_LEN - 1); trans[LOOKUP_TRANS_LEN - 1] = '\0';
+            strncpy(query, fld[1], LOOKUP_QUERY_LEN - 1); query[LOOKUP_QUERY_LEN - 1] = '\0';
+            ok = true;
+        }
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    return ok;
+}
+
+void lookup_queue_pop(const LookupStore* ls) {
+    char* buf = queue_load(ls);
+    if(!buf) return;
+    char* rest = strchr(buf, '\n');
+    rest = rest ? rest + 1 : buf + strlen(buf);
+    size_t n = strlen(rest);
+    if(!n) {
+        storage_common_remove(ls->storage, ls->queue_path);
+    } else {
+        File* f = storage_file_alloc(ls->storage);
+        if(storage_file_open(f, ls->queue_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            storage_file_write(f, rest, n);
+            storage_file_close(f);
+        }
+        storage_file_free(f);
+    }
+    free(buf);
+}
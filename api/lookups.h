@@ -0,0 +1,52 @@
+// lookups.h — Response cache and offline queue for Bible API lookups
+//
+// Both are small text files on the SD card. The cache holds one
+// "translation|query|reference|text" line per fetched verse, newest
+// last, and drops its older half once it grows past
+// LOOKUP_CACHE_MAX_BYTES; that rewrite runs in steps from the app's idle
+// time. The queue holds "translation|query" lines for lookups that could
+// not be made, oldest first.
+#pragma once
+#include <furi.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LOOKUP_CACHE_MAX_BYTES 24576
+#define LOOKUP_QUEUE_MAX       32
+#define LOOKUP_QUERY_LEN       64
+#define LOOKUP_TRANS_LEN       12
+
+typedef struct {
+    Storage*    storage;
+    const char* cache_path;
+    const char* queue_path;
+} LookupStore;
+
+// Cached result for (trans, query), matched case-insensitively. The
+// newest entry wins.
+bool lookup_cache_get(const LookupStore* ls, const char* trans, const char* query,
+                      char* ref, size_t ref_sz, char* text, size_t text_sz);
+// Append an entry. True when the cache just went over its limit (or was
+// trimmed here, at twice the limit): restart lookup_cache_trim_step from
+// cursor 0.
+bool lookup_cache_put(const LookupStore* ls, const char* trans, const char* query,
+                      const char* ref, const char* text);
+// One bounded step of dropping the cache's older half. cursor starts at 0
+// and is kept between steps; true once the cache is within its limit or
+// the rewrite finished or failed.
+bool lookup_cache_trim_step(const LookupStore* ls, uint32_t* cursor);
+
+// Append a lookup unless it is already queued. False if the queue is
+// full or the query can't be stored.
+bool     lookup_queue_add(const LookupStore* ls, const char* trans, const char* query);
+uint16_t lookup_queue_count(const LookupStore* ls);
+// Oldest queued lookup, left in the queue until lookup_queue_pop
+bool     lookup_queue_peek(const LookupStore* ls, char* trans, char* query);
+void     lookup_queue_pop(const LookupStore* ls);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,120 @@
+// bench.c — Benchmark suite shared by the device and the host runner
+
+#include "bench.h"
+#include "../search/worddiff.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Iteration counts keep each case to a second or two on the device.
+// bookmark_toggle runs an even count so the list ends as it started.
+const BenchCase BENCH_CASES[BENCH_CASE_COUNT] = {
+    { "index_build",     BenchOpIndexBuild,      3, NULL,          0 },
+    { "verse_cold",      BenchOpVerseCold,      20, NULL,          0 },
+    { "verse_warm",      BenchOpVerseWarm,      50, NULL,          0 },
+    { "search_common",   BenchOpSearch,          3, "the",         0 },
+    { "search_rare",     BenchOpSearch,          3, "Melchizedek", 0 },
+    { "wrap_builtin",    BenchOpWrap,          200, NULL,          0 },
+    { "wrap_4x6",        BenchOpWrap,          200, NULL,          1 },
+    { "wrap_5x8",        BenchOpWrap,          200, NULL,          2 },
+    { "wrap_6x10",       BenchOpWrap,          200, NULL,          3 },
+    { "wrap_9x15",       BenchOpWrap,          200, NULL,          4 },
+    { "bookmark_toggle", BenchOpBookmarkToggle, 10, NULL,          0 },
+    { "worddiff",        BenchOpWordDiff,      100, NULL,          0 },
+};
+
+// Esther 8:9 (KJV), the longest verse, cut to fit the wrap line limit
+const char BENCH_WRAP_TEXT[] =
+    "Then were the king's scribes called at that time in the third month, that is, "
+    "the month Sivan, on the three and twentieth day thereof; and it was written "
+    "according to all that Mordecai commanded unto the Jews, and to the lieutenants, "
+    "and the deputies and rulers of the provinces which are from India unto Ethiopia.";
+
+// Esther 8:9, KJV against ESV: the longest verse, so the worst case for
+// the diff (both sides stay under WORDDIFF_MAX_WORDS)
+const char BENCH_DIFF_A[] =
+    "Then were the king's scribes called at that time in the third month, that is, "
+    "the month Sivan, on the three and twentieth day thereof; and it was written "
+    "according to all that Mordecai commanded unto the Jews, and to the lieutenants, "
+    "and the deputies and rulers of the provinces which are from India unto Ethiopia, "
+    "an hundred twenty and seven provinces, unto every province according to the "
+    "writing thereof, and unto every people after their language, and to the Jews "
+    "according to their writing, and according to their language.";
+const char BENCH_DIFF_B[] =
+    "The king's scribes were summoned at that time, in the third month, which is the "
+    "month of Sivan, on the twenty-third day. And an edict was written, according to "
+    "all that Mordecai commanded concerning the Jews, to the satraps and the governors "
+    "and the officials of the provinces from India to Ethiopia, 127 provinces, to each "
+    "province in its own script and to each people in its own language, and also to "
+    "the Jews in their script and their language.";
+
+// Pure CPU, so it runs the same code on both platforms
+static bool bench_worddiff(WordDiff* d) {
+    worddiff_run(d, BENCH_DIFF_A, sizeof(BENCH_DIFF_A) - 1, BENCH_DIFF_B, sizeof(BENCH_DIFF_B) - 1);
+    return true;
+}
+
+static uint64_t ticks_to_ns(const BenchHooks* h, uint64_t ticks) {
+    return ticks * 1000u / h->ticks_per_us;
+}
+
+void bench_run_case(const BenchHooks* h, const BenchCase* c, BenchResult* out) {
+    out->total_ns = 0;
+    out->min_ns   = UINT64_MAX;
+    out->max_ns   = 0;
+    out->iters    = 0;
+    out->ok       = true;
+
+    WordDiff* d = NULL;
+    if(c->op == BenchOpWordDiff) {
+        d = malloc(sizeof(WordDiff));
+        if(!d) out->ok = false;
+    }
+    // Ticks are summed raw and converted once, so no rounding piles up
+    uint64_t total = 0;
+    for(uint16_t i = 0; i < c->iters && out->ok; i++) {
+        uint32_t t0 = h->now(h->ctx);
+        bool ok = d ? bench_worddiff(d) : h->run(h->ctx, c, i);
+        uint32_t ticks = h->now(h->ctx) - t0;
+        if(!ok) { out->ok = false; break; }
+        uint64_t ns = ticks_to_ns(h, ticks);
+        total += ticks;
+        if(ns < out->min_ns) out->min_ns = ns;
+        if(ns > out->max_ns) out->max_ns = ns;
+        out->iters++;
+    }
+    out->total_ns = ticks_to_ns(h, total);
+    if(!out->iters) out->min_ns = 0;
+    free(d);
+}
+
+uint64_t bench_mean_ns(const BenchResult* r) {
+    return r->iters ? r->total_ns / r->iters : 0;
+}
+
+// Split into two longs: the device's printf has no 64-bit conversions
+size_t bench_fmt_us(char* out, size_t out_sz, uint64_t ns) {
+    int n = snprintf(out, out_sz, "%lu.%03lu", (unsigned long)(ns / 1000u),
+                     (unsigned long)(ns % 1000u));
+    return (n > 0 && (size_t)n < out_sz) ? (size_t)n : 0;
+}
+
+size_t bench_csv_header(char* out, size_t out_sz) {
+    int n = snprintf(out, out_sz,
+                     "timestamp,platform,version,verse_file,case,iters,ok,"
+                     "mean_us,min_us,max_us,total_us\n");
+    return (n > 0 && (size_t)n < out_sz) ? (size_t)n : 0;
+}
+
+size_t bench_csv_row(char* out, size_t out_sz, uint32_t timestamp, const char* platform,
+                     const char* version, const char* verse_file, const BenchCase* c,
+                     const BenchResult* r) {
+    char mean[24], min[24], max[24], total[24];
+    bench_fmt_us(mean, sizeof(mean), bench_mean_ns(r));
+    bench_fmt_us(min, sizeof(min), r->min_ns);
+    bench_fmt_us(max, sizeof(max), r->max_ns);
+    bench_fmt_us(total, sizeof(total), r->total_ns);
+    int n = snprintf(out, out_sz, "%lu,%s,%s,%s,%s,%u,%u,%s,%s,%s,%s\n",
+                     (unsigned long)timestamp, platform, version, verse_file, c->name,
+                     (unsigned)r->iters, r->ok ? 1u : 0u, mean, min, max, total);
+    return (n > 0 && (size_t)n < out_sz) ? (size_t)n : 0;
+}
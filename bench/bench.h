@@ -0,0 +1,86 @@
+// bench.h — Benchmark suite shared by the device and the host runner
+// Pure C (no Furi dependencies) so it can be shared with host tools.
+//
+// The case table, the fixed inputs, the timing loop and the CSV format
+// live here. Each platform supplies a clock and the operations that touch
+// its storage: the app runs them on the SD card (hold OK on About), and
+// tools/bvbench.c runs them on a copy of the data directory. Both append
+// rows to bench.csv, so one file holds device and host numbers side by side.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BENCH_FONTS 5         // FONT_COUNT
+#define BENCH_CSV_NAME "bench.csv"
+
+typedef enum {
+    BenchOpIndexBuild,        // rescan the open verse file into the index
+    BenchOpVerseCold,         // open, seek, read, close; a different verse each time
+    BenchOpVerseWarm,         // seek and read the same verse on the open file
+    BenchOpSearch,            // full substring pass over every verse for arg
+    BenchOpWrap,              // word-wrap BENCH_WRAP_TEXT at font arg
+    BenchOpBookmarkToggle,    // toggle one verse's bookmark and save the list
+    BenchOpWordDiff,          // diff BENCH_DIFF_A against BENCH_DIFF_B
+} BenchOp;
+
+typedef struct {
+    const char* name;         // CSV case column
+    BenchOp     op;
+    uint16_t    iters;
+    const char* query;        // BenchOpSearch
+    uint8_t     font;         // BenchOpWrap: FontChoice
+} BenchCase;
+
+#define BENCH_CASE_COUNT 12
+
+extern const BenchCase BENCH_CASES[BENCH_CASE_COUNT];
+extern const char      BENCH_WRAP_TEXT[];
+extern const char      BENCH_DIFF_A[];
+extern const char      BENCH_DIFF_B[];
+
+// One case's timings in ns; all per iteration except total_ns. Cases
+// such as wrap finish well inside a microsecond, so whole-µs steps would
+// read 0.
+typedef struct {
+    uint64_t total_ns;
+    uint64_t min_ns;
+    uint64_t max_ns;
+    uint16_t iters;           // iterations that ran; fewer than asked on failure
+    bool     ok;
+} BenchResult;
+
+typedef struct {
+    void* ctx;
+    // Free-running counter; only differences are used, so it may wrap
+    uint32_t (*now)(void* ctx);
+    uint32_t ticks_per_us;    // a host ns clock passes 1000
+    // One iteration (0-based) of a storage-backed case. BenchOpWordDiff
+    // never reaches here. False stops the case.
+    bool (*run)(void* ctx, const BenchCase* c, uint16_t iter);
+} BenchHooks;
+
+// Run one case. The timed region is exactly one run() call.
+void bench_run_case(const BenchHooks* h, const BenchCase* c, BenchResult* out);
+
+// Mean per-iteration time, 0 if nothing ran
+uint64_t bench_mean_ns(const BenchResult* r);
+
+// ns as µs with three decimals ("0.312"), the unit the screen and the
+// CSV use. Returns the length written, or 0 if it did not fit.
+size_t bench_fmt_us(char* out, size_t out_sz, uint64_t ns);
+
+// CSV header line and one result row, both ending in '\n'. Returns the
+// length written, or 0 if it did not fit.
+size_t bench_csv_header(char* out, size_t out_sz);
+size_t bench_csv_row(char* out, size_t out_sz, uint32_t timestamp, const char* platform,
+                     const char* version, const char* verse_file, const BenchCase* c,
+                     const BenchResult* r);
+
+#ifdef __cplusplus
+}
+#endif
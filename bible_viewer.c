@@ -17,14 +17,24 @@
 //   keyboard/keyboard.c   — search keyboard & results (from App.zip)
 //   keyboard/keyboard.h   — keyboard module declarations
 //   font/font.c / font.h  — custom bitmap fonts
+//   core/                 — limits, verse index scan, word wrap (host-shared)
+//   search/               — verse text matching engine
+//   io/                   — prioritized I/O worker, idle maintenance jobs
+//   api/                  — API response cache and offline lookup queue
+//   bench/                — benchmark suite shared with the host runner
+//   meta/                 — book metadata, generated from meta/books.txt
+//   tools/                — host command-line tools
 //   flipper_http/         — FlipperHTTP UART library
 // ============================================================
 
-#define APP_VERSION "1.4"
-
 #include "bible_viewer.h"
 #include "keyboard/keyboard.h"
 #include "font/font.h"
+#include "search/phonetic.h"
+#include "search/minhash.h"
+#include "search/worddiff.h"
+#include "search/versify.h"
+#include "bench/bench.h"
 #include <gui/elements.h>
 #include <stdlib.h>
 #include <string.h>
@@ -35,8 +45,8 @@
 // Font configuration
 // ============================================================
 
-static const uint8_t FONT_CHARS[FONT_COUNT]  = { 22, 30, 24, 20, 13 };
 static const uint8_t FONT_LINE_H[FONT_COUNT] = { 10,  8, 10, 12, 16 };
+_Static_assert(BENCH_FONTS == FONT_COUNT, "bench wrap cases cover every font");
 static const char* const FONT_LABELS[FONT_COUNT] = {
     "Default (built-in)",
     "Tiny  (4x6)",
@@ -45,10 +55,25 @@ static const char* const FONT_LABELS[FONT_COUNT] = {
     "Large (9x15)",
 };
 
+static const char* const SEARCH_MODE_LABELS[SearchModeCount] = {
+    "Substring",
+    "Whole word",
+    "Names (sound-alike)",
+};
+
+// Settings sections: 0=Version, 1=Font, 2=Search mode
+#define SETTINGS_SECTIONS 3
+
 static inline uint8_t font_visible_lines(FontChoice f) {
     return (uint8_t)((SCREEN_H - HDR_H - 2) / FONT_LINE_H[f]);
 }
 
+// Text lines in the verse reader, below the section heading if one shows
+static inline uint8_t reader_lines(const App* app) {
+    uint8_t top = app->cur_heading >= 0 ? LINE_H : 0;
+    return (uint8_t)((SCREEN_H - HDR_H - 2 - top) / FONT_LINE_H[app->font_choice]);
+}
+
 static inline void apply_verse_font(Canvas* canvas, FontChoice f) {
     switch(f) {
     case FONT_SMALL:   canvas_set_font_custom(canvas, FONT_SIZE_SMALL);  break;
@@ -59,6 +84,32 @@ static inline void apply_verse_font(Canvas* canvas, FontChoice f) {
     }
 }
 
+// Verse text goes through the decoded-glyph cache for the custom fonts.
+// The built-in font has no u8g2 blob of ours to cache, so it keeps the
+// canvas path (apply_verse_font must have been called for it), which
+// needs a terminated copy of the line.
+static inline void verse_draw_str(Canvas* canvas, FontChoice f, int32_t x, int32_t y,
+                                  const char* s, size_t len) {
+    if(f != FONT_SECONDARY) {
+        canvas_draw_strn_cached(canvas, (FontSize)f, x, y, s, len);
+        return;
+    }
+    char line[WRAP_LINE_LEN + 1];
+    if(len > WRAP_LINE_LEN) len = WRAP_LINE_LEN;
+    memcpy(line, s, len);
+    line[len] = '\0';
+    canvas_draw_str(canvas, x, y, line);
+}
+
+static inline uint16_t verse_str_width(Canvas* canvas, FontChoice f, const char* s, size_t len) {
+    if(f != FONT_SECONDARY) return font_strn_width_cached((FontSize)f, s, len);
+    char line[WRAP_LINE_LEN + 1];
+    if(len > WRAP_LINE_LEN) len = WRAP_LINE_LEN;
+    memcpy(line, s, len);
+    line[len] = '\0';
+    return canvas_string_width(canvas, line);
+}
+
 // ============================================================
 // Bible API translation & book tables
 // ============================================================
@@ -66,223 +117,51 @@ static inline void apply_verse_font(Canvas* canvas, FontChoice f) {
 typedef struct {
     const char* code;
     const char* label;
+    uint8_t     versify;   // VersifyScheme the API numbers verses in
 } ApiTranslation;
 
-typedef struct {
-    const char* name;
-    uint8_t     chapters;
-} BibleBook;
-
 static const ApiTranslation API_TRANSLATIONS[API_TRANS_COUNT] = {
     { "web",    "World English"    },
     { "kjv",    "King James"       },
     { "asv",    "American Std"     },
     { "bbe",    "Basic English"    },
     { "darby",  "Darby Bible"      },
-    { "dra",    "Douay-Rheims"     },
+    { "dra",    "Douay-Rheims",    VersifyVulgate },
     { "ylt",    "Young's Literal"  },
     { "webbe",  "WEB British"      },
     { "oeb-us", "Open English US"  },
 };
 
-static const BibleBook BIBLE_BOOKS[BIBLE_BOOKS_COUNT] = {
-    { "Genesis",          50 }, { "Exodus",           40 }, { "Leviticus",        27 },
-    { "Numbers",          36 }, { "Deuteronomy",      34 }, { "Joshua",           24 },
-    { "Judges",           21 }, { "Ruth",              4 }, { "1 Samuel",         31 },
-    { "2 Samuel",         24 }, { "1 Kings",          22 }, { "2 Kings",          25 },
-    { "1 Chronicles",     29 }, { "2 Chronicles",     36 }, { "Ezra",             10 },
-    { "Nehemiah",         13 }, { "Esther",           10 }, { "Job",              42 },
-    { "Psalms",          150 }, { "Proverbs",         31 }, { "Ecclesiastes",     12 },
-    { "Song of Solomon",   8 }, { "Isaiah",           66 }, { "Jeremiah",         52 },
-    { "Lamentations",      5 }, { "Ezekiel",          48 }, { "Daniel",           12 },
-    { "Hosea",            14 }, { "Joel",              3 }, { "Amos",              9 },
-    { "Obadiah",           1 }, { "Jonah",             4 }, { "Micah",             7 },
-    { "Nahum",             3 }, { "Habakkuk",          3 }, { "Zephaniah",         3 },
-    { "Haggai",            2 }, { "Zechariah",        14 }, { "Malachi",           4 },
-    { "Matthew",          28 }, { "Mark",             16 }, { "Luke",             24 },
-    { "John",             21 }, { "Acts",             28 }, { "Romans",           16 },
-    { "1 Corinthians",    16 }, { "2 Corinthians",    13 }, { "Galatians",         6 },
-    { "Ephesians",         6 }, { "Philippians",       4 }, { "Colossians",        4 },
-    { "1 Thessalonians",   5 }, { "2 Thessalonians",   3 }, { "1 Timothy",         6 },
-    { "2 Timothy",         4 }, { "Titus",             3 }, { "Philemon",          1 },
-    { "Hebrews",          13 }, { "James",             5 }, { "1 Peter",           5 },
-    { "2 Peter",           3 }, { "1 John",            5 }, { "2 John",            1 },
-    { "3 John",            1 }, { "Jude",              1 }, { "Revelation",       22 },
-};
+// Book names, chapter and verse counts come from meta/books.txt through
+// the generated meta/bible_meta.c
 
-// Verse counts per chapter (flat array; VERSE_COUNT_OFFSET[] gives each book's start)
-static const uint8_t VERSE_COUNTS[] = {
-    // Genesis
-    31,25,24,26,32,22,24,22,29,32,32,20,18,24,21,16,27,33,38,18,
-    34,24,20,67,34,35,46,22,35,43,55,32,20,31,29,43,36,30,23,23,
-    57,38,34,34,28,34,31,22,33,26,
-    // Exodus
-    22,25,22,31,23,30,25,32,35,29,10,51,22,31,27,36,16,27,25,26,
-    36,31,33,18,40,37,21,43,46,38,18,35,23,35,35,38,29,31,43,38,
-    // Leviticus
-    17,16,17,35,19,30,38,36,24,20,47,8,59,57,33,34,16,30,24,16,
-    15,49,52,45,23,26,20,
-    // Numbers
-    54,34,51,49,31,27,89,26,23,36,35,16,33,45,41,50,13,32,22,29,
-    35,41,30,25,18,65,23,31,40,16,54,42,56,29,34,13,
-    // Deuteronomy
-    46,37,29,49,33,25,26,20,29,22,32,32,18,29,23,22,20,22,21,20,
-    23,30,25,22,19,19,26,68,29,20,30,52,29,12,
-    // Joshua
-    18,24,17,24,15,27,26,35,27,43,23,24,33,15,63,10,18,28,51,9,45,34,16,33,
-    // Judges
-    36,23,31,24,31,40,25,35,57,18,40,15,25,20,20,31,13,31,30,48,25,
-    // Ruth
-    22,23,18,22,
-    // 1 Samuel
-    28,36,21,22,12,21,17,22,27,27,15,25,23,52,35,23,58,30,24,42,
-    15,23,29,22,44,25,12,25,11,31,13,
-    // 2 Samuel
-    27,32,39,12,25,23,29,18,13,19,27,31,39,33,37,23,29,33,43,26,22,51,39,25,
-    // 1 Kings
-    53,46,28,34,18,38,51,66,28,29,43,33,34,31,34,34,24,46,21,43,29,53,
-    // 2 Kings
-    18,25,27,44,27,33,20,29,37,36,21,21,25,29,38,20,41,37,37,21,26,20,37,20,30,
-    // 1 Chronicles
-    54,55,24,43,26,81,40,40,44,14,47,40,14,17,29,43,27,17,19,8,30,19,32,31,31,32,34,21,30,
-    // 2 Chronicles
-    17,18,17,22,14,42,22,18,31,19,23,16,22,15,19,14,19,34,11,37,
-    20,12,21,27,28,23,9,27,36,27,21,33,25,33,27,23,
-    // Ezra
-    11,70,13,24,17,22,28,36,15,44,
-    // Nehemiah
-    11,20,32,23,19,19,73,18,38,39,36,47,31,
-    // Esther
-    22,23,15,17,14,14,10,17,32,3,
-    // Job
-    22,13,26,21,27,30,21,22,35,22,20,25,28,22,35,22,16,21,29,29,
-    34,30,17,25,6,14,23,28,25,31,40,22,33,37,16,33,24,41,30,24,34,17,
-    // Psalms
-    6,12,8,8,12,10,17,9,20,18,7,8,6,7,5,11,15,50,14,9,
-    13,31,6,10,22,12,14,9,11,12,24,11,22,22,28,12,40,22,13,17,
-    13,11,5,20,28,22,35,22,46,18,16,18,12,5,12,20,12,23,11,13,
-    12,9,9,5,8,28,22,35,45,48,43,13,31,7,10,10,9,8,18,19,
-    2,29,18,7,8,9,4,8,5,6,5,6,8,8,3,18,3,3,21,26,
-    9,8,24,13,10,7,12,15,21,10,20,14,9,6,7,23,11,13,176,9,
-    8,9,4,8,5,6,5,3,8,8,3,18,3,3,21,26,9,8,24,13,
-    10,7,12,15,21,10,20,14,9,6,
-    // Proverbs
-    33,22,35,27,23,35,27,36,18,32,31,28,25,35,33,33,28,24,29,30,31,29,35,34,28,28,27,28,27,33,31,
-    // Ecclesiastes
-    18,26,22,16,20,12,29,17,18,20,10,14,
-    // Song of Solomon
-    17,17,11,16,16,13,13,14,
-    // Isaiah
-    31,22,26,6,30,13,25,22,21,34,16,6,22,32,9,14,14,7,25,6,
-    17,25,18,23,12,21,13,29,24,33,9,20,24,17,10,22,38,22,8,31,
-    29,25,28,28,25,13,15,22,26,11,23,15,12,17,13,12,21,14,21,22,11,12,19,12,25,24,
-    // Jeremiah
-    19,37,25,31,31,30,34,22,26,25,23,17,27,22,21,21,27,23,15,18,
-    14,30,40,10,38,24,22,17,32,24,40,44,26,22,19,32,21,28,18,16,
-    18,22,13,30,5,28,7,47,39,46,64,34,
-    // Lamentations
-    22,22,66,22,22,
-    // Ezekiel
-    28,10,27,17,17,14,27,18,11,22,25,28,23,23,8,63,24,32,14,49,
-    32,31,49,27,17,21,36,26,21,26,18,32,33,31,15,38,28,23,29,49,26,20,27,31,25,24,23,35,
-    // Daniel
-    21,49,30,37,31,28,28,27,27,21,45,13,
-    // Hosea
-    11,23,5,19,15,11,16,14,17,15,12,14,16,9,
-    // Joel
-    20,32,21,
-    // Amos
-    15,16,15,13,27,14,17,14,15,
-    // Obadiah
-    21,
-    // Jonah
-    17,10,10,11,
-    // Micah
-    16,13,12,13,15,16,20,
-    // Nahum
-    15,13,19,
-    // Habakkuk
-    17,20,19,
-    // Zephaniah
-    18,15,20,
-    // Haggai
-    15,23,
-    // Zechariah
-    21,13,10,14,11,15,14,23,17,12,17,14,9,21,
-    // Malachi
-    14,17,18,6,
-    // Matthew
-    25,23,17,25,48,34,29,34,38,42,30,50,58,36,39,28,27,35,30,34,46,46,39,51,46,75,66,20,
-    // Mark
-    45,28,35,41,43,56,37,38,50,52,33,44,37,72,47,20,
-    // Luke
-    80,52,38,44,39,49,50,56,62,42,54,59,35,35,32,31,37,43,48,47,38,71,56,53,
-    // John
-    51,25,36,54,47,71,53,59,41,42,57,50,38,31,27,33,26,40,42,31,25,
-    // Acts
-    26,47,26,37,42,15,60,40,43,48,30,25,52,28,41,40,34,28,41,38,40,30,35,27,27,32,44,31,
-    // Romans
-    32,29,31,25,21,23,25,39,33,21,36,21,14,26,33,24,
-    // 1 Corinthians
-    31,16,23,21,13,20,40,13,27,33,34,31,13,40,58,24,
-    // 2 Corinthians
-    24,17,18,18,21,18,16,24,15,18,33,21,14,
-    // Galatians
-    24,21,29,31,26,18,
-    // Ephesians
-    23,22,21,28,30,14,
-    // Philippians
-    30,30,21,23,
-    // Colossians
-    29,23,25,18,
-    // 1 Thessalonians
-    10,20,13,18,28,
-    // 2 Thessalonians
-    12,17,18,
-    // 1 Timothy
-    20,15,16,16,25,21,
-    // 2 Timothy
-    18,26,17,22,
-    // Titus
-    16,15,15,
-    // Philemon
-    25,
-    // Hebrews
-    14,18,19,16,14,20,28,13,28,39,40,29,25,
-    // James
-    27,26,18,17,20,
-    // 1 Peter
-    25,25,22,19,14,
-    // 2 Peter
-    21,22,18,
-    // 1 John
-    10,29,24,21,21,
-    // 2 John
-    13,
-    // 3 John
-    14,
-    // Jude
-    25,
-    // Revelation
-    20,29,22,11,14,17,17,13,21,11,19,17,18,20,8,21,18,24,21,15,27,21,
-};
+const char* bible_book_name(uint8_t book) {
+    return book < BIBLE_BOOKS_COUNT ? bible_meta_name(BibleLangEn, book) : "Other";
+}
 
-static const uint16_t VERSE_COUNT_OFFSET[BIBLE_BOOKS_COUNT] = {
-    0,    50,   90,   117,  153,  187,  211,  232,  236,  267,
-    291,  313,  338,  367,  403,  413,  426,  436,  478,  628,
-    659,  671,  679,  745,  797,  802,  850,  862,  876,  879,
-    888,  889,  893,  900,  903,  906,  909,  911,  925,  929,
-    957,  973,  997,  1018, 1046, 1062, 1078, 1091, 1097, 1103,
-    1107, 1111, 1116, 1119, 1125, 1129, 1132, 1133, 1146, 1151,
-    1156, 1159, 1164, 1165, 1166, 1167
-};
+// Canonical id of a "Book C:V" reference whose book is already known
+static uint32_t ref_canon_id(uint8_t book, const char* ref) {
+    const char* sp = strrchr(ref, ' ');
+    if(book == BOOK_NONE || !sp) return 0;
+    char* end;
+    unsigned long ch = strtoul(sp + 1, &end, 10);
+    if(*end != ':') return 0;
+    unsigned long vs = strtoul(end + 1, NULL, 10);
+    if(!ch || ch > 255 || !vs || vs > 255) return 0;
+    return ((uint32_t)(book + 1) << 16) | (uint32_t)(ch << 8) | (uint32_t)vs;
+}
 
-static inline uint8_t book_chapter_verses(uint8_t book, uint8_t chapter) {
-    return VERSE_COUNTS[VERSE_COUNT_OFFSET[book] + chapter - 1];
+uint32_t verse_canon_id(const App* app, uint16_t vi) {
+    return versify_to_canon((VersifyScheme)app->versify,
+        ref_canon_id(app->index[vi].book, app->index[vi].ref));
 }
 
-// Global app pointer used by zero-arg FlipperHTTP callbacks
-static void* g_app_ptr = NULL;
+int16_t verse_find_canon(const App* app, uint32_t id) {
+    id = versify_from_canon((VersifyScheme)app->versify, id);
+    for(uint16_t i = 0; id && i < app->verse_count; i++)
+        if(ref_canon_id(app->index[i].book, app->index[i].ref) == id) return (int16_t)i;
+    return -1;
+}
 
 // ============================================================
 // Shared drawing primitives (non-static — used by keyboard.c)
@@ -324,87 +203,16 @@ void draw_list_item(Canvas* canvas, uint8_t y, const char* text, bool sel) {
 // General utilities
 // ============================================================
 
-static bool icontains(const char* hay, const char* needle) {
-    if(!hay || !needle || !needle[0]) return false;
-    size_t nlen = strlen(needle), hlen = strlen(hay);
-    if(nlen > hlen) return false;
-    for(size_t i = 0; i <= hlen - nlen; i++) {
-        bool ok = true;
-        for(size_t j = 0; j < nlen; j++) {
-            char a = hay[i+j], b = needle[j];
-            if(a >= 'A' && a <= 'Z') a += 32;
-            if(b >= 'A' && b <= 'Z') b += 32;
-            if(a != b) { ok = false; break; }
-        }
-        if(ok) return true;
-    }
-    return false;
-}
-
 static uint32_t rng_next(uint32_t* s) {
     uint32_t x = *s;
     x ^= x << 13; x ^= x >> 17; x ^= x << 5;
     *s = x; return x;
 }
 
-static void word_wrap(WrapState* w, const char* text, uint8_t cols) {
-    memset(w, 0, sizeof(WrapState));
-    size_t len = strlen(text), pos = 0;
-    if(cols < 1) cols = 1;
-    if(cols > WRAP_LINE_LEN) cols = WRAP_LINE_LEN;
-    while(pos < len && w->count < WRAP_MAX_LINES) {
-        size_t rem = len - pos;
-        if(rem <= cols) {
-            memcpy(w->lines[w->count], text + pos, rem);
-            w->lines[w->count++][rem] = '\0';
-            break;
-        }
-        size_t brk = cols;
-        while(brk > 0 && text[pos + brk] != ' ') brk--;
-        if(!brk) brk = cols;
-        memcpy(w->lines[w->count], text + pos, brk);
-        w->lines[w->count++][brk] = '\0';
-        pos += brk;
-        if(pos < len && text[pos] == ' ') pos++;
-    }
-}
-
 // ============================================================
 // SD card I/O helpers
 // ============================================================
 
-static uint16_t read_line(App* app, char* buf, uint16_t buf_sz) {
-    uint16_t li = 0;
-    while(li < buf_sz - 1) {
-        char ch;
-        if(storage_file_read(app->vfile, &ch, 1) == 0) break;
-        if(ch == '\r') continue;
-        if(ch == '\n') break;
-        buf[li++] = ch;
-    }
-    buf[li] = '\0';
-    return li;
-}
-
-static bool parse_line(const char* line,
-                       char* ref,  size_t ref_sz,
-                       char* book, size_t book_sz,
-                       char* text, size_t text_sz) {
-    const char* p1 = strchr(line, '|');
-    if(!p1) return false;
-    const char* p2 = strchr(p1 + 1, '|');
-    if(!p2) return false;
-
-    size_t rlen = (size_t)(p1 - line);
-    size_t blen = (size_t)(p2 - p1 - 1);
-    size_t tlen = strlen(p2 + 1);
-
-    if(ref)  { size_t n = rlen < ref_sz-1  ? rlen : ref_sz-1;  memcpy(ref,  line,   n); ref[n]  = '\0'; }
-    if(book) { size_t n = blen < book_sz-1 ? blen : book_sz-1; memcpy(book, p1+1,   n); book[n] = '\0'; }
-    if(text) { size_t n = tlen < text_sz-1 ? tlen : text_sz-1; memcpy(text, p2+1,   n); text[n] = '\0'; }
-    return true;
-}
-
 static bool open_verse_file(App* app) {
     if(app->vfile) {
         storage_file_close(app->vfile);
@@ -426,13 +234,180 @@ static bool open_verse_file(App* app) {
 
 // ============================================================
 // Index cache (binary, versioned)
+//
+// Layout in search/idxfmt.h, shared with tools/bvgrep.c
 // ============================================================
 
+// One capitalized word's phonetic key. Entries are sorted by
+// (key, verse, span) so a lookup is a binary search on the SD card.
+typedef struct {
+    uint32_t key;
+    uint16_t verse;
+    uint16_t span;   // text offset << 6 | length
+} PhonEntry;
+
+// One verse's bucket in one LSH band. Each band is stored as its own
+// run of verse_count entries sorted by bucket.
+typedef struct {
+    uint16_t bucket;
+    uint16_t verse;
+} LshEntry;
+
+// One inline markup span. Offsets are into the raw text field and point
+// at the delimiters; entries are sorted by (verse, open).
+typedef struct {
+    uint16_t verse;
+    uint16_t open;
+    uint16_t close;
+    uint8_t  kind;   // MarkupKind
+} MarkEntry;
+
+// Scratch tables gathered by build_index and written as .idx sections
+typedef struct {
+    PhonEntry*   phon;
+    uint16_t     phon_count;
+    PhoneticAlgo phon_algo;
+    LshEntry*    lsh;          // MINHASH_BANDS x MAX_VERSES, band-major
+    MarkEntry*   mark;         // allocated on the first markup seen
+    uint16_t     mark_count;
+    bool         mark_tried;
+} IndexExtras;
+
+// Scratch for an optional section table, or NULL if the heap has no
+// block that large. Furi's malloc halts on failure instead of returning
+// NULL, so the size is checked first.
+static void* section_alloc(size_t size) {
+    if(memmgr_heap_get_max_free_block() < size) return NULL;
+    return malloc(size);
+}
+
 static void index_cache_path(App* app, char* out, size_t out_sz) {
     snprintf(out, out_sz, "%s.idx", app->vfiles[app->vfile_sel].path);
 }
 
-static void index_cache_save(App* app, uint32_t src_size) {
+// Open the .idx cache for section lookups; NULL if it can't be opened
+static File* index_cache_open(App* app) {
+    char cache_path[104];
+    index_cache_path(app, cache_path, sizeof(cache_path));
+    File* f = storage_file_alloc(app->storage);
+    if(!storage_file_open(f, cache_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        storage_file_free(f);
+        return NULL;
+    }
+    return f;
+}
+
+// The German file uses Kölner Phonetik, everything else Metaphone
+static PhoneticAlgo phon_algo_for(App* app) {
+    const char* path = app->vfiles[app->vfile_sel].path;
+    size_t n = strlen(path);
+    return (n >= 7 && strcmp(path + n - 7, "_de.txt") == 0) ?
+        PhoneticCologne : PhoneticMetaphone;
+}
+
+static void phon_collect(IndexExtras* ex, uint16_t verse, const char* line) {
+    const char* text = search_text_field(line);
+    if(!ex->phon || !text) return;
+    size_t n = strlen(text), pos = 0, st, len;
+    while(search_next_word(text, n, &pos, &st, &len)) {
+        if(len < 3 || len > 0x3F || st > 0x3FF) continue;
+        if(!search_word_capitalized(text + st)) continue;
+        uint32_t keys[2];
+        uint8_t nk = phonetic_keys(text + st, len, ex->phon_algo, keys);
+        for(uint8_t k = 0; k < nk && ex->phon_count < MAX_PHON_KEYS; k++) {
+            PhonEntry* e = &ex->phon[ex->phon_count++];
+            e->key   = keys[k];
+            e->verse = verse;
+            e->span  = (uint16_t)((st << 6) | len);
+        }
+    }
+}
+
+static void lsh_collect(IndexExtras* ex, uint16_t verse, const char* line) {
+    if(!ex->lsh) return;
+    const char* text = search_text_field(line);
+    uint16_t bands[MINHASH_BANDS] = {0};
+    if(text) minhash_bands(text, strlen(text), bands);
+    for(uint8_t b = 0; b < MINHASH_BANDS; b++) {
+        LshEntry* e = &ex->lsh[(size_t)b * MAX_VERSES + verse];
+        e->bucket = bands[b];
+        e->verse  = verse;
+    }
+}
+
+// Record the [supplied] and {Christ} spans and ^a note markers of one
+// line. Spans are entered as they open, so they stay ordered by opening
+// offset; one never closed is dropped again. A note marker is a span
+// from the caret to its letter. Files without markup never allocate.
+static void mark_collect(IndexExtras* ex, uint16_t verse, const char* line) {
+    const char* text = search_text_field(line);
+    if(!text || !strpbrk(text, "[{^")) return;
+    if(!ex->mark) {
+        if(ex->mark_tried) return;
+        ex->mark_tried = true;
+        ex->mark = section_alloc(MAX_MARKS * sizeof(MarkEntry));
+        if(!ex->mark) return;
+    }
+    uint16_t first = ex->mark_count;
+    uint16_t open[4];
+    uint8_t  depth = 0;
+    for(uint16_t i = 0; text[i]; i++) {
+        char c = text[i];
+        if((c == '[' || c == '{') && depth < COUNT_OF(open) && ex->mark_count < MAX_MARKS) {
+            MarkEntry* e = &ex->mark[ex->mark_count];
+            e->verse = verse;
+            e->open  = i;
+            e->close = 0;
+            e->kind  = (c == '[') ? MarkupSupplied : MarkupChrist;
+            open[depth++] = ex->mark_count++;
+        } else if(c == '^' && text[i + 1] >= 'a' && text[i + 1] <= 'z' &&
+                  ex->mark_count < MAX_MARKS) {
+            MarkEntry* e = &ex->mark[ex->mark_count++];
+            e->verse = verse;
+            e->open  = i;
+            e->close = (uint16_t)(i + 1);
+            e->kind  = MarkupNote;
+            i++;
+        } else if((c == ']' || c == '}') && depth) {
+            MarkEntry* e = &ex->mark[open[depth - 1]];
+            if(e->kind == ((c == ']') ? MarkupSupplied : MarkupChrist)) {
+                e->close = i;
+                depth--;
+            }
+        }
+    }
+    uint16_t w = first;
+    for(uint16_t r = first; r < ex->mark_count; r++)
+        if(ex->mark[r].close) ex->mark[w++] = ex->mark[r];
+    ex->mark_count = w;
+}
+
+static int lsh_cmp(const void* a, const void* b) {
+    const LshEntry* x = a;
+    const LshEntry* y = b;
+    if(x->bucket != y->bucket) return x->bucket < y->bucket ? -1 : 1;
+    return (int)x->verse - (int)y->verse;
+}
+
+static int phon_cmp(const void* a, const void* b) {
+    const PhonEntry* x = a;
+    const PhonEntry* y = b;
+    if(x->key   != y->key)   return x->key   < y->key   ? -1 : 1;
+    if(x->verse != y->verse) return x->verse < y->verse ? -1 : 1;
+    return (int)x->span - (int)y->span;
+}
+
+// Forget the optional section tables; their offsets point into the .idx
+static void index_sections_clear(App* app) {
+    app->phon_off   = 0;
+    app->phon_count = 0;
+    app->lsh_off    = 0;
+    app->lsh_count  = 0;
+    app->mark_off   = 0;
+    app->mark_count = 0;
+}
+
+static void index_cache_save(App* app, uint32_t src_size, const IndexExtras* ex) {
     char cache_path[104];
     index_cache_path(app, cache_path, sizeof(cache_path));
 
@@ -441,32 +416,91 @@ static void index_cache_save(App* app, uint32_t src_size) {
         storage_file_free(f); return;
     }
 
-    uint8_t hdr[11];
-    memcpy(hdr, IDX_MAGIC, 4);
-    hdr[4]  = IDX_VERSION;
-    hdr[5]  = (uint8_t)(app->verse_count & 0xFF);
-    hdr[6]  = (uint8_t)((app->verse_count >> 8) & 0xFF);
-    hdr[7]  = (uint8_t)(src_size & 0xFF);
-    hdr[8]  = (uint8_t)((src_size >>  8) & 0xFF);
-    hdr[9]  = (uint8_t)((src_size >> 16) & 0xFF);
-    hdr[10] = (uint8_t)((src_size >> 24) & 0xFF);
+    uint8_t hdr[IDX_HDR_SZ];
+    idx_header_put(hdr, app->verse_count, src_size);
     storage_file_write(f, hdr, sizeof(hdr));
 
     for(uint16_t i = 0; i < app->verse_count; i++) {
-        uint8_t entry[4 + REF_LEN];
-        uint32_t off = app->index[i].offset;
-        entry[0] = (uint8_t)(off & 0xFF);
-        entry[1] = (uint8_t)((off >>  8) & 0xFF);
-        entry[2] = (uint8_t)((off >> 16) & 0xFF);
-        entry[3] = (uint8_t)((off >> 24) & 0xFF);
-        memcpy(entry + 4, app->index[i].ref, REF_LEN);
+        uint8_t entry[IDX_ENTRY_SZ];
+        idx_entry_put(entry, app->index[i].offset, app->index[i].ref, app->index[i].book);
         storage_file_write(f, entry, sizeof(entry));
     }
 
+    app->phon_off   = 0;
+    app->phon_count = 0;
+    if(ex && ex->phon_count) {
+        uint8_t sec[IDX_SEC_HDR_SZ + 3];
+        idx_section_put(sec, IDX_SEC_PHON, 3 + (uint32_t)ex->phon_count * PHON_ENTRY_SZ);
+        sec[8] = (uint8_t)ex->phon_algo;
+        idx_put_u16(sec + 9, ex->phon_count);
+        storage_file_write(f, sec, sizeof(sec));
+        for(uint16_t i = 0; i < ex->phon_count; i++) {
+            uint8_t e[PHON_ENTRY_SZ];
+            idx_put_u32(e,     ex->phon[i].key);
+            idx_put_u16(e + 4, ex->phon[i].verse);
+            idx_put_u16(e + 6, ex->phon[i].span);
+            storage_file_write(f, e, sizeof(e));
+        }
+        app->phon_algo  = (uint8_t)ex->phon_algo;
+        app->phon_count = ex->phon_count;
+        app->phon_off   = IDX_HDR_SZ + (uint32_t)app->verse_count * IDX_ENTRY_SZ + sizeof(sec);
+    }
+
+    app->lsh_off   = 0;
+    app->lsh_count = 0;
+    if(ex && ex->lsh) {
+        uint8_t sec[IDX_SEC_HDR_SZ + 3];
+        idx_section_put(sec, IDX_SEC_LSH,
+                        3 + (uint32_t)MINHASH_BANDS * app->verse_count * LSH_ENTRY_SZ);
+        sec[8] = MINHASH_BANDS;
+        idx_put_u16(sec + 9, app->verse_count);
+        uint32_t at = (uint32_t)storage_file_tell(f);
+        storage_file_write(f, sec, sizeof(sec));
+        for(uint8_t b = 0; b < MINHASH_BANDS; b++) {
+            const LshEntry* band = &ex->lsh[(size_t)b * MAX_VERSES];
+            for(uint16_t i = 0; i < app->verse_count; i++) {
+                uint8_t e[LSH_ENTRY_SZ];
+                idx_put_u16(e,     band[i].bucket);
+                idx_put_u16(e + 2, band[i].verse);
+                storage_file_write(f, e, sizeof(e));
+            }
+        }
+        app->lsh_count = app->verse_count;
+        app->lsh_off   = at + sizeof(sec);
+    }
+
+    app->mark_off   = 0;
+    app->mark_count = 0;
+    if(ex && ex->mark_count) {
+        uint8_t sec[IDX_SEC_HDR_SZ + 2];
+        idx_section_put(sec, IDX_SEC_MARK, 2 + (uint32_t)ex->mark_count * MARK_ENTRY_SZ);
+        idx_put_u16(sec + 8, ex->mark_count);
+        uint32_t at = (uint32_t)storage_file_tell(f);
+        storage_file_write(f, sec, sizeof(sec));
+        for(uint16_t i = 0; i < ex->mark_count; i++) {
+            uint8_t e[MARK_ENTRY_SZ];
+            idx_put_u16(e,     ex->mark[i].verse);
+            idx_put_u16(e + 2, ex->mark[i].open);
+            idx_put_u16(e + 4, ex->mark[i].close);
+            e[6] = ex->mark[i].kind;
+            storage_file_write(f, e, sizeof(e));
+        }
+        app->mark_count = ex->mark_count;
+        app->mark_off   = at + sizeof(sec);
+    }
+
     storage_file_close(f);
     storage_file_free(f);
 }
 
+static bool index_file_read(void* ctx, void* buf, uint32_t len) {
+    return storage_file_read(ctx, buf, len) == len;
+}
+
+static bool index_file_seek(void* ctx, uint32_t offset) {
+    return storage_file_seek(ctx, offset, true);
+}
+
 static bool index_cache_load(App* app) {
     FileInfo src_fi;
     if(storage_common_stat(app->storage,
@@ -483,38 +517,38 @@ static bool index_cache_load(App* app) {
     }
 
     bool ok = false;
-    uint8_t hdr[11];
+    uint8_t hdr[IDX_HDR_SZ];
+    uint16_t count;
+    uint32_t cached_src;
     if(storage_file_read(f, hdr, sizeof(hdr)) != sizeof(hdr)) goto done;
-    if(memcmp(hdr, IDX_MAGIC, 4) != 0)  goto done;
-    if(hdr[4] != IDX_VERSION)           goto done;
-
-    {
-        uint32_t cached_src =
-            (uint32_t)hdr[7] |
-            ((uint32_t)hdr[8]  <<  8) |
-            ((uint32_t)hdr[9]  << 16) |
-            ((uint32_t)hdr[10] << 24);
-        if(cached_src != src_size) goto done;
-
-        uint16_t count =
-            (uint16_t)hdr[5] | ((uint16_t)hdr[6] << 8);
-        if(count == 0 || count > MAX_VERSES) goto done;
-
-        for(uint16_t i = 0; i < count; i++) {
-            uint8_t entry[4 + REF_LEN];
-            if(storage_file_read(f, entry, sizeof(entry)) != sizeof(entry))
-                goto done;
-            app->index[i].offset =
-                (uint32_t)entry[0] |
-                ((uint32_t)entry[1] <<  8) |
-                ((uint32_t)entry[2] << 16) |
-                ((uint32_t)entry[3] << 24);
-            memcpy(app->index[i].ref, entry + 4, REF_LEN);
-            app->index[i].ref[REF_LEN - 1] = '\0';
-        }
-        app->verse_count = count;
-        ok = true;
+    if(!idx_header_get(hdr, &count, &cached_src))             goto done;
+    if(cached_src != src_size)                                goto done;
+    if(count == 0 || count > MAX_VERSES)                      goto done;
+
+    for(uint16_t i = 0; i < count; i++) {
+        uint8_t entry[IDX_ENTRY_SZ];
+        if(storage_file_read(f, entry, sizeof(entry)) != sizeof(entry))
+            goto done;
+        app->index[i].offset =
+            idx_entry_get(entry, app->index[i].ref, &app->index[i].book);
+    }
+    app->verse_count = count;
+    ok = true;
+
+    // Optional sections
+    IdxReader rd = { f, index_file_read, index_file_seek };
+    IdxSections sec;
+    idx_sections_read(&rd, IDX_HDR_SZ + (uint32_t)count * IDX_ENTRY_SZ, &sec);
+    index_sections_clear(app);
+    app->phon_algo  = sec.phon_algo;
+    app->phon_count = sec.phon_count;
+    app->phon_off   = sec.phon_off;
+    if(sec.lsh_off && sec.lsh_bands == MINHASH_BANDS && sec.lsh_count == count) {
+        app->lsh_count = count;
+        app->lsh_off   = sec.lsh_off;
     }
+    app->mark_count = sec.mark_count;
+    app->mark_off   = sec.mark_off;
 
 done:
     storage_file_close(f);
@@ -522,57 +556,50 @@ done:
     return ok;
 }
 
-// O(N) single-pass scan; writes cache afterward
-static bool build_index(App* app) {
-    app->verse_count = 0;
-    if(!app->vfile) return false;
-    storage_file_seek(app->vfile, 0, true);
-
-    char line[LINE_BUF_LEN];
-    uint32_t offset = 0;
+typedef struct {
+    App*         app;
+    IndexExtras* ex;
+} IndexScanCtx;
 
-    while(app->verse_count < MAX_VERSES) {
-        uint32_t line_start = offset;
-        uint16_t li = 0;
-        bool eof = false;
-        while(li < sizeof(line) - 1) {
-            char ch;
-            if(storage_file_read(app->vfile, &ch, 1) == 0) { eof = true; break; }
-            offset++;
-            if(ch == '\r') continue;
-            if(ch == '\n') break;
-            line[li++] = ch;
-        }
-        line[li] = '\0';
-        if(li == 0 && eof) break;
-        if(li == 0) continue;
+static size_t index_scan_read(void* ctx, void* buf, size_t n) {
+    return storage_file_read(((IndexScanCtx*)ctx)->app->vfile, buf, n);
+}
 
-        const char* p = strchr(line, '|');
-        if(!p) { if(eof) break; continue; }
+static void index_scan_verse(void* ctx, uint16_t vi, const char* line) {
+    IndexExtras* ex = ((IndexScanCtx*)ctx)->ex;
+    phon_collect(ex, vi, line);
+    lsh_collect(ex, vi, line);
+    mark_collect(ex, vi, line);
+}
 
-        VerseIndex* vi = &app->index[app->verse_count];
-        vi->offset = line_start;
-        size_t rlen = (size_t)(p - line);
-        if(rlen >= REF_LEN) rlen = REF_LEN - 1;
-        memcpy(vi->ref, line, rlen);
-        vi->ref[rlen] = '\0';
-        app->verse_count++;
+// O(N) single-pass scan (core/core.c, also timed by tools/bvbench.c);
+// the cache is written afterward. Phonetic keys for capitalized words and
+// MinHash LSH buckets are gathered into ex on the way.
+static bool build_index(App* app, IndexExtras* ex) {
+    app->verse_count = 0;
+    if(!app->vfile) return false;
+    storage_file_seek(app->vfile, 0, true);
 
-        if(eof) break;
-    }
+    IndexScanCtx sc = { app, ex };
+    VerseScan scan = { &sc, index_scan_read, index_scan_verse };
+    app->verse_count = verse_index_scan(&scan, app->index);
     return app->verse_count > 0;
 }
 
-static bool read_verse_text(App* app, uint16_t idx, char* buf, size_t buf_sz) {
-    if(!app->vfile || idx >= app->verse_count) {
-        if(buf_sz) buf[0] = '\0';
-        return false;
-    }
-    storage_file_seek(app->vfile, app->index[idx].offset, true);
-    char line[LINE_BUF_LEN];
-    read_line(app, line, sizeof(line));
-    char ref[REF_LEN], book[32];
-    return parse_line(line, ref, sizeof(ref), book, sizeof(book), buf, buf_sz);
+// Load verse idx into app->verse_line with a single block read and return
+// its text field in place, or NULL. The line ends at the first newline.
+static const char* read_verse_line(App* app, uint16_t idx) {
+    char* line = app->verse_line;
+    line[0] = '\0';
+    if(!app->vfile || idx >= app->verse_count) return NULL;
+    io_sched_lock(app->io);
+    uint16_t n = 0;
+    if(storage_file_seek(app->vfile, app->index[idx].offset, true))
+        n = (uint16_t)storage_file_read(app->vfile, line, LINE_BUF_LEN - 1);
+    io_sched_unlock(app->io);
+    line[n] = '\0';
+    line[strcspn(line, "\r\n")] = '\0';
+    return search_text_field(line);
 }
 
 // ============================================================
@@ -626,22 +653,84 @@ static void discover_verse_files(App* app) {
     storage_file_free(dir);
 }
 
+// A verse file numbered other than the KJV names its scheme on its
+// first line: "#versification=hebrew"
+static VersifyScheme verse_file_scheme(App* app, const char* path) {
+    static const char key[] = "#versification=";
+    char line[40];
+    uint16_t n = 0;
+    File* f = storage_file_alloc(app->storage);
+    if(storage_file_open(f, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        n = storage_file_read(f, line, sizeof(line) - 1);
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    line[n] = '\0';
+    if(strncmp(line, key, sizeof(key) - 1) != 0) return VersifyKjv;
+    const char* name = line + sizeof(key) - 1;
+    return versify_scheme(name, strcspn(name, "\r\n"));
+}
+
 // Switch to a different verse file. Tries cache first; falls back to full scan.
-static bool switch_verse_file(App* app, uint8_t new_sel) {
-    if(new_sel >= app->vfile_count) return false;
+static bool load_verse_file(App* app, uint8_t new_sel) {
     app->vfile_sel = new_sel;
-    if(!open_verse_file(app)) return false;
+    bool opened = open_verse_file(app);
+    io_sched_set_file(app->io, app->vfile);
+    if(!opened) return false;
+    app->versify = verse_file_scheme(app, app->vfiles[new_sel].path);
 
     if(index_cache_load(app)) return true;
 
-    if(!build_index(app)) return false;
+    // Section tables are optional: skip any whose scratch buffer won't fit
+    IndexExtras ex = {0};
+    ex.phon      = section_alloc(MAX_PHON_KEYS * sizeof(PhonEntry));
+    ex.phon_algo = phon_algo_for(app);
+    ex.lsh       = section_alloc((size_t)MINHASH_BANDS * MAX_VERSES * sizeof(LshEntry));
+
+    bool ok = build_index(app, &ex);
+    if(ok) {
+        if(ex.phon_count)
+            qsort(ex.phon, ex.phon_count, sizeof(PhonEntry), phon_cmp);
+        for(uint8_t b = 0; ex.lsh && b < MINHASH_BANDS; b++)
+            qsort(&ex.lsh[(size_t)b * MAX_VERSES], app->verse_count,
+                  sizeof(LshEntry), lsh_cmp);
+        // A table left out because its buffer didn't fit must not be
+        // cached as if the file had none, or it would never be rebuilt.
+        // Skip the save; name search, Similar verses and markup stay off
+        // for this file until the next load retries the build.
+        bool complete = ex.phon && ex.lsh && !(ex.mark_tried && !ex.mark);
+        if(complete) {
+            FileInfo fi; uint32_t src_size = 0;
+            if(storage_common_stat(app->storage,
+                    app->vfiles[app->vfile_sel].path, &fi) == FSE_OK)
+                src_size = (uint32_t)fi.size;
+            index_cache_save(app, src_size, &ex);
+        } else {
+            index_sections_clear(app);
+        }
+    }
+    free(ex.phon);
+    free(ex.lsh);
+    free(ex.mark);
+    return ok;
+}
+
+static void search_drop_book_pass(App* app);
 
-    FileInfo fi; uint32_t src_size = 0;
-    if(storage_common_stat(app->storage,
-            app->vfiles[app->vfile_sel].path, &fi) == FSE_OK)
-        src_size = (uint32_t)fi.size;
-    index_cache_save(app, src_size);
-    return true;
+// Background jobs hold offsets into the old file, so they are cancelled
+// and the file is swapped under the I/O lock.
+static bool switch_verse_file(App* app, uint8_t new_sel) {
+    if(new_sel >= app->vfile_count) return false;
+    search_cancel(app);
+    search_drop_book_pass(app);
+    io_sched_cancel_all(app->io);
+    // A prefetch that finished before the cancel may still be queued
+    app->vfile_gen++;
+    app->prefetch_idx = -1;
+    io_sched_lock(app->io);
+    bool ok = load_verse_file(app, new_sel);
+    io_sched_unlock(app->io);
+    return ok;
 }
 
 // ============================================================
@@ -716,6 +805,147 @@ static void toggle_bmark(App* app, uint16_t vi) {
     }
 }
 
+// ============================================================
+// Memorization review
+// ============================================================
+
+static uint32_t review_today(void) {
+    return furi_hal_rtc_get_timestamp() / 86400;
+}
+
+static SrsDeck* review_deck(App* app) {
+    if(!app->review.deck) app->review.deck = srs_open(app->storage, CARDS_PATH);
+    return app->review.deck;
+}
+
+// Show the most overdue card, or the summary once nothing is due
+static void review_next(App* app) {
+    ReviewState* r = &app->review;
+    r->showing  = review_deck(app) && srs_peek_due(r->deck, review_today(), &r->card);
+    r->revealed = false;
+    r->verse    = r->showing ? verse_find_canon(app, r->card.id) : -1;
+    if(r->verse >= 0) open_verse(app, (uint16_t)r->verse, ViewReview);
+    app->view = ViewReview;
+}
+
+static void review_grade(App* app, uint8_t quality) {
+    ReviewState* r = &app->review;
+    if(srs_grade(r->deck, quality, review_today())) r->reviewed++;
+    review_next(app);
+}
+
+// Add one verse as a new card due today. False if it is already a card
+// or its reference has no canonical id.
+static bool review_add(App* app, uint16_t vi) {
+    uint32_t id = verse_canon_id(app, vi);
+    return id && review_deck(app) && srs_add(app->review.deck, id, review_today());
+}
+
+static void review_import_bookmarks(App* app) {
+    app->review.added = 0;
+    for(uint8_t i = 0; i < app->bmarks.count; i++)
+        if(review_add(app, app->bmarks.idx[i])) app->review.added++;
+}
+
+// ============================================================
+// Section headings
+//
+// The optional headings file has one "Reference|Heading" line per
+// section start, e.g. "Matthew 5:1|The Sermon on the Mount", in any
+// order. The file is read whole and becomes the string blob; the ids
+// are sorted once at load, so lookups are binary searches.
+// ============================================================
+
+static int heading_key_cmp(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static void headings_free(HeadingTable* h) {
+    free(h->ids);
+    free(h->text);
+    free(h->blob);
+    memset(h, 0, sizeof(*h));
+}
+
+static void headings_load(App* app) {
+    HeadingTable* h = &app->headings;
+    File* f = storage_file_alloc(app->storage);
+    if(storage_file_open(f, HEADINGS_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint64_t size = storage_file_size(f);
+        if(size > 0 && size <= HEADINGS_MAX_BYTES) h->blob = malloc((size_t)size + 1);
+        if(h->blob) h->blob[storage_file_read(f, h->blob, (size_t)size)] = '\0';
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    if(!h->blob) return;
+
+    uint16_t lines = 1;
+    for(const char* p = h->blob; *p; p++)
+        if(*p == '\n') lines++;
+    // (id << 16 | text offset) sorts by id in one qsort
+    uint64_t* keys = malloc((size_t)lines * sizeof(uint64_t));
+    uint16_t n = 0;
+    for(char* line = h->blob; keys && *line;) {
+        char* next = line + strcspn(line, "\n");
+        if(*next) *next++ = '\0';
+        line[strcspn(line, "\r")] = '\0';
+        char* bar = strchr(line, '|');
+        if(bar) *bar = '\0';
+        const char* sp = strrchr(line, ' ');
+        if(bar && sp && bar[1]) {
+            uint32_t id = ref_canon_id(verse_book_id(line, (size_t)(sp - line)), line);
+            if(id) keys[n++] = ((uint64_t)id << 16) | (uint64_t)(bar + 1 - h->blob);
+        }
+        line = next;
+    }
+    if(n) {
+        qsort(keys, n, sizeof(uint64_t), heading_key_cmp);
+        h->ids  = malloc((size_t)n * sizeof(uint32_t));
+        h->text = malloc((size_t)n * sizeof(uint16_t));
+    }
+    if(h->ids && h->text) {
+        for(uint16_t i = 0; i < n; i++) {
+            h->ids[i]  = (uint32_t)(keys[i] >> 16);
+            h->text[i] = (uint16_t)(keys[i] & 0xFFFF);
+        }
+        h->count = n;
+    }
+    free(keys);
+    if(!h->count) headings_free(h);
+}
+
+// Number of headings at or before canonical id
+static uint16_t heading_upper(const HeadingTable* h, uint32_t id) {
+    uint16_t lo = 0, hi = h->count;
+    while(lo < hi) {
+        uint16_t mid = (uint16_t)((lo + hi) / 2);
+        if(h->ids[mid] <= id) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Move an upper bound from one verse to the next without searching.
+// Verse files run in canonical order; anything else falls back to a
+// search.
+static uint16_t heading_advance(const HeadingTable* h, uint16_t pos, uint32_t id) {
+    if(pos > 0 && h->ids[pos - 1] > id) return heading_upper(h, id);
+    while(pos < h->count && h->ids[pos] <= id) pos++;
+    return pos;
+}
+
+// Section for id given its upper bound: the heading before it in the
+// same book, or -1
+static int16_t heading_at(const HeadingTable* h, uint16_t pos, uint32_t id) {
+    if(!id || pos == 0 || (h->ids[pos - 1] >> 16) != (id >> 16)) return -1;
+    return (int16_t)(pos - 1);
+}
+
+static const char* heading_text(const HeadingTable* h, int16_t i) {
+    return h->blob + h->text[i];
+}
+
 // ============================================================
 // Settings persistence
 // ============================================================
@@ -735,6 +965,8 @@ static void settings_save(App* app) {
     if(len > 0) storage_file_write(f, buf, (uint16_t)len);
     len = snprintf(buf, sizeof(buf), "font_size=%d\n", (int)app->font_choice);
     if(len > 0) storage_file_write(f, buf, (uint16_t)len);
+    len = snprintf(buf, sizeof(buf), "search_mode=%d\n", (int)app->search_mode);
+    if(len > 0) storage_file_write(f, buf, (uint16_t)len);
     len = snprintf(buf, sizeof(buf), "api_trans=%s\n",
         API_TRANSLATIONS[app->api_trans_sel].code);
     if(len > 0) storage_file_write(f, buf, (uint16_t)len);
@@ -748,6 +980,8 @@ static void settings_save(App* app) {
     if(len > 0) storage_file_write(f, buf, (uint16_t)len);
     len = snprintf(buf, sizeof(buf), "daily_day=%lu\n", (unsigned long)app->daily_verse_day);
     if(len > 0) storage_file_write(f, buf, (uint16_t)len);
+    len = snprintf(buf, sizeof(buf), "api_baud=%lu\n",  (unsigned long)app->api_baud);
+    if(len > 0) storage_file_write(f, buf, (uint16_t)len);
 
     storage_file_close(f);
     storage_file_free(f);
@@ -785,6 +1019,9 @@ static void settings_load(App* app) {
         } else if(strcmp(key, "font_size") == 0) {
             int v = atoi(val);
             if(v >= 0 && v < FONT_COUNT) app->font_choice = (FontChoice)v;
+        } else if(strcmp(key, "search_mode") == 0) {
+            int v = atoi(val);
+            if(v >= 0 && v < SearchModeCount) app->search_mode = (SearchMode)v;
         } else if(strcmp(key, "api_trans") == 0) {
             for(uint8_t i = 0; i < API_TRANS_COUNT; i++)
                 if(strcmp(val, API_TRANSLATIONS[i].code) == 0)
@@ -803,12 +1040,684 @@ static void settings_load(App* app) {
             if(v >= 0 && v < MAX_VERSES) app->daily_verse_idx = (uint16_t)v;
         } else if(strcmp(key, "daily_day") == 0) {
             app->daily_verse_day = (uint32_t)strtoul(val, NULL, 10);
+        } else if(strcmp(key, "api_baud") == 0) {
+            app->api_baud = (uint32_t)strtoul(val, NULL, 10);
         }
     }
     storage_file_close(f);
     storage_file_free(f);
 }
 
+static uint8_t settings_item_count(App* app, uint8_t sec) {
+    switch(sec) {
+    case 0:  return app->vfile_count;
+    case 1:  return FONT_COUNT;
+    default: return SearchModeCount;
+    }
+}
+
+static uint8_t settings_active_item(App* app, uint8_t sec) {
+    switch(sec) {
+    case 0:  return app->vfile_sel;
+    case 1:  return (uint8_t)app->font_choice;
+    default: return (uint8_t)app->search_mode;
+    }
+}
+
+// ============================================================
+// Font draw benchmark (hold OK on the Font settings page)
+// ============================================================
+
+#define FONT_BENCH_FRAMES 50
+
+static const char FONT_BENCH_TEXT[] =
+    "In the beginning God created the heaven and the earth. "
+    "Und die Erde war w\xC3\xBCst und leer, und es war finster auf der Tiefe.";
+
+// Draw one screen of verse text in font f; cached selects the glyph-cache path
+static void font_bench_frame(Canvas* canvas, FontChoice f, bool cached) {
+    char line[WRAP_LINE_LEN + 1];
+    uint8_t cols = FONT_CHARS[f], lh = FONT_LINE_H[f];
+    size_t  tlen = sizeof(FONT_BENCH_TEXT) - 1;
+    canvas_clear(canvas);
+    for(uint8_t i = 0; i < font_visible_lines(f); i++) {
+        size_t st = ((size_t)i * cols) % (tlen - cols);
+        memcpy(line, FONT_BENCH_TEXT + st, cols);
+        line[cols] = '\0';
+        uint8_t y = BODY_Y + (i + 1) * lh - 1;
+        if(cached) canvas_draw_str_cached(canvas, (FontSize)f, 2, y, line);
+        else canvas_draw_str(canvas, 2, y, line);
+    }
+}
+
+// Time full-screen text for every FontChoice through the canvas path and
+// the glyph cache. The cache is warmed by one untimed frame so the result
+// is the steady state seen while scrolling.
+static void font_bench_run(App* app) {
+    Canvas* canvas = gui_direct_draw_acquire(app->gui);
+    for(uint8_t f = 0; f < FONT_COUNT; f++) {
+        for(uint8_t cached = 0; cached < 2; cached++) {
+            app->font_bench_us[f][cached] = 0;
+            if(cached && f == FONT_SECONDARY) continue;
+            apply_verse_font(canvas, (FontChoice)f);
+            font_bench_frame(canvas, (FontChoice)f, cached);
+            uint32_t t0 = furi_get_tick();
+            for(uint8_t n = 0; n < FONT_BENCH_FRAMES; n++)
+                font_bench_frame(canvas, (FontChoice)f, cached);
+            uint32_t ms = furi_get_tick() - t0;
+            app->font_bench_us[f][cached] = (uint16_t)(ms * 1000 / FONT_BENCH_FRAMES);
+        }
+    }
+    canvas_clear(canvas);
+    gui_direct_draw_release(app->gui);
+}
+
+// ============================================================
+// Benchmark suite (hold OK on About)
+// ============================================================
+
+// The storage-backed cases of BENCH_CASES on the open verse file.
+// Scratch buffers are the suite's own, so the verse on screen is kept.
+typedef struct {
+    App*      app;
+    int32_t   bm_verse;    // a verse that was not bookmarked, -1 if none
+    char      line[LINE_BUF_LEN];
+    WrapState wrap;
+} BenchCtx;
+
+// The cycle counter; differences stay right across its wrap
+static uint32_t bench_now(void* ctx) {
+    UNUSED(ctx);
+    return furi_hal_cortex_timer_get(0).start;
+}
+
+// One line at a verse's offset, through the worker's lock like read_verse_line
+static bool bench_read_verse(BenchCtx* b, File* f, uint16_t vi) {
+    App* app = b->app;
+    io_sched_lock(app->io);
+    size_t n = 0;
+    bool ok = storage_file_seek(f, app->index[vi].offset, true);
+    if(ok) n = storage_file_read(f, b->line, LINE_BUF_LEN - 1);
+    io_sched_unlock(app->io);
+    b->line[n] = '\0';
+    b->line[strcspn(b->line, "\r\n")] = '\0';
+    return ok && n > 0;
+}
+
+static bool bench_run_op(void* ctx, const BenchCase* c, uint16_t iter) {
+    BenchCtx* b = ctx;
+    App* app = b->app;
+    if(!app->vfile || !app->verse_count) return false;
+    switch(c->op) {
+    case BenchOpIndexBuild: {
+        // Same file, so the index comes out as it was; no extra tables
+        IndexExtras ex = { .mark_tried = true };
+        io_sched_lock(app->io);
+        bool ok = build_index(app, &ex);
+        io_sched_unlock(app->io);
+        return ok;
+    }
+    case BenchOpVerseCold: {
+        File* f = storage_file_alloc(app->storage);
+        bool ok = storage_file_open(f, app->vfiles[app->vfile_sel].path,
+                                    FSAM_READ, FSOM_OPEN_EXISTING) &&
+                  bench_read_verse(b, f, (uint16_t)((iter * 7919u) % app->verse_count));
+        storage_file_close(f);
+        storage_file_free(f);
+        return ok;
+    }
+    case BenchOpVerseWarm:
+        return bench_read_verse(b, app->vfile, (uint16_t)(app->verse_count / 2));
+    case BenchOpSearch: {
+        MatchSpan spans[MAX_HIT_SPANS];
+        uint8_t   span_count;
+        for(uint16_t vi = 0; vi < app->verse_count; vi++) {
+            if(!bench_read_verse(b, app->vfile, vi)) return false;
+            search_line(b->line, c->query, SearchModeSubstring, spans, MAX_HIT_SPANS, &span_count);
+        }
+        return true;
+    }
+    case BenchOpWrap:
+        word_wrap(&b->wrap, BENCH_WRAP_TEXT, FONT_CHARS[c->font]);
+        return true;
+    case BenchOpBookmarkToggle:
+        if(b->bm_verse < 0) return false;
+        toggle_bmark(app, (uint16_t)b->bm_verse);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Append the run to BENCH_CSV_PATH, with the header if the file is new
+static bool bench_save(App* app, uint32_t timestamp) {
+    const char* path = app->vfile_count ? app->vfiles[app->vfile_sel].path : "";
+    const char* slash = strrchr(path, '/');
+    const char* vname = slash ? slash + 1 : path;
+
+    File* f = storage_file_alloc(app->storage);
+    bool ok = storage_file_open(f, BENCH_CSV_PATH, FSAM_WRITE, FSOM_OPEN_APPEND);
+    if(ok) {
+        char row[160];
+        size_t n;
+        if(storage_file_size(f) == 0 && (n = bench_csv_header(row, sizeof(row))) > 0)
+            ok = storage_file_write(f, row, n) == n;
+        for(uint8_t i = 0; i < BENCH_CASE_COUNT && ok; i++) {
+            n = bench_csv_row(row, sizeof(row), timestamp, "device", APP_VERSION, vname,
+                              &BENCH_CASES[i], &app->bench[i]);
+            ok = n > 0 && storage_file_write(f, row, n) == n;
+        }
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    return ok;
+}
+
+// Runs on the app thread; searches are cancelled first so the index
+// is not rebuilt under a running job
+static void bench_suite_run(App* app) {
+    BenchCtx* b = malloc(sizeof(BenchCtx));
+    if(!b) return;
+    memset(b, 0, sizeof(*b));
+    b->app      = app;
+    b->bm_verse = -1;
+    for(uint16_t vi = 0; vi < app->verse_count; vi++)
+        if(!is_bookmarked(app, vi)) { b->bm_verse = vi; break; }
+    if(app->bmarks.count >= MAX_BOOKMARKS) b->bm_verse = -1;
+
+    search_cancel(app);
+    BenchHooks h = {
+        .ctx          = b,
+        .now          = bench_now,
+        .ticks_per_us = furi_hal_cortex_instructions_per_microsecond(),
+        .run          = bench_run_op,
+    };
+    for(uint8_t i = 0; i < BENCH_CASE_COUNT; i++)
+        bench_run_case(&h, &BENCH_CASES[i], &app->bench[i]);
+    free(b);
+
+    app->bench_scroll = 0;
+    app->bench_saved  = bench_save(app, furi_hal_rtc_get_timestamp());
+}
+
+// ============================================================
+// Background I/O jobs
+// ============================================================
+
+// Prefetch reads the next verse into spare_line while the user reads.
+// The scheduler starts it at the verse's offset, so one block read does.
+typedef struct {
+    uint16_t idx;
+    uint16_t gen;    // app->vfile_gen at submit; a mismatch means a stale file
+    char*    line;   // spare_line, owned by the job until it completes
+} PrefetchJob;
+
+static IoStep prefetch_job_step(void* ctx, File* f) {
+    PrefetchJob* j = ctx;
+    size_t got = storage_file_read(f, j->line, LINE_BUF_LEN - 1);
+    j->line[got] = '\0';
+    j->line[strcspn(j->line, "\r\n")] = '\0';
+    return IoStepDone;
+}
+
+static void prefetch_verse(App* app, uint16_t vi) {
+    if(!app->spare_line || vi >= app->verse_count) return;   // one in flight
+    PrefetchJob* j = malloc(sizeof(PrefetchJob));
+    if(!j) return;
+    j->idx  = vi;
+    j->gen  = app->vfile_gen;
+    j->line = app->spare_line;
+    app->spare_line = NULL;
+    if(!io_sched_submit(app->io, IoPriorityBackground, IoJobPrefetch,
+                        prefetch_job_step, j, app->index[vi].offset)) {
+        app->spare_line = j->line;
+        free(j);
+    }
+}
+
+// Search runs one verse per index entry, a bounded number per slice, into
+// the job's own SearchHits; the app copies them over on completion.
+#define SEARCH_SLICE_VERSES 24
+
+typedef struct {
+    const VerseIndex* index;
+    uint16_t          verse_count;   // end of the pass
+    uint16_t          next;
+    uint8_t           book;          // one book's range only, or BOOK_NONE
+    SearchMode        mode;
+    char              query[MAX_SEARCH_LEN];
+    SearchHits        hits;
+    char              line[LINE_BUF_LEN];
+} SearchJob;
+
+static void search_reset(SearchHits* h) {
+    h->count     = 0;
+    h->sel       = 0;
+    h->scroll    = 0;
+    h->total     = 0;
+    h->open_book = BOOK_NONE;
+    memset(h->book_hits, 0, sizeof(h->book_hits));
+}
+
+static void search_drop_book_pass(App* app) {
+    free(app->book_pass);
+    app->book_pass = NULL;
+}
+
+static void search_count_book(SearchHits* h, const VerseIndex* index, uint16_t vi) {
+    uint8_t b = index[vi].book;
+    if(b < BIBLE_BOOKS_COUNT) h->book_hits[b]++;
+    h->total++;
+}
+
+// The pass runs over the whole file so the per-book totals are exact;
+// only the first MAX_SEARCH_RESULTS hits are kept for display.
+static IoStep search_job_step(void* ctx, File* f) {
+    SearchJob* j = ctx;
+    MatchSpan spans[MAX_HIT_SPANS];
+    uint8_t   span_count;
+    for(uint8_t n = 0; n < SEARCH_SLICE_VERSES && j->next < j->verse_count; n++) {
+        uint16_t vi = j->next++;
+        if(!storage_file_seek(f, j->index[vi].offset, true)) return IoStepFailed;
+        size_t got = storage_file_read(f, j->line, LINE_BUF_LEN - 1);
+        j->line[got] = '\0';
+        j->line[strcspn(j->line, "\r\n")] = '\0';
+        if(!search_line(j->line, j->query, j->mode, spans, MAX_HIT_SPANS, &span_count))
+            continue;
+        search_count_book(&j->hits, j->index, vi);
+        uint8_t hi = j->hits.count;
+        if(hi < MAX_SEARCH_RESULTS) {
+            j->hits.idx[hi]        = vi;
+            j->hits.span_count[hi] = span_count;
+            memcpy(j->hits.spans[hi], spans, sizeof(spans));
+            j->hits.count++;
+        }
+    }
+    return j->next < j->verse_count ? IoStepMore : IoStepDone;
+}
+
+static void app_on_io(App* app, const IoCompletion* c);
+
+// On the worker thread, hand the completion to the main loop. Cancels
+// raise it on the app thread itself, which must not wait on its own
+// queue, so those are applied on the spot.
+static void io_done_cb(const IoCompletion* done, void* ctx) {
+    App* app = ctx;
+    if(furi_thread_get_current_id() == app->thread_id) {
+        app_on_io(app, done);
+        return;
+    }
+    AppEvent ev = { .type = AppEventIo, .io = *done };
+    furi_message_queue_put(app->queue, &ev, FuriWaitForever);
+}
+
+// Completions are applied on the app thread; every job context is freed here
+static void app_on_io(App* app, const IoCompletion* c) {
+    switch((IoJobKind)c->kind) {
+    case IoJobSearch: {
+        SearchJob* j = c->ctx;
+        if(c->id == app->search_job) {
+            app->search_job  = 0;
+            app->search_busy = false;
+            if(c->result == IoResultOk && j->book != BOOK_NONE) {
+                // A book pass fills only the open book's rows; the full
+                // pass's hits and totals stay as they were
+                search_drop_book_pass(app);
+                app->book_pass = malloc(sizeof(SearchHits));
+                if(app->book_pass) {
+                    *app->book_pass = j->hits;
+                    app->book_pass->open_book = j->book;
+                }
+            } else if(c->result == IoResultOk) {
+                bool grouped = app->hits.grouped;
+                app->hits = j->hits;
+                app->hits.grouped = grouped;
+            }
+        }
+        free(j);
+        break;
+    }
+    case IoJobPrefetch: {
+        PrefetchJob* j = c->ctx;
+        app->spare_line   = j->line;
+        app->prefetch_idx = (c->result == IoResultOk && j->gen == app->vfile_gen) ?
+                                (int16_t)j->idx : -1;
+        free(j);
+        break;
+    }
+    }
+}
+
+// ============================================================
+// Idle maintenance
+//
+// Run from the event loop once no key has been pressed for
+// IDLE_AFTER_MS. Each job checkpoints through its cursor and stops as
+// soon as idle_should_yield says a key arrived or the tick budget is
+// spent.
+// ============================================================
+
+// Decode the printable ASCII glyphs of the verse font ahead of use, so
+// the first page after a font change doesn't pay for them
+static IdleStep idle_warm_glyphs(void* ctx, uint32_t* cursor, const IdleRunner* r) {
+    App* app = ctx;
+    if(app->font_choice == FONT_SECONDARY) return IdleStepDone;
+    while(*cursor < 95) {
+        char ch = (char)(' ' + *cursor);
+        font_strn_width_cached((FontSize)app->font_choice, &ch, 1);
+        (*cursor)++;
+        if(idle_should_yield(r)) return IdleStepMore;
+    }
+    return IdleStepDone;
+}
+
+// Remove .idx caches whose verse file is gone. cursor counts directory
+// entries already checked; a removed cache drops out of the listing, so
+// the cursor isn't advanced past it.
+static IdleStep idle_prune_caches(void* ctx, uint32_t* cursor, const IdleRunner* r) {
+    App* app = ctx;
+    char stale[104] = {0};
+    bool done = true;
+    File* dir = storage_file_alloc(app->storage);
+    if(storage_dir_open(dir, DATA_DIR)) {
+        FileInfo fi; char fname[64];
+        uint32_t i = 0;
+        while(storage_dir_read(dir, &fi, fname, sizeof(fname))) {
+            if(i++ < *cursor) continue;
+            if(idle_should_yield(r)) { done = false; break; }
+            size_t n = strlen(fname);
+            if(!(fi.flags & FSF_DIRECTORY) && n > 4 &&
+               strcmp(fname + n - 4, ".idx") == 0) {
+                char src[104];
+                snprintf(src, sizeof(src), "%s/%.*s", DATA_DIR, (int)(n - 4), fname);
+                if(!storage_file_exists(app->storage, src)) {
+                    snprintf(stale, sizeof(stale), "%s.idx", src);
+                    done = false;
+                    break;
+                }
+            }
+            (*cursor)++;
+        }
+        storage_dir_close(dir);
+    }
+    storage_file_free(dir);
+    if(stale[0]) storage_simply_remove(app->storage, stale);
+    return done ? IdleStepDone : IdleStepMore;
+}
+
+static void idle_setup(App* app) {
+    idle_init(&app->idle, IDLE_AFTER_MS, IDLE_BUDGET_MS);
+    app->idle_warm = idle_register(&app->idle, idle_warm_glyphs, app);
+    idle_register(&app->idle, idle_prune_caches, app);
+}
+
+// ============================================================
+// Inline markup
+//
+// Spans come from the MARK section built at index time. Opening a verse
+// looks its spans up with one binary search and cuts the delimiters out
+// of the line, so neither wrapping nor drawing sees markup characters.
+// ============================================================
+
+static bool mark_read(File* f, App* app, uint16_t i, MarkEntry* e) {
+    uint8_t b[MARK_ENTRY_SZ];
+    if(!storage_file_seek(f, app->mark_off + (uint32_t)i * MARK_ENTRY_SZ, true)) return false;
+    if(storage_file_read(f, b, sizeof(b)) != sizeof(b)) return false;
+    e->verse = idx_get_u16(b);
+    e->open  = idx_get_u16(b + 2);
+    e->close = idx_get_u16(b + 4);
+    e->kind  = b[6];
+    return true;
+}
+
+// Offset in the cleaned text of raw text offset raw
+static uint16_t markup_clean_off(const VerseMarkup* m, uint16_t raw) {
+    uint16_t n = 0;
+    while(n < m->cut_count && m->cut[n] < raw) n++;
+    return (uint16_t)(raw - n);
+}
+
+static void markup_apply(App* app, uint16_t vi, char* text) {
+    VerseMarkup* m = &app->cur_markup;
+    m->count     = 0;
+    m->cut_count = 0;
+    if(!app->mark_count || !text) return;
+    File* f = index_cache_open(app);
+    if(!f) return;
+
+    MarkEntry e;
+    uint16_t lo = 0, hi = app->mark_count;
+    while(lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if(!mark_read(f, app, mid, &e)) { lo = hi = app->mark_count; break; }
+        if(e.verse < vi) lo = mid + 1; else hi = mid;
+    }
+    size_t n = strlen(text);
+    uint16_t open[MAX_VERSE_MARKS], close[MAX_VERSE_MARKS];
+    for(uint16_t i = lo; i < app->mark_count && m->count < MAX_VERSE_MARKS; i++) {
+        if(!mark_read(f, app, i, &e) || e.verse != vi) break;
+        // A cache that no longer matches the line is ignored span by span
+        if(e.close >= n || e.open >= e.close || e.kind > MarkupNote) continue;
+        if(e.kind == MarkupNote) {
+            if(text[e.open] != '^' || text[e.close] < 'a' || text[e.close] > 'z') continue;
+        } else if(!strchr("[{", text[e.open]) || !strchr("]}", text[e.close])) {
+            continue;
+        }
+        open[m->count]    = e.open;
+        close[m->count]   = e.close;
+        m->kind[m->count] = e.kind;
+        m->count++;
+    }
+    storage_file_close(f);
+    storage_file_free(f);
+
+    // A note marker keeps its letter; only the caret is cut
+    for(uint8_t k = 0; k < m->count; k++) {
+        m->cut[m->cut_count++] = open[k];
+        if(m->kind[k] != MarkupNote) m->cut[m->cut_count++] = close[k];
+    }
+    for(uint8_t i = 1; i < m->cut_count; i++) {
+        uint16_t v = m->cut[i];
+        uint8_t  j = i;
+        while(j > 0 && m->cut[j - 1] > v) { m->cut[j] = m->cut[j - 1]; j--; }
+        m->cut[j] = v;
+    }
+    for(uint8_t k = 0; k < m->count; k++) {
+        uint16_t a = markup_clean_off(m, (uint16_t)(open[k] + 1));
+        uint16_t b = markup_clean_off(m, close[k]) + (m->kind[k] == MarkupNote);
+        m->span[k].off = a;
+        m->span[k].len = (uint8_t)MIN(b - a, 255);
+    }
+
+    size_t w = 0;
+    uint8_t c = 0;
+    for(size_t r = 0; r < n; r++) {
+        if(c < m->cut_count && m->cut[c] == r) { c++; continue; }
+        text[w++] = text[r];
+    }
+    text[w] = '\0';
+}
+
+static void markup_mark_runs(App* app) {
+    static const uint8_t style[] = {
+        [MarkupSupplied] = WrapRunDotted,
+        [MarkupChrist]   = WrapRunUnderline,
+        [MarkupNote]     = WrapRunFrame,
+    };
+    const VerseMarkup* m = &app->cur_markup;
+    for(uint8_t k = 0; k < m->count; k++)
+        wrap_mark_spans(&app->wrap, &m->span[k], 1, style[m->kind[k]]);
+}
+
+// ============================================================
+// Footnotes
+//
+// verses_X.txt may come with notes_X.txt, one "Reference|a|Note text"
+// line per ^a marker, in any order. Note text is only read when a marker
+// is opened: the first time, the notes file is indexed into a sidecar
+// notes_X.txt.idx of (verse id << 5 | marker, offset) pairs sorted by
+// key, so each later note is a binary search on the SD card and one read.
+// ============================================================
+
+#define NOTE_ENTRY_SZ 8
+
+typedef struct {
+    uint32_t key;
+    uint32_t off;   // offset of the note text in the notes file
+} NoteEntry;
+
+static inline uint32_t note_key(uint32_t id, char marker) {
+    return (id << 5) | (uint32_t)(marker - 'a' + 1);
+}
+
+static bool notes_path(App* app, char* out, size_t out_sz) {
+    const char* path  = app->vfiles[app->vfile_sel].path;
+    const char* slash = strrchr(path, '/');
+    if(!slash || strncmp(slash + 1, "verses_", 7) != 0) return false;
+    snprintf(out, out_sz, "%.*s/notes_%s", (int)(slash - path), path, slash + 8);
+    return true;
+}
+
+static int note_entry_cmp(const void* a, const void* b) {
+    uint32_t x = ((const NoteEntry*)a)->key, y = ((const NoteEntry*)b)->key;
+    return (x > y) - (x < y);
+}
+
+static bool notes_index_build(App* app, const char* src, const char* idx, uint32_t src_size) {
+    NoteEntry* tab = malloc(MAX_NOTES * sizeof(NoteEntry));
+    if(!tab) return false;
+    uint16_t n = 0;
+    File* f = storage_file_alloc(app->storage);
+    if(storage_file_open(f, src, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        char line[64];   // reference and marker; the text isn't needed
+        uint32_t offset = 0;
+        bool eof = false;
+        while(!eof && n < MAX_NOTES) {
+            uint32_t line_start = offset;
+            uint16_t li = 0;
+            for(;;) {
+                char ch;
+                if(storage_file_read(f, &ch, 1) == 0) { eof = true; break; }
+                offset++;
+                if(ch == '\n') break;
+                if(li < sizeof(line) - 1) line[li++] = ch;
+            }
+            line[li] = '\0';
+            char* bar = strchr(line, '|');
+            if(!bar || bar[1] < 'a' || bar[1] > 'z' || bar[2] != '|') continue;
+            *bar = '\0';
+            const char* sp = strrchr(line, ' ');
+            uint32_t id = sp ? ref_canon_id(verse_book_id(line, (size_t)(sp - line)), line) : 0;
+            if(!id) continue;
+            tab[n].key = note_key(id, bar[1]);
+            tab[n].off = line_start + (uint32_t)(bar + 3 - line);
+            n++;
+        }
+        storage_file_close(f);
+    }
+    qsort(tab, n, sizeof(NoteEntry), note_entry_cmp);
+
+    bool ok = false;
+    if(n && storage_file_open(f, idx, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        uint8_t hdr[11];
+        memcpy(hdr, NOTES_MAGIC, 4);
+        hdr[4] = NOTES_VERSION;
+        idx_put_u16(hdr + 5, n);
+        idx_put_u32(hdr + 7, src_size);
+        ok = storage_file_write(f, hdr, sizeof(hdr)) == sizeof(hdr);
+        for(uint16_t i = 0; ok && i < n; i++) {
+            uint8_t e[NOTE_ENTRY_SZ];
+            idx_put_u32(e,     tab[i].key);
+            idx_put_u32(e + 4, tab[i].off);
+            ok = storage_file_write(f, e, sizeof(e)) == sizeof(e);
+        }
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    free(tab);
+    return ok;
+}
+
+// Open the notes index, building it if it is missing or stale. Returns
+// the entry count, 0 if the verse file has no usable notes.
+static uint16_t notes_index_open(App* app, const char* src, File* f) {
+    FileInfo fi;
+    if(storage_common_stat(app->storage, src, &fi) != FSE_OK) return 0;
+    char idx[112];
+    snprintf(idx, sizeof(idx), "%s.idx", src);
+    for(uint8_t attempt = 0; attempt < 2; attempt++) {
+        if(storage_file_open(f, idx, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            uint8_t hdr[11];
+            if(storage_file_read(f, hdr, sizeof(hdr)) == sizeof(hdr) &&
+               memcmp(hdr, NOTES_MAGIC, 4) == 0 && hdr[4] == NOTES_VERSION &&
+               idx_get_u32(hdr + 7) == (uint32_t)fi.size)
+                return idx_get_u16(hdr + 5);
+            storage_file_close(f);
+        }
+        if(attempt || !notes_index_build(app, src, idx, (uint32_t)fi.size)) break;
+    }
+    return 0;
+}
+
+// Read note marker of verse vi into out; false if there is none
+static bool note_read(App* app, uint16_t vi, char marker, char* out, size_t out_sz) {
+    char src[104];
+    uint32_t id = verse_canon_id(app, vi);
+    out[0] = '\0';
+    if(!id || !notes_path(app, src, sizeof(src))) return false;
+
+    File* f = storage_file_alloc(app->storage);
+    uint16_t count = notes_index_open(app, src, f);
+    uint32_t key = note_key(id, marker), off = 0;
+    bool found = false;
+    if(count) {
+        uint16_t lo = 0, hi = count;
+        while(lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            uint8_t e[NOTE_ENTRY_SZ];
+            if(!storage_file_seek(f, 11 + (uint32_t)mid * NOTE_ENTRY_SZ, true) ||
+               storage_file_read(f, e, sizeof(e)) != sizeof(e))
+                break;
+            uint32_t k = idx_get_u32(e);
+            if(k == key) { off = idx_get_u32(e + 4); found = true; break; }
+            if(k < key) lo = mid + 1; else hi = mid;
+        }
+        storage_file_close(f);
+    }
+    if(found && storage_file_open(f, src, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint16_t n = 0;
+        if(storage_file_seek(f, off, true)) n = storage_file_read(f, out, out_sz - 1);
+        out[n] = '\0';
+        out[strcspn(out, "\r\n")] = '\0';
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    return found && out[0];
+}
+
+// Marker letter of cur_markup entry k
+static char note_marker(App* app, uint8_t k) {
+    return app->wrap.src[app->cur_markup.span[k].off];
+}
+
+// Show the note of cur_markup entry k
+static void note_show(App* app, uint8_t k) {
+    NoteState* ns = &app->note;
+    ns->sel   = k;
+    ns->found = note_read(app, (uint16_t)app->cur_verse, note_marker(app, k),
+                          ns->text, sizeof(ns->text));
+    word_wrap(&ns->wrap, ns->found ? ns->text : "", FONT_CHARS[app->font_choice]);
+    app->view = ViewNote;
+}
+
+// Next note marker of the open verse after k in direction dir, or -1
+static int16_t note_next(App* app, int16_t k, int8_t dir) {
+    const VerseMarkup* m = &app->cur_markup;
+    for(k += dir; k >= 0 && k < m->count; k += dir)
+        if(m->kind[k] == MarkupNote) return k;
+    return -1;
+}
+
 // ============================================================
 // Verse navigation (non-static — called by keyboard.c)
 // ============================================================
@@ -818,39 +1727,449 @@ void open_verse(App* app, uint16_t vi, AppView ret) {
     app->return_view = ret;
     strncpy(app->cur_ref, app->index[vi].ref, sizeof(app->cur_ref) - 1);
     app->cur_ref[sizeof(app->cur_ref) - 1] = '\0';
-    char text[LINE_BUF_LEN];
-    if(!read_verse_text(app, vi, text, sizeof(text)))
-        strncpy(text, "(read error)", sizeof(text));
-    word_wrap(&app->wrap, text, FONT_CHARS[app->font_choice]);
+    const char* text;
+    if(app->prefetch_idx == (int16_t)vi) {
+        char* t = app->verse_line;
+        app->verse_line = app->spare_line;
+        app->spare_line = t;
+        text = search_text_field(app->verse_line);
+    } else {
+        text = read_verse_line(app, vi);
+    }
+    app->prefetch_idx = -1;
+    markup_apply(app, vi, text ? app->verse_line + (text - app->verse_line) : NULL);
+    app->cur_heading  = -1;
+    if(app->headings.count) {
+        uint32_t id = verse_canon_id(app, vi);
+        app->cur_heading = heading_at(&app->headings, heading_upper(&app->headings, id), id);
+    }
+    word_wrap(&app->wrap, text ? text : "(read error)", FONT_CHARS[app->font_choice]);
+    markup_mark_runs(app);
     app->view = ViewVerseRead;
+    prefetch_verse(app, (uint16_t)(vi + 1));
+}
+
+// Highlight match spans in the open verse and scroll to the first one.
+// Spans come straight from the search pass, so no re-read is needed.
+// Spans are in raw line offsets, as search and the phonetic table see
+// the text; they are mapped past any markup cut from it
+void verse_highlight(App* app, const MatchSpan* spans, uint8_t n) {
+    const VerseMarkup* m = &app->cur_markup;
+    MatchSpan clean[MAX_HIT_SPANS];
+    if(n > MAX_HIT_SPANS) n = MAX_HIT_SPANS;
+    for(uint8_t i = 0; i < n; i++) {
+        clean[i].off = markup_clean_off(m, spans[i].off);
+        clean[i].len = (uint8_t)(markup_clean_off(m, spans[i].off + spans[i].len) - clean[i].off);
+    }
+    uint8_t first = app->wrap.run_count;
+    wrap_mark_spans(&app->wrap, clean, n, WrapRunInvert);
+    if(app->wrap.run_count == first) return;
+    uint8_t vis     = reader_lines(app);
+    uint8_t top     = app->wrap.runs[first].line;
+    uint8_t max_top = (app->wrap.count > vis) ? app->wrap.count - vis : 0;
+    app->wrap.scroll = (top < max_top) ? top : max_top;
+}
+
+// ============================================================
+// Similar verses (MinHash LSH lookup)
+// ============================================================
+
+static bool lsh_read(File* f, App* app, uint8_t band, uint16_t i, LshEntry* e) {
+    uint8_t b[LSH_ENTRY_SZ];
+    uint32_t at = app->lsh_off + ((uint32_t)band * app->lsh_count + i) * LSH_ENTRY_SZ;
+    if(!storage_file_seek(f, at, true)) return false;
+    if(storage_file_read(f, b, sizeof(b)) != sizeof(b)) return false;
+    e->bucket = idx_get_u16(b);
+    e->verse  = idx_get_u16(b + 2);
+    return true;
+}
+
+// Credit verse v with one shared band; keeps the candidate set bounded
+// by replacing the weakest entry once full. The newcomer takes over the
+// evicted votes plus its own (space-saving count), so a verse that keeps
+// turning up in later bands can still outrank early one-band hits.
+static void similar_vote(uint16_t* cand, uint8_t* votes, uint8_t* n, uint8_t cap, uint16_t v) {
+    uint8_t weak = 0;
+    for(uint8_t i = 0; i < *n; i++) {
+        if(cand[i] == v) { votes[i]++; return; }
+        if(votes[i] < votes[weak]) weak = i;
+    }
+    if(*n < cap) { cand[*n] = v; votes[*n] = 1; (*n)++; return; }
+    cand[weak] = v;
+    votes[weak]++;
+}
+
+// Build the "similar verses" list for verse vi (whose text is given) from
+// bucket lookups only: hash the verse once, binary-search its bucket in
+// each band, and rank the other verses by how many bands they share.
+static void similar_find(App* app, uint16_t vi, const char* text) {
+    SimilarList* sl = &app->similar;
+    sl->count = 0;
+    sl->sel   = 0;
+    if(!app->lsh_count || !text) return;
+
+    uint16_t bands[MINHASH_BANDS];
+    if(!minhash_bands(text, strlen(text), bands)) return;
+
+    File* f = index_cache_open(app);
+    if(!f) return;
+
+    // Common short phrases make large buckets; cap how much of each we read
+    enum { CAND_CAP = 48, BUCKET_CAP = 32 };
+    uint16_t cand[CAND_CAP];
+    uint8_t  votes[CAND_CAP];
+    uint8_t  n = 0;
+    LshEntry e;
+    for(uint8_t b = 0; b < MINHASH_BANDS; b++) {
+        uint16_t lo = 0, hi = app->lsh_count;
+        while(lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            if(!lsh_read(f, app, b, mid, &e)) { lo = app->lsh_count; break; }
+            if(e.bucket < bands[b]) lo = mid + 1; else hi = mid;
+        }
+        for(uint16_t i = lo, k = 0; i < app->lsh_count && k < BUCKET_CAP; i++, k++) {
+            if(!lsh_read(f, app, b, i, &e) || e.bucket != bands[b]) break;
+            if(e.verse != vi && e.verse < app->verse_count)
+                similar_vote(cand, votes, &n, CAND_CAP, e.verse);
+        }
+    }
+    storage_file_close(f);
+    storage_file_free(f);
+
+    // Keep the best MAX_SIMILAR: most shared bands, then canonical order.
+    // A single shared band is mostly common phrasing ("and the LORD").
+    for(uint8_t i = 0; i < n; i++) {
+        if(votes[i] < 2) continue;
+        uint8_t j = sl->count < MAX_SIMILAR ? sl->count : MAX_SIMILAR - 1;
+        if(sl->count == MAX_SIMILAR && votes[i] <= sl->shared[j]) continue;
+        while(j > 0 && (sl->shared[j - 1] < votes[i] ||
+              (sl->shared[j - 1] == votes[i] && sl->idx[j - 1] > cand[i]))) {
+            sl->idx[j]    = sl->idx[j - 1];
+            sl->shared[j] = sl->shared[j - 1];
+            j--;
+        }
+        sl->idx[j]    = cand[i];
+        sl->shared[j] = votes[i];
+        if(sl->count < MAX_SIMILAR) sl->count++;
+    }
+}
+
+static void similar_open(App* app) {
+    if(app->cur_verse < 0) return;
+    // Chained lookups from a similar verse keep the original way back
+    if(app->return_view != ViewSimilar) app->similar.src_ret = app->return_view;
+    app->similar.src = (uint16_t)app->cur_verse;
+    similar_find(app, app->similar.src, app->wrap.src);
+    app->view = ViewSimilar;
+}
+
+// ============================================================
+// Translation compare
+// ============================================================
+
+// Canonical id of an .idx entry of a file numbered in scheme s
+static uint32_t idx_entry_canon_id(const uint8_t* e, VersifyScheme s, char* ref) {
+    uint8_t book;
+    idx_entry_get(e, ref, &book);
+    return versify_to_canon(s, ref_canon_id(book, ref));
+}
+
+// Read verse vi of another verse file through that file's .idx cache.
+// Verses are matched by canonical id, so translations numbered
+// differently still line up. Most files list their verses in the same
+// order, so entry vi is tried before a scan. The line read must start
+// with the matched reference, which also catches a stale cache.
+static bool compare_read_other(App* app, uint8_t other, uint16_t vi, char* out) {
+    uint32_t id = verse_canon_id(app, vi);
+    VersifyScheme scheme = verse_file_scheme(app, app->vfiles[other].path);
+    char ref[REF_LEN];
+    char path[104];
+    snprintf(path, sizeof(path), "%s.idx", app->vfiles[other].path);
+    File* f = storage_file_alloc(app->storage);
+    bool ok = false;
+    uint32_t offset = 0;
+    if(id && storage_file_open(f, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint8_t hdr[IDX_HDR_SZ], e[IDX_ENTRY_SZ];
+        uint16_t count;
+        uint32_t src_size;
+        if(storage_file_read(f, hdr, sizeof(hdr)) == sizeof(hdr) &&
+           idx_header_get(hdr, &count, &src_size)) {
+            if(vi < count &&
+               storage_file_seek(f, sizeof(hdr) + (uint32_t)vi * IDX_ENTRY_SZ, true) &&
+               storage_file_read(f, e, sizeof(e)) == sizeof(e) &&
+               idx_entry_canon_id(e, scheme, ref) == id) {
+                offset = idx_get_u32(e);
+                ok = true;
+            }
+            if(!ok) storage_file_seek(f, sizeof(hdr), true);
+            for(uint16_t i = 0; !ok && i < count; i++) {
+                if(storage_file_read(f, e, sizeof(e)) != sizeof(e)) break;
+                if(idx_entry_canon_id(e, scheme, ref) == id) {
+                    offset = idx_get_u32(e);
+                    ok = true;
+                }
+            }
+        }
+        storage_file_close(f);
+    }
+    if(ok) {
+        ok = false;
+        if(storage_file_open(f, app->vfiles[other].path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            uint16_t n = 0;
+            if(storage_file_seek(f, offset, true))
+                n = storage_file_read(f, out, LINE_BUF_LEN - 1);
+            out[n] = '\0';
+            out[strcspn(out, "\r\n")] = '\0';
+            size_t rl = strlen(ref);
+            ok = strncmp(out, ref, rl) == 0 && out[rl] == '|';
+            storage_file_close(f);
+        }
+    }
+    storage_file_free(f);
+    return ok;
+}
+
+// Wrap the side being shown and mark its differing words
+static void compare_show(App* app) {
+    CompareState* c = &app->compare;
+    uint8_t side = c->show_other ? 1 : 0;
+    const char* text = c->show_other ? search_text_field(c->line) : app->wrap.src;
+    word_wrap(&c->wrap, text ? text : "", FONT_CHARS[app->font_choice]);
+    wrap_mark_spans(&c->wrap, c->marks[side], c->mark_count[side], WrapRunInvert);
+}
+
+static void compare_open(App* app, uint8_t other) {
+    CompareState* c = &app->compare;
+    c->other         = other;
+    c->show_other    = true;
+    c->found         = false;
+    c->changed       = 0;
+    c->mark_count[0] = 0;
+    c->mark_count[1] = 0;
+    c->line[0]       = '\0';
+    const char* mine = app->wrap.src;
+    if(mine && compare_read_other(app, other, (uint16_t)app->cur_verse, c->line)) {
+        char* theirs = (char*)search_text_field(c->line);
+        WordDiff* d = malloc(sizeof(WordDiff));
+        if(theirs) {
+            // The other file's spans aren't loaded; just drop its markup
+            char* w = theirs;
+            for(const char* r = theirs; *r; r++)
+                if(!strchr("[]{}^", *r)) *w++ = *r;
+            *w = '\0';
+        }
+        if(theirs && d) {
+            c->changed = worddiff_run(d, mine, strlen(mine), theirs, strlen(theirs));
+            for(uint8_t side = 0; side < 2; side++)
+                c->mark_count[side] =
+                    worddiff_spans(d, side, c->marks[side], WRAP_MAX_RUNS);
+            c->found = true;
+        }
+        free(d);
+    }
+    compare_show(app);
+    app->view = ViewCompare;
+}
+
+// Next verse file other than the open one, stepping by dir
+static uint8_t compare_next_file(App* app, uint8_t from, int8_t dir) {
+    uint8_t i = from;
+    do {
+        i = (uint8_t)((i + app->vfile_count + dir) % app->vfile_count);
+    } while(i == app->vfile_sel);
+    return i;
+}
+
+// ============================================================
+// Verse menu (OK while reading)
+//
+// The reader's other views open from here. Holding Left/Right can't
+// open them: a hold sends Long before its Repeats, so the view would
+// swallow the hold that steps through verses.
+// ============================================================
+
+typedef enum {
+    VerseActSimilar,
+    VerseActCompare,
+    VerseActNotes,
+    VerseActCount,
+} VerseAction;
+
+static const char* const VERSE_ACT_LABELS[VerseActCount] = {
+    "Similar verses",
+    "Compare translations",
+    "Notes",
+};
+
+// The actions that apply to the open verse, in menu order
+static uint8_t verse_menu_items(App* app, uint8_t items[VerseActCount]) {
+    uint8_t n = 0;
+    items[n++] = VerseActSimilar;
+    if(app->vfile_count > 1) items[n++] = VerseActCompare;
+    if(note_next(app, -1, 1) >= 0) items[n++] = VerseActNotes;
+    return n;
+}
+
+static void verse_menu_run(App* app, VerseAction a) {
+    switch(a) {
+    case VerseActSimilar:
+        similar_open(app);
+        break;
+    case VerseActCompare:
+        compare_open(app, compare_next_file(app, app->vfile_sel, 1));
+        break;
+    case VerseActNotes: {
+        int16_t k = note_next(app, -1, 1);
+        if(k >= 0) note_show(app, (uint8_t)k);
+        break;
+    }
+    default: break;
+    }
 }
 
 // ============================================================
 // Search — non-static (called by keyboard.c via kb_submit)
 // ============================================================
 
+// Record a hit for verse vi, merging spans into an existing hit.
+// Hits stay ordered by verse number.
+static void search_add_hit(SearchHits* h, uint16_t vi, MatchSpan span) {
+    uint8_t i = 0;
+    while(i < h->count && h->idx[i] < vi) i++;
+    if(i < h->count && h->idx[i] == vi) {
+        if(h->span_count[i] < MAX_HIT_SPANS) h->spans[i][h->span_count[i]++] = span;
+        return;
+    }
+    if(h->count >= MAX_SEARCH_RESULTS) return;
+    for(uint8_t j = h->count; j > i; j--) {
+        h->idx[j]        = h->idx[j - 1];
+        h->span_count[j] = h->span_count[j - 1];
+        memcpy(h->spans[j], h->spans[j - 1], sizeof(h->spans[j]));
+    }
+    h->idx[i]        = vi;
+    h->spans[i][0]   = span;
+    h->span_count[i] = 1;
+    h->count++;
+}
+
+static bool phon_read(File* f, App* app, uint16_t i, PhonEntry* e) {
+    uint8_t b[PHON_ENTRY_SZ];
+    if(!storage_file_seek(f, app->phon_off + (uint32_t)i * PHON_ENTRY_SZ, true)) return false;
+    if(storage_file_read(f, b, sizeof(b)) != sizeof(b)) return false;
+    e->key   = idx_get_u32(b);
+    e->verse = idx_get_u16(b + 4);
+    e->span  = idx_get_u16(b + 6);
+    return true;
+}
+
+// Sound-alike name lookup: binary search for each query key in the
+// sorted PHON table of the .idx cache, then read the run of equal keys.
+// Phonetic hits for the query into h, only book's when it isn't
+// BOOK_NONE. Every matching verse is counted, kept or not, so the totals
+// match a text search's.
+static void phon_search(App* app, SearchHits* h, uint8_t book) {
+    if(!app->phon_count) return;
+    uint32_t keys[2];
+    uint8_t nk = phonetic_keys(app->search_buf, app->search_len,
+                               (PhoneticAlgo)app->phon_algo, keys);
+    if(!nk) return;
+
+    File* f = index_cache_open(app);
+    if(!f) return;
+    uint8_t seen[(MAX_VERSES + 7) / 8] = {0};
+    PhonEntry e;
+    for(uint8_t k = 0; k < nk; k++) {
+        uint16_t lo = 0, hi = app->phon_count;
+        while(lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            if(!phon_read(f, app, mid, &e)) { lo = hi = app->phon_count; break; }
+            if(e.key < keys[k]) lo = mid + 1; else hi = mid;
+        }
+        for(uint16_t i = lo; i < app->phon_count; i++) {
+            if(!phon_read(f, app, i, &e) || e.key != keys[k]) break;
+            if(e.verse >= app->verse_count) continue;
+            if(book != BOOK_NONE && app->index[e.verse].book != book) continue;
+            if(!(seen[e.verse / 8] & (1u << (e.verse % 8)))) {
+                seen[e.verse / 8] |= (uint8_t)(1u << (e.verse % 8));
+                search_count_book(h, app->index, e.verse);
+            }
+            MatchSpan span = { .off = e.span >> 6, .len = e.span & 0x3F };
+            search_add_hit(h, e.verse, span);
+        }
+    }
+    storage_file_close(f);
+    storage_file_free(f);
+}
+
+static uint8_t search_kept_in_book(const App* app, uint8_t book) {
+    uint8_t n = 0;
+    for(uint8_t i = 0; i < app->hits.count; i++)
+        if(app->index[app->hits.idx[i]].book == book) n++;
+    return n;
+}
+
+void search_cancel(App* app) {
+    io_sched_cancel(app->io, app->search_job);
+    app->search_job  = 0;
+    app->search_busy = false;
+}
+
+static bool search_submit(App* app, uint8_t book, uint16_t from, uint16_t to) {
+    SearchJob* j = malloc(sizeof(SearchJob));
+    if(!j) return false;
+    memset(j, 0, sizeof(SearchJob));
+    j->index       = app->index;
+    j->verse_count = to;
+    j->next        = from;
+    j->book        = book;
+    j->mode        = app->search_mode;
+    memcpy(j->query, app->search_buf, sizeof(j->query));
+    search_reset(&j->hits);
+    app->search_job = io_sched_submit(app->io, IoPriorityForeground, IoJobSearch,
+                                      search_job_step, j, app->index[from].offset);
+    if(!app->search_job) { free(j); return false; }
+    app->search_busy = true;
+    return true;
+}
+
 void do_search(App* app) {
-    app->hits.count  = 0;
-    app->hits.sel    = 0;
-    app->hits.scroll = 0;
+    search_cancel(app);
+    search_reset(&app->hits);
+    search_drop_book_pass(app);
     if(!app->search_len || !app->vfile) return;
+    if(app->search_mode == SearchModePhonetic) {
+        phon_search(app, &app->hits, BOOK_NONE);
+        return;
+    }
 
-    storage_file_seek(app->vfile, 0, true);
-    char line[LINE_BUF_LEN];
-    uint16_t verse_num = 0;
+    search_submit(app, BOOK_NONE, 0, app->verse_count);
+}
 
-    while(verse_num < app->verse_count &&
-          app->hits.count < MAX_SEARCH_RESULTS) {
-        uint16_t len = read_line(app, line, sizeof(line));
-        if(len == 0) {
-            char ch;
-            if(storage_file_read(app->vfile, &ch, 1) == 0) break;
-            continue;
-        }
-        if(icontains(line, app->search_buf))
-            app->hits.idx[app->hits.count++] = verse_num;
-        verse_num++;
+// The full pass counts every hit but keeps only MAX_SEARCH_RESULTS, so a
+// book further on may have none kept. Expanding it reruns the query over
+// that book's verses alone into app->book_pass, which only the open
+// book's rows use; the last book fetched is kept until the next search.
+void search_expand_book(App* app, uint8_t book) {
+    SearchHits* h = &app->hits;
+    if(book >= BIBLE_BOOKS_COUNT || search_kept_in_book(app, book) >= h->book_hits[book])
+        return;
+    if(app->book_pass && app->book_pass->open_book == book) return;
+    if(app->search_mode == SearchModePhonetic) {
+        search_drop_book_pass(app);
+        app->book_pass = malloc(sizeof(SearchHits));
+        if(!app->book_pass) return;
+        search_reset(app->book_pass);
+        phon_search(app, app->book_pass, book);
+        app->book_pass->open_book = book;
+        return;
     }
+    uint16_t from = 0;
+    while(from < app->verse_count && app->index[from].book != book) from++;
+    uint16_t to = from;
+    while(to < app->verse_count && app->index[to].book == book) to++;
+    if(from == to) return;
+    search_cancel(app);
+    search_submit(app, book, from, to);
 }
 
 // ============================================================
@@ -872,8 +2191,6 @@ void kb_submit(App* app) {
         extern void api_fetch(App*);
         api_fetch(app);
     } else {
-        app->view = ViewLoading;
-        view_port_update(app->view_port);
         do_search(app);
         app->view = ViewSearchResults;
     }
@@ -900,7 +2217,7 @@ void kb_update_suggestion(App* app) {
     if(app->search_buf[app->search_len - 1] == ' ') {
         bool still_prefixing = false;
         for(uint8_t b = 0; b < BIBLE_BOOKS_COUNT; b++) {
-            const char* name = BIBLE_BOOKS[b].name;
+            const char* name = bible_book_name(b);
             if(strlen(name) <= app->search_len) continue;
             bool match = true;
             for(uint8_t i = 0; i < app->search_len; i++) {
@@ -915,7 +2232,7 @@ void kb_update_suggestion(App* app) {
     }
 
     for(uint8_t b = 0; b < BIBLE_BOOKS_COUNT; b++) {
-        const char* name = BIBLE_BOOKS[b].name;
+        const char* name = bible_book_name(b);
         uint8_t     nlen = (uint8_t)strlen(name);
         if(app->search_len > nlen) continue;
         bool match = true;
@@ -938,135 +2255,350 @@ void kb_update_suggestion(App* app) {
 // Bible API helpers
 // ============================================================
 
-static bool json_extract_str(const char* json, const char* key,
-                              char* out, size_t out_sz) {
-    if(!json || !key || !out || out_sz < 2) return false;
-    char pat[64];
-    snprintf(pat, sizeof(pat), "\"%s\":\"", key);
-    size_t plen = strlen(pat);
-    const char* found = NULL, *p = json;
-    while((p = strstr(p, pat)) != NULL) { found = p; p += plen; }
-    if(!found) return false;
-    const char* start = found + plen;
-    size_t wi = 0; bool escaped = false;
-    for(const char* c = start; *c && wi < out_sz - 1; c++) {
-        if(escaped) {
-            if(*c == 'n' || *c == 'r') out[wi++] = ' ';
-            else if(*c == '"')          out[wi++] = '"';
-            else if(*c == '\\')         out[wi++] = '\\';
-            else { if(wi < out_sz-2) { out[wi++] = '\\'; out[wi++] = *c; } }
-            escaped = false;
-        } else if(*c == '\\') {
-            escaped = true;
-        } else if(*c == '"') {
-            break;
-        } else {
-            out[wi++] = *c;
-        }
+// Providers for lookups: bible-api.com, plus the mirror named by the
+// first line of API_MIRROR_PATH when that file exists
+static void api_backends_setup(App* app) {
+    char line[API_BACKEND_BASE_LEN + 8];
+    size_t n = 0;
+    File* f = storage_file_alloc(app->storage);
+    if(storage_file_open(f, API_MIRROR_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        n = storage_file_read(f, line, sizeof(line) - 1);
+        storage_file_close(f);
     }
-    out[wi] = '\0';
-    while(wi > 0 && (out[wi-1] == ' ' || out[wi-1] == '\n' || out[wi-1] == '\r'))
-        out[--wi] = '\0';
-    return wi > 0;
+    storage_file_free(f);
+    line[n] = '\0';
+    backends_init(&app->backends, n ? line : NULL, furi_ms_to_ticks(API_BACKEND_COOL_MS));
 }
 
-static void api_url_encode(const char* src, char* dst, size_t dst_sz) {
-    size_t di = 0;
-    for(size_t i = 0; src[i] && di < dst_sz - 1; i++)
-        dst[di++] = (src[i] == ' ') ? '+' : src[i];
-    dst[di] = '\0';
+static bool api_ping(App* app) {
+    flipper_http_send_data(app->fhttp, "[PING]");
+    app->fhttp->state = INACTIVE;
+    for(uint8_t i = 0; i < API_PING_MS / 50; i++) {
+        furi_delay_ms(50);
+        if(app->fhttp->state == IDLE) return true;
+    }
+    return false;
 }
 
 static void api_ensure_fhttp(App* app) {
     if(!app->fhttp)
         app->fhttp = flipper_http_alloc();
     if(!app->fhttp) { app->wifi_connected = false; return; }
-    flipper_http_send_data(app->fhttp, "[PING]");
-    app->fhttp->state = INACTIVE;
-    app->wifi_connected = false;
-    for(uint8_t i = 0; i < 20; i++) {
-        furi_delay_ms(50);
-        if(app->fhttp->state == IDLE) { app->wifi_connected = true; break; }
+    // Lookups in flight show the board is there, and a PING would only
+    // be answered after them
+    if(flipper_http_pending_count(app->fhttp)) return;
+    app->wifi_connected = api_ping(app);
+    if(!app->wifi_connected && app->api_baud > BAUDRATE) {
+        // The board may still run at the remembered rate (the app quit
+        // without resetting it), or have rebooted to the connect rate
+        flipper_http_resync_baudrate(app->fhttp,
+            app->fhttp->baudrate == BAUDRATE ? app->api_baud : BAUDRATE);
+        app->wifi_connected = api_ping(app);
+    }
+    if(app->wifi_connected) {
+        if(app->fhttp->baudrate == BAUDRATE) {
+            uint32_t rate = flipper_http_negotiate_baudrate(app->fhttp, app->api_baud);
+            if(rate != app->api_baud) {
+                app->api_baud = rate;
+                settings_save(app);
+            }
+        }
+        // Framed responses when the firmware offers them, text otherwise
+        flipper_http_frame_negotiate(app->fhttp);
+    } else if(app->fhttp->framed) {
+        // A board that rebooted talks text again; ask afresh next time
+        app->fhttp->framed      = false;
+        app->fhttp->frame_tried = false;
     }
 }
 
+// Lookups still in flight are dropped with the board
 static void api_release_fhttp(App* app) {
     if(app->fhttp) { flipper_http_free(app->fhttp); app->fhttp = NULL; }
-}
-
-static bool api_do_request(void) {
-    App* app = (App*)g_app_ptr;
-    if(!app || !app->fhttp) return false;
-    char encoded[96], url[200];
-    api_url_encode(app->api_query, encoded, sizeof(encoded));
-    snprintf(url, sizeof(url), "https://bible-api.com/%s?translation=%s",
-        encoded, API_TRANSLATIONS[app->api_trans_sel].code);
+    memset(app->api_slots, 0, sizeof(app->api_slots));
+    app->api_drain_ping = 0;
+}
+
+// Runs on the FlipperHTTP RX (or timeout) thread: parse the answer into
+// the slot and wake the main loop. The event is only a wake-up: if the
+// queue is full it is dropped and the loop's idle timeout polls instead.
+static void api_on_response(uint16_t id, bool ok, const char* resp, void* ctx) {
+    UNUSED(id);
+    ApiSlot* s = ctx;
+    ApiAnswer a = ApiAnswerBad;
+    if(ok && resp && resp[0])
+        a = s->app->backends.list[s->backend].parse(
+            resp, s->ref, sizeof(s->ref), s->text, sizeof(s->text));
+    s->elapsed = furi_get_tick() - s->sent;
+    s->ok      = a != ApiAnswerBad;
+    s->found   = a == ApiAnswerFound;
+    __atomic_store_n(&s->done, true, __ATOMIC_RELEASE);
+    AppEvent ev = { .type = AppEventApi };
+    furi_message_queue_put(s->app->queue, &ev, 0);
+}
+
+// Pairs with the release in api_on_response: once this sees done set,
+// the callback's writes to ok, found, ref, text and elapsed are visible.
+static bool api_slot_done(ApiSlot* s) {
+    return __atomic_load_n(&s->done, __ATOMIC_ACQUIRE);
+}
+
+static ApiSlot* api_slot_find(App* app, ApiUse use) {
+    for(uint8_t i = 0; i < API_MAX_INFLIGHT; i++)
+        if(app->api_slots[i].busy && app->api_slots[i].use == use) return &app->api_slots[i];
+    return NULL;
+}
+
+static ApiSlot* api_slot_for(App* app, const char* trans, const char* query) {
+    for(uint8_t i = 0; i < API_MAX_INFLIGHT; i++) {
+        ApiSlot* s = &app->api_slots[i];
+        if(s->busy && strcmp(s->trans, trans) == 0 && strcasecmp(s->query, query) == 0)
+            return s;
+    }
+    return NULL;
+}
+
+// Send the slot's lookup to the best backend it hasn't tried yet.
+// False once every backend was tried or the board refused the request
+// (state INACTIVE when it is offline).
+static bool api_send(App* app, ApiSlot* s) {
+    int8_t bi = backends_pick(&app->backends, s->tried, furi_get_tick());
+    if(bi < 0 || !app->fhttp) return false;
+    const ApiBackend* b = &app->backends.list[bi];
+    s->backend = (uint8_t)bi;
+    s->tried  |= (uint8_t)(1u << bi);
+    char url[200];
+    if(!b->url(b, s->trans, s->query, url, sizeof(url))) return false;
+    __atomic_store_n(&s->done, false, __ATOMIC_RELAXED);
+    s->ok    = false;
+    s->found = false;
+    s->sent  = furi_get_tick();
     const char* headers = "{\"Content-Type\":\"application/json\"}";
-    app->fhttp->save_received_data = false;
-    return flipper_http_request(app->fhttp, GET, url, headers, NULL);
-}
-
-static bool api_do_parse(void) {
-    App* app = (App*)g_app_ptr;
-    if(!app || !app->fhttp) return false;
-    const char* resp = app->fhttp->last_response;
-    if(!resp || !resp[0]) return false;
-    if(strstr(resp, "\"error\"")) return false;
-    bool ref_ok  = json_extract_str(resp, "reference",
-                       app->api_result_ref,  sizeof(app->api_result_ref));
-    bool text_ok = json_extract_str(resp, "text",
-                       app->api_result_text, sizeof(app->api_result_text));
-    if(!ref_ok || !text_ok) return false;
+    s->id = flipper_http_request_tagged(app->fhttp, GET, url, headers, NULL, api_on_response, s);
+    return s->id != 0;
+}
+
+// Start a lookup in a free slot. NULL if every slot is busy or it
+// could not be sent.
+static ApiSlot* api_submit(App* app, ApiUse use, const char* trans, const char* query) {
+    if(!app->fhttp) return NULL;
+    ApiSlot* s = NULL;
+    for(uint8_t i = 0; i < API_MAX_INFLIGHT && !s; i++)
+        if(!app->api_slots[i].busy) s = &app->api_slots[i];
+    if(!s) return NULL;
+    memset(s, 0, sizeof(*s));
+    s->app  = app;
+    s->use  = use;
+    s->busy = true;
+    strncpy(s->trans, trans, sizeof(s->trans) - 1);
+    strncpy(s->query, query, sizeof(s->query) - 1);
+    if(!api_send(app, s)) { s->busy = false; return NULL; }
+    return s;
+}
+
+static void api_show_result(App* app) {
     word_wrap(&app->api_wrap, app->api_result_text, FONT_CHARS[app->font_choice]);
     app->api_wrap.scroll = 0;
-    return true;
+    app->view = ViewApiResult;
+}
+
+static void api_show_error(App* app, const char* msg, bool queue) {
+    strncpy(app->api_result_ref, msg, sizeof(app->api_result_ref) - 1);
+    app->api_result_ref[sizeof(app->api_result_ref) - 1] = '\0';
+    app->api_queued = queue && lookup_queue_add(&app->lookups,
+        API_TRANSLATIONS[app->api_trans_sel].code, app->api_query);
+    if(app->api_queued) idle_rearm(&app->idle, app->idle_drain);
+    app->view = ViewApiError;
 }
 
+// Cached verses are shown without the board. Otherwise the lookup is
+// sent and the loading screen stays up until api_poll routes its
+// answer; one already in flight for the same verse (a prefetch) is
+// promoted instead of sent again. Lookups that fail for want of a
+// connection are queued and replayed by idle_drain_lookups.
 void api_fetch(App* app) {
-    api_ensure_fhttp(app);
-    if(!app->fhttp) {
-        strncpy(app->api_result_ref, "WiFi board not found",
-                sizeof(app->api_result_ref) - 1);
-        app->api_result_ref[sizeof(app->api_result_ref) - 1] = '\0';
-        app->view = ViewApiError;
+    const char* trans = API_TRANSLATIONS[app->api_trans_sel].code;
+    // The lookup this one replaces finishes into the cache
+    ApiSlot* prev = api_slot_find(app, ApiUseShow);
+    if(prev) prev->use = ApiUsePrefetch;
+    if(lookup_cache_get(&app->lookups, trans, app->api_query,
+            app->api_result_ref, sizeof(app->api_result_ref),
+            app->api_result_text, sizeof(app->api_result_text))) {
+        api_show_result(app);
         return;
     }
+
+    ApiSlot* s = api_slot_for(app, trans, app->api_query);
+    if(!s) {
+        api_ensure_fhttp(app);
+        if(!app->fhttp) {
+            api_show_error(app, "WiFi board not found", true);
+            return;
+        }
+        s = api_submit(app, ApiUseShow, trans, app->api_query);
+        if(!s) {
+            api_show_error(app, app->fhttp->state == INACTIVE ?
+                "No WiFi connection" : "Request failed", true);
+            return;
+        }
+    }
+    if(s->use != ApiUseReplay) s->use = ApiUseShow;
     app->view = ViewApiLoading;
-    view_port_update(app->view_port);
-    furi_delay_ms(30);
-
-    g_app_ptr = app;
-    bool ok = flipper_http_process_response_async(
-        app->fhttp, api_do_request, api_do_parse);
-
-    if(!ok || app->fhttp->state == ISSUE) {
-        if(app->fhttp->state == INACTIVE)
-            strncpy(app->api_result_ref, "No WiFi connection",
-                    sizeof(app->api_result_ref) - 1);
-        else if(!ok)
-            strncpy(app->api_result_ref, "Verse not found",
-                    sizeof(app->api_result_ref) - 1);
-        else
-            strncpy(app->api_result_ref, "Request failed",
-                    sizeof(app->api_result_ref) - 1);
-        app->api_result_ref[sizeof(app->api_result_ref) - 1] = '\0';
-        app->view = ViewApiError;
+}
+
+// Route finished lookups. Each attempt feeds its backend's statistics;
+// a lookup that wasn't found fails over to the next backend. Then every
+// answer is cached, the one on screen is shown and a replayed one leaves
+// the queue. Done or not found is final; a timeout or [ERROR] keeps a
+// replay queued and holds the drain. True if any slot was routed.
+static bool api_poll(App* app) {
+    bool routed = false;
+    for(uint8_t i = 0; i < API_MAX_INFLIGHT; i++) {
+        ApiSlot* s = &app->api_slots[i];
+        if(!s->busy || !api_slot_done(s)) continue;
+        routed = true;
+        backends_report(&app->backends, s->backend, s->ok, s->elapsed, furi_get_tick());
+        if(!s->found && api_send(app, s)) continue;
+        if(s->found &&
+           lookup_cache_put(&app->lookups, s->trans, s->query, s->ref, s->text))
+            idle_rearm(&app->idle, app->idle_trim);
+        if(s->use == ApiUseReplay) {
+            if(s->ok) lookup_queue_pop(&app->lookups);
+            else app->api_drain_hold = true;
+        }
+        // A replay the user asked for again is shown as well
+        bool show = s->use == ApiUseShow ||
+            (app->view == ViewApiLoading && strcasecmp(s->query, app->api_query) == 0 &&
+             strcmp(s->trans, API_TRANSLATIONS[app->api_trans_sel].code) == 0);
+        s->busy = false;
+        if(!show) continue;
+        if(s->found) {
+            memcpy(app->api_result_ref,  s->ref,  sizeof(app->api_result_ref));
+            memcpy(app->api_result_text, s->text, sizeof(app->api_result_text));
+            api_show_result(app);
+        } else if(s->ok) {
+            api_show_error(app, "Verse not found", false);
+        } else {
+            api_show_error(app, "Request failed", true);
+        }
+    }
+    return routed;
+}
+
+// Replay queued lookups into the response cache while the user is idle
+// in the API screens (the only time the board is held). One replay is
+// in flight at a time so the queue head stays the lookup being answered.
+// Each batch starts with a PING, so a board that went away ends the job
+// until the next reconnect or enqueue re-arms it. The PING is sent on one
+// tick and its [PONG] looked for on the following ones, so no tick waits
+// on the UART; the rate and framing were settled when the board was
+// taken. cursor is the batch budget left.
+static IdleStep idle_drain_lookups(void* ctx, uint32_t* cursor, const IdleRunner* r) {
+    UNUSED(r);
+    App* app = ctx;
+    if(app->api_drain_hold) {
+        app->api_drain_hold = false;
+        return IdleStepDone;
+    }
+    if(!app->fhttp) return IdleStepDone;
+    if(api_slot_find(app, ApiUseReplay)) return IdleStepMore;
+    if(!lookup_queue_count(&app->lookups)) return IdleStepDone;
+    if(*cursor == 0) {
+        if(flipper_http_pending_count(app->fhttp)) {
+            // Lookups in flight show the board is there
+            app->wifi_connected = true;
+        } else if(!app->api_drain_ping) {
+            flipper_http_send_data(app->fhttp, "[PING]");
+            app->fhttp->state   = INACTIVE;
+            app->api_drain_ping = furi_get_tick() | 1;
+            return IdleStepMore;
+        } else if(app->fhttp->state != IDLE) {
+            if(furi_get_tick() - app->api_drain_ping < furi_ms_to_ticks(API_PING_MS))
+                return IdleStepMore;
+            app->api_drain_ping = 0;
+            app->wifi_connected = false;
+            return IdleStepDone;
+        } else {
+            app->wifi_connected = true;
+        }
+        app->api_drain_ping = 0;
+        *cursor = API_DRAIN_BATCH;
+    }
+
+    char trans[LOOKUP_TRANS_LEN], query[LOOKUP_QUERY_LEN];
+    if(!lookup_queue_peek(&app->lookups, trans, query)) {
+        // A line that doesn't parse would block the queue
+        lookup_queue_pop(&app->lookups);
+        return IdleStepMore;
+    }
+    // Already on its way (the user asked again): answered through that slot
+    ApiSlot* s = api_slot_for(app, trans, query);
+    if(s) s->use = ApiUseReplay;
+    else if(!api_submit(app, ApiUseReplay, trans, query)) return IdleStepDone;
+    (*cursor)--;
+    return IdleStepMore;
+}
+
+// Drop the older half of the lookup cache once it passes its limit, a
+// bounded copy per step so a tick stays within its budget. cursor is the
+// cache offset copied up to.
+static IdleStep idle_trim_lookups(void* ctx, uint32_t* cursor, const IdleRunner* r) {
+    App* app = ctx;
+    while(!lookup_cache_trim_step(&app->lookups, cursor))
+        if(idle_should_yield(r)) return IdleStepMore;
+    return IdleStepDone;
+}
+
+// Step the picker one verse forward, wrapping from Revelation to Genesis
+static void api_pick_next(uint8_t* book, uint8_t* ch, uint8_t* v) {
+    if(*v < bible_chapter_verses(*book, *ch)) {
+        (*v)++;
+    } else if(*ch < BIBLE_BOOK_CHAPTERS[*book]) {
+        (*ch)++; *v = 1;
     } else {
-        app->view = ViewApiResult;
+        *book = (*book < BIBLE_BOOKS_COUNT - 1) ? (uint8_t)(*book + 1) : 0;
+        *ch = 1; *v = 1;
     }
 }
 
+// The picker works in canonical numbering; the query uses the
+// translation's own
+static void api_pick_query(const App* app, uint8_t book, uint8_t ch, uint8_t v,
+                           char* out, size_t out_sz) {
+    uint32_t id = ((uint32_t)(book + 1) << 16) | ((uint32_t)ch << 8) | v;
+    id = versify_from_canon(
+        (VersifyScheme)API_TRANSLATIONS[app->api_trans_sel].versify, id);
+    snprintf(out, out_sz, "%s %u:%u", bible_book_name(book),
+        (unsigned)((id >> 8) & 0xFF), (unsigned)(id & 0xFF));
+}
+
+// Fetch the verse after the picker's into the cache alongside the one
+// on screen, so Right is answered without a round trip. One prefetch at
+// a time leaves a slot for the queue replay.
+static void api_prefetch_next(App* app) {
+    if(!app->fhttp || !app->wifi_connected || api_slot_find(app, ApiUsePrefetch)) return;
+    uint8_t book = app->api_book_sel, ch = app->api_chapter_sel, v = app->api_verse_sel;
+    api_pick_next(&book, &ch, &v);
+    const char* trans = API_TRANSLATIONS[app->api_trans_sel].code;
+    char query[LOOKUP_QUERY_LEN], ref[2], text[2];
+    api_pick_query(app, book, ch, v, query, sizeof(query));
+    if(api_slot_for(app, trans, query) ||
+       lookup_cache_get(&app->lookups, trans, query, ref, sizeof(ref), text, sizeof(text)))
+        return;
+    api_submit(app, ApiUsePrefetch, trans, query);
+}
+
 static void api_fetch_quick(App* app) {
-    snprintf(app->api_query, sizeof(app->api_query), "%s %u:%u",
-        BIBLE_BOOKS[app->api_book_sel].name,
-        (unsigned)app->api_chapter_sel,
-        (unsigned)app->api_verse_sel);
+    api_pick_query(app, app->api_book_sel, app->api_chapter_sel, app->api_verse_sel,
+        app->api_query, sizeof(app->api_query));
     app->api_query_len = (uint8_t)strlen(app->api_query);
     api_fetch(app);
+    api_prefetch_next(app);
 }
 
 static bool api_query_string(App* app, const char* cmd, char* out, size_t out_sz) {
-    if(!app->wifi_connected) return false;
+    // Untagged replies would interleave with tagged responses
+    if(!app->wifi_connected || flipper_http_pending_count(app->fhttp)) return false;
     if(!flipper_http_send_data(app->fhttp, cmd)) return false;
     for(uint8_t i = 0; i < 20; i++) {
         furi_delay_ms(50);
@@ -1133,7 +2665,8 @@ static void draw_error(Canvas* canvas, App* app) {
 static void draw_main_menu(Canvas* canvas, App* app) {
     static const char* items[] = {
         "Browse Verses", "Search Verses", "Random Verse",
-        "Verse of the Day", "Bookmarks", "Bible API (FlipperHTTP)", "Settings", "About",
+        "Verse of the Day", "Bookmarks", "Review (memorize)", "Bible API (FlipperHTTP)",
+        "Settings", "About",
     };
     canvas_set_color(canvas, ColorBlack);
     canvas_draw_box(canvas, 0, 0, SCREEN_W, HDR_H);
@@ -1151,28 +2684,86 @@ static void draw_main_menu(Canvas* canvas, App* app) {
     draw_scrollbar(canvas, app->menu_scroll, MenuItemCount, 5);
 }
 
+// Rows that start a new section get a rule above them, and the header
+// names the selected verse's section. One heading search per frame, for
+// the row above the viewport; the rows below only advance from it.
 static void draw_browse(Canvas* canvas, App* app) {
-    draw_hdr(canvas, "All Verses");
+    const HeadingTable* h = &app->headings;
+    uint16_t first = app->browse_scroll, pos = 0;
+    int16_t prev = -1, sel_sec = -1;
+    if(h->count && first > 0) {
+        uint32_t id = verse_canon_id(app, first - 1);
+        pos  = heading_upper(h, id);
+        prev = heading_at(h, pos, id);
+    }
     canvas_set_font(canvas, FontSecondary);
     for(uint8_t i = 0; i < VISIBLE_LINES && (app->browse_scroll+i) < app->verse_count; i++) {
         uint16_t vi = app->browse_scroll + i;
-        draw_list_item(canvas, BODY_Y + i * LINE_H,
-            app->index[vi].ref, vi == app->browse_sel);
+        uint8_t  y  = BODY_Y + i * LINE_H;
+        draw_list_item(canvas, y, app->index[vi].ref, vi == app->browse_sel);
+        if(!h->count) continue;
+        uint32_t id  = verse_canon_id(app, vi);
+        pos = heading_advance(h, pos, id);
+        int16_t  sec = heading_at(h, pos, id);
+        if(sec >= 0 && sec != prev) canvas_draw_line(canvas, 0, y, SB_X - 2, y);
+        if(vi == app->browse_sel) sel_sec = sec;
+        prev = sec;
     }
+    draw_hdr(canvas, sel_sec >= 0 ? heading_text(h, sel_sec) : "All Verses");
     draw_scrollbar(canvas, app->browse_scroll, app->verse_count, VISIBLE_LINES);
     char cnt[16];
     snprintf(cnt, sizeof(cnt), "%u/%u", app->browse_sel + 1, app->verse_count);
     canvas_draw_str_aligned(canvas, SCREEN_W - 4, SCREEN_H - 1, AlignRight, AlignBottom, cnt);
 }
 
+// Draw the visible wrapped lines, inverting any highlighted runs.
+// The verse font must already be applied.
+static void draw_wrap_lines(Canvas* canvas, const WrapState* w, FontChoice f,
+                            uint8_t y0, uint8_t vis) {
+    uint8_t lh = FONT_LINE_H[f];
+    for(uint8_t i = 0; i < vis && (w->scroll + i) < w->count; i++) {
+        uint8_t li = w->scroll + i;
+        uint8_t y  = y0 + i * lh;
+        const char* line = w->src + w->start[li];
+        verse_draw_str(canvas, f, 2, y + lh - 1, line, w->len[li]);
+        for(uint8_t r = 0; r < w->run_count; r++) {
+            const WrapRun* run = &w->runs[r];
+            if(run->line != li) continue;
+            uint8_t x  = 2 + (uint8_t)verse_str_width(canvas, f, line, run->col);
+            uint8_t sw = (uint8_t)verse_str_width(canvas, f, line + run->col, run->len);
+            if(run->style == WrapRunUnderline) {
+                canvas_draw_line(canvas, x, y + lh, x + sw - 1, y + lh);
+                continue;
+            }
+            if(run->style == WrapRunFrame) {
+                canvas_draw_frame(canvas, x - 1, y, sw + 2, lh + 1);
+                continue;
+            }
+            if(run->style == WrapRunDotted) {
+                for(uint8_t dx = 0; dx < sw; dx += 2) canvas_draw_dot(canvas, x + dx, y + lh);
+                continue;
+            }
+            canvas_set_color(canvas, ColorBlack);
+            canvas_draw_box(canvas, x - 1, y, sw + 1, lh);
+            canvas_set_color(canvas, ColorWhite);
+            verse_draw_str(canvas, f, x, y + lh - 1, line + run->col, run->len);
+            canvas_set_color(canvas, ColorBlack);
+        }
+    }
+}
+
 static void draw_verse_read(Canvas* canvas, App* app) {
     draw_hdr(canvas, app->cur_ref);
+    uint8_t y0 = BODY_Y;
+    if(app->cur_heading >= 0) {
+        canvas_set_font(canvas, FontSecondary);
+        canvas_draw_str(canvas, 2, BODY_Y + 7, heading_text(&app->headings, app->cur_heading));
+        canvas_draw_line(canvas, 0, BODY_Y + 9, SB_X - 2, BODY_Y + 9);
+        y0 += LINE_H;
+    }
     apply_verse_font(canvas, app->font_choice);
-    uint8_t lh  = FONT_LINE_H[app->font_choice];
-    uint8_t vis = font_visible_lines(app->font_choice);
-    for(uint8_t i = 0; i < vis && (app->wrap.scroll + i) < app->wrap.count; i++)
-        canvas_draw_str(canvas, 2, BODY_Y + i * lh + lh - 1,
-            app->wrap.lines[app->wrap.scroll + i]);
+    uint8_t vis = reader_lines(app);
+    draw_wrap_lines(canvas, &app->wrap, app->font_choice, y0, vis);
     draw_scrollbar(canvas, app->wrap.scroll, app->wrap.count, vis);
     if(app->cur_verse >= 0 && is_bookmarked(app, (uint16_t)app->cur_verse)) {
         canvas_set_font(canvas, FontSecondary);
@@ -1180,16 +2771,23 @@ static void draw_verse_read(Canvas* canvas, App* app) {
     }
 }
 
+static void draw_verse_menu(Canvas* canvas, App* app) {
+    draw_hdr(canvas, app->cur_ref);
+    canvas_set_font(canvas, FontSecondary);
+    uint8_t items[VerseActCount];
+    uint8_t n = verse_menu_items(app, items);
+    for(uint8_t i = 0; i < n; i++)
+        draw_list_item(canvas, BODY_Y + i * LINE_H, VERSE_ACT_LABELS[items[i]],
+                       i == app->verse_menu_sel);
+}
+
 static void draw_single_verse(Canvas* canvas, App* app, const char* title) {
     if(app->cur_verse < 0) return;
     draw_hdr(canvas, title);
     apply_verse_font(canvas, app->font_choice);
-    uint8_t lh  = FONT_LINE_H[app->font_choice];
     uint8_t vis = font_visible_lines(app->font_choice);
     if(vis > 1) vis--;
-    for(uint8_t i = 0; i < vis && (app->wrap.scroll + i) < app->wrap.count; i++)
-        canvas_draw_str(canvas, 2, BODY_Y + i * lh + lh - 1,
-            app->wrap.lines[app->wrap.scroll + i]);
+    draw_wrap_lines(canvas, &app->wrap, app->font_choice, BODY_Y, vis);
     canvas_set_font(canvas, FontSecondary);
     char ref[REF_LEN + 4];
     snprintf(ref, sizeof(ref), "- %s", app->cur_ref);
@@ -1197,7 +2795,8 @@ static void draw_single_verse(Canvas* canvas, App* app, const char* title) {
 }
 
 static void draw_bookmarks(Canvas* canvas, App* app) {
-    draw_hdr(canvas, "Bookmarks");
+    static const char* const notes[] = { "Bookmarks", "Added to review", "Already in review" };
+    draw_hdr(canvas, notes[app->review.bm_note]);
     if(!app->bmarks.count) {
         canvas_set_font(canvas, FontSecondary);
         canvas_draw_str_aligned(canvas, SCREEN_W/2, 28, AlignCenter, AlignCenter, "No bookmarks yet");
@@ -1216,61 +2815,194 @@ static void draw_bookmarks(Canvas* canvas, App* app) {
     draw_scrollbar(canvas, scroll, app->bmarks.count, vis);
 }
 
+static void draw_review(Canvas* canvas, App* app) {
+    const ReviewState* r = &app->review;
+    char line[40];
+    if(!r->showing) {
+        draw_hdr(canvas, "Review");
+        canvas_set_font(canvas, FontSecondary);
+        uint32_t today = review_today();
+        snprintf(line, sizeof(line), "Cards: %u   Due today: %u",
+            r->deck ? srs_count(r->deck) : 0, r->deck ? srs_due_count(r->deck, today) : 0);
+        canvas_draw_str(canvas, 2, BODY_Y + 8, line);
+        if(r->added >= 0)
+            snprintf(line, sizeof(line), "Added %d bookmark(s)", r->added);
+        else
+            snprintf(line, sizeof(line), "Reviewed: %u", r->reviewed);
+        canvas_draw_str(canvas, 2, BODY_Y + 20, line);
+        canvas_draw_str(canvas, 2, BODY_Y + 36, "OK: review due cards");
+        canvas_draw_str(canvas, 2, BODY_Y + 46, "Hold OK: add bookmarks");
+        return;
+    }
+    if(r->verse >= 0) {
+        draw_hdr(canvas, app->index[r->verse].ref);
+    } else {
+        snprintf(line, sizeof(line), "%s %lu:%lu",
+            bible_book_name((uint8_t)((r->card.id >> 16) - 1)),
+            (unsigned long)((r->card.id >> 8) & 0xFF), (unsigned long)(r->card.id & 0xFF));
+        draw_hdr(canvas, line);
+    }
+    canvas_set_font(canvas, FontSecondary);
+    if(!r->revealed) {
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, 34, AlignCenter, AlignCenter,
+            "Recite it, then OK");
+        return;
+    }
+    if(r->verse < 0) {
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, 30, AlignCenter, AlignCenter,
+            "Not in this version");
+    } else {
+        apply_verse_font(canvas, app->font_choice);
+        uint8_t vis = font_visible_lines(app->font_choice) - 1;
+        draw_wrap_lines(canvas, &app->wrap, app->font_choice, BODY_Y, vis);
+        draw_scrollbar(canvas, app->wrap.scroll, app->wrap.count, vis);
+        canvas_set_font(canvas, FontSecondary);
+    }
+    canvas_set_color(canvas, ColorWhite);
+    canvas_draw_box(canvas, 0, SCREEN_H - 9, SCREEN_W, 9);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_draw_line(canvas, 0, SCREEN_H - 10, SCREEN_W, SCREEN_H - 10);
+    canvas_draw_str_aligned(canvas, SCREEN_W/2, SCREEN_H, AlignCenter, AlignBottom,
+        "<Again  OK Good  >Easy");
+}
+
+static void draw_similar(Canvas* canvas, App* app) {
+    const SimilarList* sl = &app->similar;
+    draw_hdr(canvas, "Similar Verses");
+    canvas_set_font(canvas, FontSecondary);
+    if(!sl->count) {
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, 30, AlignCenter, AlignCenter,
+            app->lsh_count ? "No similar verses" : "No similarity index");
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, 44, AlignCenter, AlignCenter,
+            app->index[sl->src].ref);
+        return;
+    }
+    uint8_t vis = VISIBLE_LINES;
+    uint8_t scroll = (sl->sel >= vis) ? sl->sel - vis + 1 : 0;
+    for(uint8_t i = 0; i < vis && (scroll + i) < sl->count; i++) {
+        uint8_t si = scroll + i;
+        char item[REF_LEN + 8];
+        snprintf(item, sizeof(item), "%s  %u/%u",
+            app->index[sl->idx[si]].ref, sl->shared[si], MINHASH_BANDS);
+        draw_list_item(canvas, BODY_Y + i * LINE_H, item, si == sl->sel);
+    }
+    draw_scrollbar(canvas, scroll, sl->count, vis);
+}
+
+static void draw_compare(Canvas* canvas, App* app) {
+    const CompareState* c = &app->compare;
+    uint8_t shown = c->show_other ? c->other : app->vfile_sel;
+    draw_hdr(canvas, app->vfiles[shown].label);
+    if(!c->found) {
+        canvas_set_font(canvas, FontSecondary);
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, 30, AlignCenter, AlignCenter,
+            "Not indexed yet");
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, 44, AlignCenter, AlignCenter,
+            "Open that version once");
+        return;
+    }
+    apply_verse_font(canvas, app->font_choice);
+    uint8_t vis = font_visible_lines(app->font_choice);
+    draw_wrap_lines(canvas, &c->wrap, app->font_choice, BODY_Y, vis);
+    draw_scrollbar(canvas, c->wrap.scroll, c->wrap.count, vis);
+}
+
+static void draw_note(Canvas* canvas, App* app) {
+    const NoteState* ns = &app->note;
+    char hdr[REF_LEN + 12];
+    snprintf(hdr, sizeof(hdr), "%s  note %c", app->cur_ref, note_marker(app, ns->sel));
+    draw_hdr(canvas, hdr);
+    if(!ns->found) {
+        canvas_set_font(canvas, FontSecondary);
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, 36, AlignCenter, AlignCenter,
+            "Note not found");
+        return;
+    }
+    apply_verse_font(canvas, app->font_choice);
+    uint8_t vis = font_visible_lines(app->font_choice);
+    draw_wrap_lines(canvas, &ns->wrap, app->font_choice, BODY_Y, vis);
+    draw_scrollbar(canvas, ns->wrap.scroll, ns->wrap.count, vis);
+}
+
+static const char* settings_item_label(App* app, uint8_t sec, uint8_t i) {
+    switch(sec) {
+    case 0:  return app->vfiles[i].label;
+    case 1:  return FONT_LABELS[i];
+    default: return SEARCH_MODE_LABELS[i];
+    }
+}
+
 static void draw_settings(Canvas* canvas, App* app) {
+    static const char* const sec_titles[SETTINGS_SECTIONS] = {
+        "Bible Version  [Right=Font]",
+        "Font Size  [Hold OK=Bench]",
+        "Search Mode  [Left=Font]",
+    };
     draw_hdr(canvas, "Settings");
     canvas_set_font(canvas, FontSecondary);
     const uint8_t SEC_LABEL_Y = BODY_Y + 7;
     const uint8_t ITEM_Y0     = SEC_LABEL_Y + 9;
+    uint8_t sec = app->settings_sec;
 
-    if(app->settings_sec == 0) {
-        canvas_set_color(canvas, ColorBlack);
-        canvas_draw_box(canvas, 0, BODY_Y, SCREEN_W, 9);
-        canvas_set_color(canvas, ColorWhite);
-        canvas_draw_str_aligned(canvas, SCREEN_W/2, SEC_LABEL_Y,
-            AlignCenter, AlignBottom, "Bible Version  [Right=Font]");
-        canvas_set_color(canvas, ColorBlack);
-        uint8_t vis = 4;
-        uint8_t scroll = (app->settings_sel >= vis) ? app->settings_sel - vis + 1 : 0;
-        for(uint8_t i = 0; i < vis && (scroll + i) < app->vfile_count; i++) {
-            uint8_t si = scroll + i;
-            uint8_t y  = ITEM_Y0 + i * LINE_H;
-            bool sel    = (app->settings_sel == si);
-            bool active = (app->vfile_sel == si);
-            if(sel) {
-                canvas_set_color(canvas, ColorBlack);
-                canvas_draw_box(canvas, 2, y - 1, SCREEN_W - 4, LINE_H);
-                canvas_set_color(canvas, ColorWhite);
-            }
-            canvas_draw_str(canvas, 5,  y + 7, active ? ">" : " ");
-            canvas_draw_str(canvas, 13, y + 7, app->vfiles[si].label);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_draw_box(canvas, 0, BODY_Y, SCREEN_W, 9);
+    canvas_set_color(canvas, ColorWhite);
+    canvas_draw_str_aligned(canvas, SCREEN_W/2, SEC_LABEL_Y,
+        AlignCenter, AlignBottom, sec_titles[sec]);
+    canvas_set_color(canvas, ColorBlack);
+
+    uint8_t total  = settings_item_count(app, sec);
+    uint8_t active = settings_active_item(app, sec);
+    uint8_t vis = 4;
+    uint8_t scroll = (app->settings_sel >= vis) ? app->settings_sel - vis + 1 : 0;
+    for(uint8_t i = 0; i < vis && (scroll + i) < total; i++) {
+        uint8_t si = scroll + i;
+        uint8_t y  = ITEM_Y0 + i * LINE_H;
+        if(app->settings_sel == si) {
             canvas_set_color(canvas, ColorBlack);
+            canvas_draw_box(canvas, 2, y - 1, SCREEN_W - 4, LINE_H);
+            canvas_set_color(canvas, ColorWhite);
         }
-        draw_scrollbar(canvas, scroll, app->vfile_count, vis);
-    } else {
-        canvas_set_color(canvas, ColorBlack);
-        canvas_draw_box(canvas, 0, BODY_Y, SCREEN_W, 9);
-        canvas_set_color(canvas, ColorWhite);
-        canvas_draw_str_aligned(canvas, SCREEN_W/2, SEC_LABEL_Y,
-            AlignCenter, AlignBottom, "Font Size  [Left=Version]");
+        canvas_draw_str(canvas, 5,  y + 7, (active == si) ? ">" : " ");
+        canvas_draw_str(canvas, 13, y + 7, settings_item_label(app, sec, si));
         canvas_set_color(canvas, ColorBlack);
-        uint8_t vis = 4;
-        uint8_t scroll = (app->settings_sel >= vis) ? app->settings_sel - vis + 1 : 0;
-        for(uint8_t i = 0; i < vis && (scroll + i) < FONT_COUNT; i++) {
-            uint8_t si = scroll + i;
-            uint8_t y  = ITEM_Y0 + i * LINE_H;
-            bool sel    = (app->settings_sel == si);
-            bool active = ((uint8_t)app->font_choice == si);
-            if(sel) {
-                canvas_set_color(canvas, ColorBlack);
-                canvas_draw_box(canvas, 2, y - 1, SCREEN_W - 4, LINE_H);
-                canvas_set_color(canvas, ColorWhite);
-            }
-            canvas_draw_str(canvas, 5,  y + 7, active ? ">" : " ");
-            canvas_draw_str(canvas, 13, y + 7, FONT_LABELS[si]);
-            canvas_set_color(canvas, ColorBlack);
-        }
-        draw_scrollbar(canvas, scroll, FONT_COUNT, vis);
     }
+    draw_scrollbar(canvas, scroll, total, vis);
+}
+
+static void draw_font_bench(Canvas* canvas, App* app) {
+    static const char* const names[FONT_COUNT] = { "Built-in", "4x6", "5x8", "6x10", "9x15" };
+    draw_hdr(canvas, "Font Draw (us/frame)");
+    canvas_set_font(canvas, FontSecondary);
+    canvas_draw_str(canvas, 72,  BODY_Y + 7, "str");
+    canvas_draw_str(canvas, 100, BODY_Y + 7, "cache");
+    for(uint8_t f = 0; f < FONT_COUNT; f++) {
+        uint8_t y = BODY_Y + 16 + f * 8;
+        char col[8];
+        canvas_draw_str(canvas, 2, y, names[f]);
+        snprintf(col, sizeof(col), "%u", app->font_bench_us[f][0]);
+        canvas_draw_str(canvas, 72, y, col);
+        if(f == FONT_SECONDARY) snprintf(col, sizeof(col), "-");
+        else snprintf(col, sizeof(col), "%u", app->font_bench_us[f][1]);
+        canvas_draw_str(canvas, 100, y, col);
+    }
+}
+
+static void draw_bench(Canvas* canvas, App* app) {
+    draw_hdr(canvas, app->bench_saved ? "Benchmark (us)" : "Benchmark: not saved");
+    canvas_set_font(canvas, FontSecondary);
+    const uint8_t vis = VISIBLE_LINES;
+    for(uint8_t i = 0; i < vis && app->bench_scroll + i < BENCH_CASE_COUNT; i++) {
+        uint8_t ci = app->bench_scroll + i;
+        uint8_t y  = BODY_Y + 8 + i * LINE_H;
+        const BenchResult* r = &app->bench[ci];
+        char col[12];
+        if(!r->ok || !bench_fmt_us(col, sizeof(col), bench_mean_ns(r)))
+            snprintf(col, sizeof(col), "fail");
+        canvas_draw_str(canvas, 2, y, BENCH_CASES[ci].name);
+        canvas_draw_str_aligned(canvas, SCREEN_W - SB_W - 4, y, AlignRight, AlignBottom, col);
+    }
+    draw_scrollbar(canvas, app->bench_scroll, BENCH_CASE_COUNT, vis);
 }
 
 static void draw_about(Canvas* canvas, App* app) {
@@ -1287,7 +3019,10 @@ static void draw_about(Canvas* canvas, App* app) {
         "Bookmarks (hold OK)",
         "5 font sizes",
         "─────────────────────",
-        "ONLINE (bible-api.com)",
+        "ONLINE",
+        "bible-api.com + mirror",
+        "  (api_mirror.txt)",
+        "  fastest one first",
         "No login or key needed",
         "Keyboard lookup",
         "  Hold OK: accept",
@@ -1352,7 +3087,7 @@ static void draw_api_menu(Canvas* canvas, App* app) {
         char label[28];
         switch(idx) {
         case 0: strncpy(label, "Lookup Verse", sizeof(label)-1); label[sizeof(label)-1]='\0'; break;
-        case 1: snprintf(label, sizeof(label), "Book: %s", BIBLE_BOOKS[app->api_book_sel].name); break;
+        case 1: snprintf(label, sizeof(label), "Book: %s", bible_book_name(app->api_book_sel)); break;
         case 2: snprintf(label, sizeof(label), "Chapter: %u", (unsigned)app->api_chapter_sel); break;
         case 3: snprintf(label, sizeof(label), "Verse: %u",   (unsigned)app->api_verse_sel);   break;
         case 4: snprintf(label, sizeof(label), "Trans: %s",   API_TRANSLATIONS[app->api_trans_sel].label); break;
@@ -1394,11 +3129,8 @@ static void draw_api_result(Canvas* canvas, App* app) {
     canvas_draw_str_aligned(canvas, SCREEN_W - 2, 1, AlignRight, AlignTop, ">");
     canvas_set_color(canvas, ColorBlack);
     apply_verse_font(canvas, app->font_choice);
-    uint8_t lh  = FONT_LINE_H[app->font_choice];
     uint8_t vis = font_visible_lines(app->font_choice);
-    for(uint8_t i = 0; i < vis && (app->api_wrap.scroll+i) < app->api_wrap.count; i++)
-        canvas_draw_str(canvas, 2, BODY_Y + i * lh + lh - 1,
-            app->api_wrap.lines[app->api_wrap.scroll + i]);
+    draw_wrap_lines(canvas, &app->api_wrap, app->font_choice, BODY_Y, vis);
     draw_scrollbar(canvas, app->api_wrap.scroll, app->api_wrap.count, vis);
     canvas_set_font(canvas, FontSecondary);
     const char* trans_str = API_TRANSLATIONS[app->api_trans_sel].code;
@@ -1416,6 +3148,12 @@ static void draw_api_error(Canvas* canvas, App* app) {
     draw_hdr(canvas, "API Error");
     canvas_set_font(canvas, FontSecondary);
     canvas_draw_str_aligned(canvas, SCREEN_W/2, 24, AlignCenter, AlignCenter, app->api_result_ref);
+    if(app->api_queued) {
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, 38, AlignCenter, AlignCenter, "Lookup queued; it is");
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, 50, AlignCenter, AlignCenter, "fetched when online");
+        canvas_draw_str_aligned(canvas, SCREEN_W/2, SCREEN_H-1, AlignCenter, AlignBottom, "Back to return");
+        return;
+    }
     canvas_draw_str_aligned(canvas, SCREEN_W/2, 38, AlignCenter, AlignCenter, "Check WiFi board");
     canvas_draw_str_aligned(canvas, SCREEN_W/2, 50, AlignCenter, AlignCenter, "& connection");
     canvas_draw_str_aligned(canvas, SCREEN_W/2, SCREEN_H-1, AlignCenter, AlignBottom, "Back to return");
@@ -1479,8 +3217,13 @@ static void draw_cb(Canvas* canvas, void* ctx) {
     case ViewMainMenu:      draw_main_menu(canvas, app);                          break;
     case ViewBrowseList:    draw_browse(canvas, app);                             break;
     case ViewVerseRead:     draw_verse_read(canvas, app);                         break;
+    case ViewVerseMenu:     draw_verse_menu(canvas, app);                         break;
     case ViewSearchInput:   draw_search_input(canvas, app);                       break;  // keyboard.c
     case ViewSearchResults: draw_search_results(canvas, app);                     break;  // keyboard.c
+    case ViewSimilar:       draw_similar(canvas, app);                            break;
+    case ViewReview:        draw_review(canvas, app);                             break;
+    case ViewCompare:       draw_compare(canvas, app);                            break;
+    case ViewNote:          draw_note(canvas, app);                               break;
     case ViewRandomVerse:   draw_single_verse(canvas, app, "Random Verse");       break;
     case ViewDailyVerse:    draw_single_verse(canvas, app, "Verse of the Day");   break;
     case ViewBookmarks:     draw_bookmarks(canvas, app);                          break;
@@ -1494,6 +3237,8 @@ static void draw_cb(Canvas* canvas, void* ctx) {
     case ViewApiError:      draw_api_error(canvas, app);                          break;
     case ViewApiTrans:      draw_api_trans(canvas, app);                          break;
     case ViewApiStatus:     draw_api_status(canvas, app);                         break;
+    case ViewFontBench:     draw_font_bench(canvas, app);                         break;
+    case ViewBench:         draw_bench(canvas, app);                              break;
     }
 }
 
@@ -1502,7 +3247,10 @@ static void draw_cb(Canvas* canvas, void* ctx) {
 // ============================================================
 
 static void input_cb(InputEvent* ev, void* ctx) {
-    furi_message_queue_put(((App*)ctx)->queue, ev, FuriWaitForever);
+    App* app = ctx;
+    idle_kick(&app->idle);
+    AppEvent aev = { .type = AppEventInput, .input = *ev };
+    furi_message_queue_put(app->queue, &aev, FuriWaitForever);
 }
 
 static void on_main_menu(App* app, InputEvent* ev) {
@@ -1550,6 +3298,12 @@ static void on_main_menu(App* app, InputEvent* ev) {
         }
         case MenuBookmarks:
             app->bmarks.sel = 0; app->view = ViewBookmarks; break;
+        case MenuReview:
+            app->review.showing  = false;
+            app->review.reviewed = 0;
+            app->review.added    = -1;
+            review_deck(app);
+            app->view = ViewReview; break;
         case MenuSettings:
             app->settings_sec = 0;
             app->settings_sel = app->vfile_sel;
@@ -1567,6 +3321,7 @@ static void on_main_menu(App* app, InputEvent* ev) {
             app->api_status_ssid[0] = '\0';
             app->api_status_ip[0]   = '\0';
             if(app->wifi_connected) {
+                idle_rearm(&app->idle, app->idle_drain);
                 app->fhttp->last_response[0] = '\0';
                 api_query_string(app, "[WIFI/SSID]",
                     app->api_status_ssid, sizeof(app->api_status_ssid));
@@ -1620,7 +3375,7 @@ static void on_verse_read(App* app, InputEvent* ev) {
         case InputKeyUp:
             if(app->wrap.scroll > 0) { app->wrap.scroll--; } break;
         case InputKeyDown:
-            if(app->wrap.scroll + font_visible_lines(app->font_choice) < app->wrap.count) {
+            if(app->wrap.scroll + reader_lines(app) < app->wrap.count) {
                 app->wrap.scroll++;
             } break;
         case InputKeyLeft:
@@ -1631,6 +3386,12 @@ static void on_verse_read(App* app, InputEvent* ev) {
             if((uint16_t)(app->cur_verse + 1) < app->verse_count)
                 open_verse(app, (uint16_t)(app->cur_verse + 1), app->return_view);
             break;
+        case InputKeyOk:
+            if(ev->type == InputTypeShort && app->cur_verse >= 0) {
+                app->verse_menu_sel = 0;
+                app->view = ViewVerseMenu;
+            }
+            break;
         case InputKeyBack: app->view = app->return_view; break;
         default: break;
         }
@@ -1639,6 +3400,96 @@ static void on_verse_read(App* app, InputEvent* ev) {
         toggle_bmark(app, (uint16_t)app->cur_verse);
 }
 
+// Up/Down scroll, Left/Right step through the verse's notes. Left/Right
+// ignore repeats, so a held key steps one note only.
+static void on_note(App* app, InputEvent* ev) {
+    NoteState* ns = &app->note;
+    if(ev->type != InputTypeShort && ev->type != InputTypeRepeat) return;
+    switch(ev->key) {
+    case InputKeyUp:
+        if(ns->wrap.scroll > 0) { ns->wrap.scroll--; } break;
+    case InputKeyDown:
+        if(ns->wrap.scroll + font_visible_lines(app->font_choice) < ns->wrap.count) {
+            ns->wrap.scroll++;
+        } break;
+    case InputKeyLeft:
+    case InputKeyRight:
+        if(ev->type == InputTypeShort) {
+            int16_t k = note_next(app, ns->sel, ev->key == InputKeyRight ? 1 : -1);
+            if(k >= 0) note_show(app, (uint8_t)k);
+        } break;
+    case InputKeyBack:
+        app->view = ViewVerseRead; break;
+    default: break;
+    }
+}
+
+static void on_verse_menu(App* app, InputEvent* ev) {
+    if(ev->type != InputTypeShort && ev->type != InputTypeRepeat) return;
+    uint8_t items[VerseActCount];
+    uint8_t n = verse_menu_items(app, items);
+    switch(ev->key) {
+    case InputKeyUp:
+        if(app->verse_menu_sel > 0) { app->verse_menu_sel--; } break;
+    case InputKeyDown:
+        if(app->verse_menu_sel + 1 < n) { app->verse_menu_sel++; } break;
+    case InputKeyOk:
+        if(ev->type == InputTypeShort && app->verse_menu_sel < n)
+            verse_menu_run(app, (VerseAction)items[app->verse_menu_sel]);
+        break;
+    case InputKeyBack:
+        app->view = ViewVerseRead; break;
+    default: break;
+    }
+}
+
+// Up/Down scroll, OK flips sides, Left/Right pick the other translation.
+// Left/Right ignore repeats, so a held key steps one translation only.
+static void on_compare(App* app, InputEvent* ev) {
+    CompareState* c = &app->compare;
+    if(ev->type != InputTypeShort && ev->type != InputTypeRepeat) return;
+    switch(ev->key) {
+    case InputKeyUp:
+        if(c->wrap.scroll > 0) { c->wrap.scroll--; } break;
+    case InputKeyDown:
+        if(c->wrap.scroll + font_visible_lines(app->font_choice) < c->wrap.count) {
+            c->wrap.scroll++;
+        } break;
+    case InputKeyOk:
+        if(ev->type == InputTypeShort && c->found) {
+            c->show_other = !c->show_other;
+            compare_show(app);
+        } break;
+    case InputKeyLeft:
+    case InputKeyRight:
+        if(ev->type == InputTypeShort && app->vfile_count > 2)
+            compare_open(app, compare_next_file(app, c->other,
+                ev->key == InputKeyRight ? 1 : -1));
+        break;
+    case InputKeyBack:
+        app->view = ViewVerseRead; break;
+    default: break;
+    }
+}
+
+static void on_similar(App* app, InputEvent* ev) {
+    if(ev->type != InputTypeShort && ev->type != InputTypeRepeat) return;
+    SimilarList* sl = &app->similar;
+    switch(ev->key) {
+    case InputKeyUp:
+        if(sl->sel > 0) { sl->sel--; } break;
+    case InputKeyDown:
+        if(sl->count && sl->sel < sl->count - 1) { sl->sel++; } break;
+    case InputKeyOk:
+        if(sl->count) open_verse(app, sl->idx[sl->sel], ViewSimilar);
+        break;
+    case InputKeyBack:
+        open_verse(app, sl->src, sl->src_ret);
+        break;
+    default: break;
+    }
+}
+
 static void on_random_daily(App* app, InputEvent* ev, bool is_random) {
     if(ev->type == InputTypeShort || ev->type == InputTypeRepeat) {
         switch(ev->key) {
@@ -1663,6 +3514,12 @@ static void on_random_daily(App* app, InputEvent* ev, bool is_random) {
 }
 
 static void on_bookmarks(App* app, InputEvent* ev) {
+    if(ev->type == InputTypePress) app->review.bm_note = 0;
+    if(ev->type == InputTypeLong && ev->key == InputKeyOk && app->bmarks.count) {
+        uint16_t vi = app->bmarks.idx[app->bmarks.sel];
+        app->review.bm_note = review_add(app, vi) ? 1 : 2;
+        return;
+    }
     if(ev->type != InputTypeShort && ev->type != InputTypeRepeat) return;
     switch(ev->key) {
     case InputKeyUp:
@@ -1680,27 +3537,74 @@ static void on_bookmarks(App* app, InputEvent* ev) {
     }
 }
 
+// Summary: OK starts, hold OK imports bookmarks. Card: OK reveals, then
+// Left = again, OK = good, hold OK = hard, Right = easy; Up/Down scroll.
+static void on_review(App* app, InputEvent* ev) {
+    ReviewState* r = &app->review;
+    if(!r->showing) {
+        if(ev->type == InputTypeLong && ev->key == InputKeyOk) {
+            review_import_bookmarks(app);
+        } else if(ev->type == InputTypeShort && ev->key == InputKeyOk) {
+            r->added = -1;
+            review_next(app);
+        } else if(ev->type == InputTypeShort && ev->key == InputKeyBack) {
+            app->view = ViewMainMenu;
+        }
+        return;
+    }
+    if(ev->type == InputTypeLong && ev->key == InputKeyOk && r->revealed) {
+        review_grade(app, 3);
+        return;
+    }
+    if(ev->type != InputTypeShort && ev->type != InputTypeRepeat) return;
+    switch(ev->key) {
+    case InputKeyUp:
+        if(app->wrap.scroll > 0) { app->wrap.scroll--; } break;
+    case InputKeyDown:
+        if(app->wrap.scroll + font_visible_lines(app->font_choice) - 1 < app->wrap.count) {
+            app->wrap.scroll++;
+        } break;
+    case InputKeyOk:
+        if(ev->type != InputTypeShort) break;
+        if(!r->revealed) r->revealed = true;
+        else review_grade(app, 4);
+        break;
+    case InputKeyLeft:
+        if(ev->type == InputTypeShort && r->revealed) review_grade(app, 1);
+        break;
+    case InputKeyRight:
+        if(ev->type == InputTypeShort && r->revealed) review_grade(app, 5);
+        break;
+    case InputKeyBack:
+        r->showing = false; break;
+    default: break;
+    }
+}
+
 static void on_settings(App* app, InputEvent* ev) {
+    if(ev->type == InputTypeLong && ev->key == InputKeyOk && app->settings_sec == 1) {
+        font_bench_run(app);
+        app->view = ViewFontBench;
+        return;
+    }
     if(ev->type != InputTypeShort && ev->type != InputTypeRepeat) return;
     switch(ev->key) {
     case InputKeyLeft:
-        if(app->settings_sec != 0) {
-            app->settings_sec = 0;
-            app->settings_sel = app->vfile_sel;
+        if(app->settings_sec > 0) {
+            app->settings_sec--;
+            app->settings_sel = settings_active_item(app, app->settings_sec);
         } break;
     case InputKeyRight:
-        if(app->settings_sec != 1) {
-            app->settings_sec = 1;
-            app->settings_sel = (uint8_t)app->font_choice;
+        if(app->settings_sec < SETTINGS_SECTIONS - 1) {
+            app->settings_sec++;
+            app->settings_sel = settings_active_item(app, app->settings_sec);
         } break;
     case InputKeyUp:
         if(app->settings_sel > 0) { app->settings_sel--; } break;
     case InputKeyDown:
-        if(app->settings_sec == 0) {
-            if(app->settings_sel < app->vfile_count - 1) app->settings_sel++;
-        } else {
-            if(app->settings_sel < FONT_COUNT - 1) app->settings_sel++;
-        } break;
+        if(app->settings_sel + 1 < settings_item_count(app, app->settings_sec))
+            app->settings_sel++;
+        break;
     case InputKeyOk:
         if(app->settings_sec == 0) {
             if(app->settings_sel != app->vfile_sel) {
@@ -1721,14 +3625,19 @@ static void on_settings(App* app, InputEvent* ev) {
                     app->view = ViewSettings;
                 }
             }
+        } else if(app->settings_sec == 2) {
+            if(app->settings_sel != (uint8_t)app->search_mode) {
+                app->search_mode = (SearchMode)app->settings_sel;
+                settings_save(app);
+            }
         } else {
             FontChoice chosen = (FontChoice)app->settings_sel;
             if(chosen != app->font_choice) {
                 app->font_choice = chosen;
-                if(app->cur_verse >= 0) {
-                    char text[LINE_BUF_LEN];
-                    if(read_verse_text(app, (uint16_t)app->cur_verse, text, sizeof(text)))
-                        word_wrap(&app->wrap, text, FONT_CHARS[app->font_choice]);
+                idle_rearm(&app->idle, app->idle_warm);
+                if(app->cur_verse >= 0 && app->wrap.src) {
+                    word_wrap(&app->wrap, app->wrap.src, FONT_CHARS[app->font_choice]);
+                    markup_mark_runs(app);
                 }
                 settings_save(app);
             }
@@ -1759,20 +3668,20 @@ static void on_api_menu(App* app, InputEvent* ev) {
         case 1:
             if(app->api_book_sel > 0) app->api_book_sel--;
             else app->api_book_sel = BIBLE_BOOKS_COUNT - 1;
-            if(app->api_chapter_sel > BIBLE_BOOKS[app->api_book_sel].chapters)
-                app->api_chapter_sel = BIBLE_BOOKS[app->api_book_sel].chapters;
-            if(app->api_verse_sel > book_chapter_verses(app->api_book_sel, app->api_chapter_sel))
-                app->api_verse_sel = book_chapter_verses(app->api_book_sel, app->api_chapter_sel);
+            if(app->api_chapter_sel > BIBLE_BOOK_CHAPTERS[app->api_book_sel])
+                app->api_chapter_sel = BIBLE_BOOK_CHAPTERS[app->api_book_sel];
+            if(app->api_verse_sel > bible_chapter_verses(app->api_book_sel, app->api_chapter_sel))
+                app->api_verse_sel = bible_chapter_verses(app->api_book_sel, app->api_chapter_sel);
             break;
         case 2:
             if(app->api_chapter_sel > 1) app->api_chapter_sel--;
-            else app->api_chapter_sel = BIBLE_BOOKS[app->api_book_sel].chapters;
-            if(app->api_verse_sel > book_chapter_verses(app->api_book_sel, app->api_chapter_sel))
-                app->api_verse_sel = book_chapter_verses(app->api_book_sel, app->api_chapter_sel);
+            else app->api_chapter_sel = BIBLE_BOOK_CHAPTERS[app->api_book_sel];
+            if(app->api_verse_sel > bible_chapter_verses(app->api_book_sel, app->api_chapter_sel))
+                app->api_verse_sel = bible_chapter_verses(app->api_book_sel, app->api_chapter_sel);
             break;
         case 3:
             if(app->api_verse_sel > 1) app->api_verse_sel--;
-            else app->api_verse_sel = book_chapter_verses(app->api_book_sel, app->api_chapter_sel);
+            else app->api_verse_sel = bible_chapter_verses(app->api_book_sel, app->api_chapter_sel);
             break;
         default: break;
         } break;
@@ -1781,20 +3690,20 @@ static void on_api_menu(App* app, InputEvent* ev) {
         case 1:
             if(app->api_book_sel < BIBLE_BOOKS_COUNT - 1) app->api_book_sel++;
             else app->api_book_sel = 0;
-            if(app->api_chapter_sel > BIBLE_BOOKS[app->api_book_sel].chapters)
-                app->api_chapter_sel = BIBLE_BOOKS[app->api_book_sel].chapters;
-            if(app->api_verse_sel > book_chapter_verses(app->api_book_sel, app->api_chapter_sel))
-                app->api_verse_sel = book_chapter_verses(app->api_book_sel, app->api_chapter_sel);
+            if(app->api_chapter_sel > BIBLE_BOOK_CHAPTERS[app->api_book_sel])
+                app->api_chapter_sel = BIBLE_BOOK_CHAPTERS[app->api_book_sel];
+            if(app->api_verse_sel > bible_chapter_verses(app->api_book_sel, app->api_chapter_sel))
+                app->api_verse_sel = bible_chapter_verses(app->api_book_sel, app->api_chapter_sel);
             break;
         case 2:
-            if(app->api_chapter_sel < BIBLE_BOOKS[app->api_book_sel].chapters)
+            if(app->api_chapter_sel < BIBLE_BOOK_CHAPTERS[app->api_book_sel])
                 app->api_chapter_sel++;
             else app->api_chapter_sel = 1;
-            if(app->api_verse_sel > book_chapter_verses(app->api_book_sel, app->api_chapter_sel))
-                app->api_verse_sel = book_chapter_verses(app->api_book_sel, app->api_chapter_sel);
+            if(app->api_verse_sel > bible_chapter_verses(app->api_book_sel, app->api_chapter_sel))
+                app->api_verse_sel = bible_chapter_verses(app->api_book_sel, app->api_chapter_sel);
             break;
         case 3:
-            if(app->api_verse_sel < book_chapter_verses(app->api_book_sel, app->api_chapter_sel))
+            if(app->api_verse_sel < bible_chapter_verses(app->api_book_sel, app->api_chapter_sel))
                 app->api_verse_sel++;
             else app->api_verse_sel = 1;
             break;
@@ -1852,25 +3761,17 @@ static void on_api_result(App* app, InputEvent* ev) {
         if(app->api_verse_sel > 1) { app->api_verse_sel--; }
         else if(app->api_chapter_sel > 1) {
             app->api_chapter_sel--;
-            app->api_verse_sel = book_chapter_verses(app->api_book_sel, app->api_chapter_sel);
+            app->api_verse_sel = bible_chapter_verses(app->api_book_sel, app->api_chapter_sel);
         } else {
             if(app->api_book_sel > 0) app->api_book_sel--;
             else app->api_book_sel = BIBLE_BOOKS_COUNT - 1;
-            app->api_chapter_sel = BIBLE_BOOKS[app->api_book_sel].chapters;
-            app->api_verse_sel   = book_chapter_verses(app->api_book_sel, app->api_chapter_sel);
+            app->api_chapter_sel = BIBLE_BOOK_CHAPTERS[app->api_book_sel];
+            app->api_verse_sel   = bible_chapter_verses(app->api_book_sel, app->api_chapter_sel);
         }
         api_fetch_quick(app); break;
     case InputKeyRight:
         if(ev->type != InputTypeShort) break;
-        if(app->api_verse_sel < book_chapter_verses(app->api_book_sel, app->api_chapter_sel)) {
-            app->api_verse_sel++;
-        } else if(app->api_chapter_sel < BIBLE_BOOKS[app->api_book_sel].chapters) {
-            app->api_chapter_sel++; app->api_verse_sel = 1;
-        } else {
-            if(app->api_book_sel < BIBLE_BOOKS_COUNT - 1) app->api_book_sel++;
-            else app->api_book_sel = 0;
-            app->api_chapter_sel = 1; app->api_verse_sel = 1;
-        }
+        api_pick_next(&app->api_book_sel, &app->api_chapter_sel, &app->api_verse_sel);
         api_fetch_quick(app); break;
     case InputKeyBack: app->view = ViewApiMenu; break;
     default: break;
@@ -1925,12 +3826,25 @@ int32_t bible_viewer_app(void* p) {
     app->view      = ViewLoading;
     app->cur_verse = -1;
     app->rng       = furi_get_tick();
-    g_app_ptr      = app;
 
     app->storage = furi_record_open(RECORD_STORAGE);
     storage_simply_mkdir(app->storage, DATA_DIR);
 
-    app->queue     = furi_message_queue_alloc(8, sizeof(InputEvent));
+    app->verse_line   = app->verse_bufs[0];
+    app->spare_line   = app->verse_bufs[1];
+    app->prefetch_idx = -1;
+    app->cur_heading  = -1;
+
+    app->queue     = furi_message_queue_alloc(16, sizeof(AppEvent));
+    app->thread_id = furi_thread_get_current_id();
+    app->io        = io_sched_alloc(io_done_cb, app);
+    idle_setup(app);
+    app->lookups.storage    = app->storage;
+    app->lookups.cache_path = API_CACHE_PATH;
+    app->lookups.queue_path = API_QUEUE_PATH;
+    app->idle_drain = idle_register(&app->idle, idle_drain_lookups, app);
+    app->idle_trim  = idle_register(&app->idle, idle_trim_lookups, app);
+    api_backends_setup(app);
     app->view_port = view_port_alloc();
     view_port_draw_callback_set(app->view_port, draw_cb, app);
     view_port_input_callback_set(app->view_port, input_cb, app);
@@ -1951,6 +3865,7 @@ int32_t bible_viewer_app(void* p) {
 
         if(switch_verse_file(app, app->vfile_sel)) {
             bmarks_load(app);
+            headings_load(app);
             app->loading_msg[0] = '\0';
             app->view = ViewMainMenu;
         } else {
@@ -1961,23 +3876,52 @@ int32_t bible_viewer_app(void* p) {
     view_port_update(app->view_port);
 
     // Main event loop
-    InputEvent ev;
+    AppEvent aev;
     while(app->running) {
-        if(furi_message_queue_get(app->queue, &ev, 100) != FuriStatusOk) continue;
+        if(furi_message_queue_get(app->queue, &aev, 100) != FuriStatusOk) {
+            // Catches an AppEventApi that didn't fit in the queue
+            if(api_poll(app)) view_port_update(app->view_port);
+            idle_tick(&app->idle);
+            continue;
+        }
+        if(aev.type == AppEventIo) {
+            app_on_io(app, &aev.io);
+            view_port_update(app->view_port);
+            continue;
+        }
+        if(aev.type == AppEventApi) {
+            api_poll(app);
+            view_port_update(app->view_port);
+            continue;
+        }
+        InputEvent ev = aev.input;
 
         switch(app->view) {
         case ViewMainMenu:      on_main_menu(app, &ev);               break;
         case ViewBrowseList:    on_browse(app, &ev);                  break;
         case ViewVerseRead:     on_verse_read(app, &ev);              break;
+        case ViewVerseMenu:     on_verse_menu(app, &ev);              break;
         case ViewSearchInput:   on_search(app, &ev);                  break;  // keyboard.c
         case ViewSearchResults: on_search_results(app, &ev);          break;  // keyboard.c
+        case ViewSimilar:       on_similar(app, &ev);                 break;
+        case ViewCompare:       on_compare(app, &ev);                 break;
+        case ViewNote:          on_note(app, &ev);                    break;
         case ViewRandomVerse:   on_random_daily(app, &ev, true);      break;
         case ViewDailyVerse:    on_random_daily(app, &ev, false);     break;
         case ViewBookmarks:     on_bookmarks(app, &ev);               break;
+        case ViewReview:        on_review(app, &ev);                  break;
         case ViewSettings:      on_settings(app, &ev);                break;
         case ViewAbout: {
-            static const uint8_t ABOUT_TOTAL = 31;
+            static const uint8_t ABOUT_TOTAL = 34;
             static const uint8_t ABOUT_VIS   = 5;
+            if(ev.type == InputTypeLong && ev.key == InputKeyOk) {
+                snprintf(app->loading_msg, sizeof(app->loading_msg), "Benchmark");
+                app->view = ViewLoading;
+                view_port_update(app->view_port);
+                bench_suite_run(app);
+                app->view = ViewBench;
+                break;
+            }
             if(ev.type == InputTypeShort || ev.type == InputTypeRepeat) {
                 if(ev.key == InputKeyUp && app->about_scroll > 0)
                     app->about_scroll--;
@@ -1999,7 +3943,28 @@ int32_t bible_viewer_app(void* p) {
         case ViewApiResult:  on_api_result(app, &ev);  break;
         case ViewApiTrans:   on_api_trans(app, &ev);   break;
         case ViewApiStatus:  on_api_status(app, &ev);  break;
-        case ViewApiLoading: break;
+        case ViewFontBench:
+            if(ev.type == InputTypeShort && ev.key == InputKeyBack)
+                app->view = ViewSettings;
+            break;
+        case ViewBench:
+            if(ev.type != InputTypeShort && ev.type != InputTypeRepeat) break;
+            if(ev.key == InputKeyUp && app->bench_scroll > 0)
+                app->bench_scroll--;
+            else if(ev.key == InputKeyDown &&
+                    app->bench_scroll + VISIBLE_LINES < BENCH_CASE_COUNT)
+                app->bench_scroll++;
+            else if(ev.key == InputKeyBack)
+                app->view = ViewAbout;
+            break;
+        case ViewApiLoading:
+            // Leave the lookup to finish into the cache
+            if(ev.type == InputTypeShort && ev.key == InputKeyBack) {
+                ApiSlot* s = api_slot_find(app, ApiUseShow);
+                if(s) s->use = ApiUsePrefetch;
+                app->view = ViewApiMenu;
+            }
+            break;
         case ViewApiError:
             if(ev.type == InputTypeShort && ev.key == InputKeyBack)
                 app->view = ViewApiMenu;
@@ -2008,13 +3973,20 @@ int32_t bible_viewer_app(void* p) {
         view_port_update(app->view_port);
     }
 
-    // Cleanup
+    // Cleanup: stop the I/O worker first, then free the contexts of any
+    // completions it left in the queue
+    io_sched_free(app->io);
+    while(furi_message_queue_get(app->queue, &aev, 0) == FuriStatusOk)
+        if(aev.type == AppEventIo) app_on_io(app, &aev.io);
     if(app->vfile) {
         storage_file_close(app->vfile);
         storage_file_free(app->vfile);
     }
     api_release_fhttp(app);
-    g_app_ptr = NULL;
+    search_drop_book_pass(app);
+    srs_close(app->review.deck);
+    headings_free(&app->headings);
+    font_cache_free();
     gui_remove_view_port(app->gui, app->view_port);
     furi_record_close(RECORD_GUI);
     view_port_free(app->view_port);
@@ -30,17 +30,10 @@ extern "C" {
 #define SB_X               (SCREEN_W - SB_W - 1)
 
 // ============================================================
-// Data / buffer sizes
+// Data / buffer sizes, shared with the host tools
 // ============================================================
 
-#define MAX_SEARCH_LEN     64
-#define MAX_SEARCH_RESULTS 50
-#define MAX_BOOKMARKS      75
-#define MAX_VERSES        600
-#define WRAP_MAX_LINES      8
-#define WRAP_LINE_LEN      32
-#define REF_LEN            24
-#define LINE_BUF_LEN      320
+#include "core/core.h"
 
 // ============================================================
 // Keyboard layout constants
@@ -56,9 +49,7 @@ extern "C" {
 
 #define API_RESULT_FOOTER_H  9
 #define API_TRANS_COUNT      9
-#define BIBLE_BOOKS_COUNT   66
 #define API_MENU_ITEMS       7
-#define FONT_COUNT           5
 
 // ============================================================
 // File system paths
@@ -67,12 +58,27 @@ extern "C" {
 #define DATA_DIR      "/ext/apps_data/bible_viewer"
 #define BM_PATH       DATA_DIR "/bookmarks.txt"
 #define SETTINGS_PATH DATA_DIR "/settings.txt"
+#define CARDS_PATH    DATA_DIR "/cards.bin"
+#define HEADINGS_PATH DATA_DIR "/headings.txt"
+#define API_CACHE_PATH DATA_DIR "/api_cache.txt"
+#define API_QUEUE_PATH DATA_DIR "/api_queue.txt"
+#define API_MIRROR_PATH DATA_DIR "/api_mirror.txt"
+#define BENCH_CSV_PATH DATA_DIR "/" BENCH_CSV_NAME
 
 // Index cache format
-#define IDX_MAGIC    "BVIX"
-#define IDX_VERSION  ((uint8_t)2)
-
-#define APP_VERSION  "1.4"
+#define MAX_PHON_KEYS 3072   // phonetic table entries built per verse file
+#define MAX_MARKS     2048   // inline markup spans built per verse file
+#define MAX_VERSE_MARKS  8   // markup spans shown per verse
+#define NOTES_MAGIC  "BVNX"
+#define NOTES_VERSION ((uint8_t)1)
+#define MAX_NOTES     4096   // footnotes indexed per notes file
+#define MAX_SIMILAR     12   // "similar verses" list length
+#define HEADINGS_MAX_BYTES 16384   // largest headings file loaded
+#define IDLE_AFTER_MS 5000   // quiet time before maintenance jobs run
+#define IDLE_BUDGET_MS  15   // maintenance work per 100 ms loop tick
+#define API_DRAIN_BATCH  4   // queued lookups replayed per board check
+#define API_PING_MS   1000   // wait for a [PONG] before the board counts as gone
+#define API_MAX_INFLIGHT 3   // lookup on screen, prefetch, queue replay
 
 // ============================================================
 // Enums
@@ -82,11 +88,16 @@ typedef enum {
     ViewMainMenu,
     ViewBrowseList,
     ViewVerseRead,
+    ViewVerseMenu,
     ViewSearchInput,
     ViewSearchResults,
+    ViewSimilar,
+    ViewCompare,
+    ViewNote,
     ViewRandomVerse,
     ViewDailyVerse,
     ViewBookmarks,
+    ViewReview,
     ViewSettings,
     ViewAbout,
     ViewLoading,
@@ -98,6 +109,8 @@ typedef enum {
     ViewApiError,
     ViewApiTrans,
     ViewApiStatus,
+    ViewFontBench,
+    ViewBench,
 } AppView;
 
 typedef enum {
@@ -106,6 +119,7 @@ typedef enum {
     MenuRandom,
     MenuDaily,
     MenuBookmarks,
+    MenuReview,
     MenuApi,
     MenuSettings,
     MenuAbout,
@@ -124,23 +138,131 @@ typedef enum {
 // FlipperHTTP types (full definition required here)
 // ============================================================
 #include "flipper_http/flipper_http.h"
+#include "search/search.h"
+#include "search/idxfmt.h"
+#include "io/io_sched.h"
+#include "io/idle.h"
+#include "review/srs.h"
+#include "api/lookups.h"
+#include "api/backends.h"
+#include "bench/bench.h"
+#include "meta/bible_meta.h"
 
 // ============================================================
 // Structs
 // ============================================================
 
+// Job types run on the I/O scheduler
+typedef enum {
+    IoJobSearch,
+    IoJobPrefetch,
+} IoJobKind;
+
+// Everything the main loop waits on: key presses, I/O completions and
+// Bible API responses (the slot holds the result; the event only wakes)
+typedef enum {
+    AppEventInput,
+    AppEventIo,
+    AppEventApi,
+} AppEventType;
+
+typedef struct {
+    AppEventType type;
+    union {
+        InputEvent   input;
+        IoCompletion io;
+    };
+} AppEvent;
+
+// Who consumes a Bible API lookup
+typedef enum {
+    ApiUseShow,       // the lookup on screen
+    ApiUsePrefetch,   // cached only: the picker's next verse, or a lookup left behind
+    ApiUseReplay,     // head of the offline queue, popped once answered
+} ApiUse;
+
+// One Bible API lookup in flight. The FlipperHTTP callback fills the
+// result on the RX thread and then publishes done with a release store;
+// the app thread reads the result only after an acquire load of done
+// sees it set (api_slot_done).
+typedef struct {
+    struct App*   app;
+    uint16_t      id;       // FlipperHTTP correlation id
+    bool          busy;
+    uint8_t       backend;  // index in App.backends of the current attempt
+    uint8_t       tried;    // backends tried so far, bit per index
+    uint32_t      sent;     // tick the current attempt went out
+    uint32_t      elapsed;  // ticks until its answer
+    uint8_t       use;      // ApiUse, may change while in flight
+    bool          done;     // atomic: the result below is ready
+    bool          ok;       // the board answered (no timeout or [ERROR])
+    bool          found;    // the answer held a reference and text
+    char          trans[LOOKUP_TRANS_LEN];
+    char          query[LOOKUP_QUERY_LEN];
+    char          ref[48];
+    char          text[512];
+} ApiSlot;
+
+// Inline markup in verse files: [supplied words], {words of Christ},
+// and footnote markers ^a..^z
+typedef enum {
+    MarkupSupplied = 1,
+    MarkupChrist   = 2,
+    MarkupNote     = 3,
+} MarkupKind;
+
+typedef enum {
+    WrapRunInvert,      // search hits, diff marks
+    WrapRunDotted,      // supplied words
+    WrapRunUnderline,   // words of Christ
+    WrapRunFrame,       // footnote markers
+} WrapRunStyle;
+
 typedef struct {
-    char    lines[WRAP_MAX_LINES][WRAP_LINE_LEN + 1];
-    uint8_t count;
-    uint8_t scroll;
-} WrapState;
+    uint16_t  idx[MAX_SEARCH_RESULTS];
+    MatchSpan spans[MAX_SEARCH_RESULTS][MAX_HIT_SPANS];
+    uint8_t   span_count[MAX_SEARCH_RESULTS];
+    uint8_t   count;
+    uint8_t   sel;
+    uint8_t   scroll;   // scroll offset for the results list
+
+    // Per-book totals from the same pass; total may exceed count
+    uint16_t  total;
+    uint16_t  book_hits[BIBLE_BOOKS_COUNT];
+    bool      grouped;     // show books with counts instead of a flat list
+    uint8_t   open_book;   // expanded book in grouped mode, or BOOK_NONE
+} SearchHits;
 
+// "Similar verses" candidates, best first
 typedef struct {
-    uint16_t idx[MAX_SEARCH_RESULTS];
+    uint16_t idx[MAX_SIMILAR];
+    uint8_t  shared[MAX_SIMILAR];   // LSH bands shared with the source verse
     uint8_t  count;
     uint8_t  sel;
-    uint8_t  scroll;   // scroll offset for the results list
-} SearchHits;
+    uint16_t src;                   // verse the list was built for
+    AppView  src_ret;               // that verse's return view
+} SimilarList;
+
+// The open verse next to the same verse in another translation, with
+// the words that differ marked on each side
+typedef struct {
+    uint8_t   other;                 // vfiles index compared against
+    bool      show_other;            // side shown: other file or the open one
+    bool      found;                 // the other file has this verse indexed
+    uint16_t  changed;               // differing words, both sides
+    char      line[LINE_BUF_LEN];    // the other translation's raw line
+    MatchSpan marks[2][WRAP_MAX_RUNS];   // [0] open verse, [1] other
+    uint8_t   mark_count[2];
+    WrapState wrap;
+} CompareState;
+
+// A footnote of the open verse, read from the notes file on demand
+typedef struct {
+    uint8_t   sel;                 // cur_markup entry of the marker shown
+    bool      found;               // the notes file has this note
+    char      text[LINE_BUF_LEN];
+    WrapState wrap;
+} NoteState;
 
 typedef struct {
     uint16_t idx[MAX_BOOKMARKS];
@@ -148,11 +270,38 @@ typedef struct {
     uint8_t  sel;
 } BookmarkList;
 
-// One entry per verse: byte offset in the source file + cached reference string
+// Memorization review: a summary screen, then one due card at a time
 typedef struct {
-    uint32_t offset;
-    char     ref[REF_LEN];
-} VerseIndex;
+    SrsDeck* deck;       // opened on first use
+    SrsCard  card;       // card on screen
+    int16_t  verse;      // its verse in the open file, -1 = not in it
+    bool     showing;    // a card is on screen (else the summary)
+    bool     revealed;
+    uint16_t reviewed;   // cards graded since the summary was opened
+    int16_t  added;      // last bookmark import, -1 = none yet
+    uint8_t  bm_note;    // bookmarks header: 0 none, 1 added, 2 already there
+} ReviewState;
+
+// Markup of the open verse. Its delimiters are cut out of the line when
+// the verse is opened; spans are offsets into the cleaned text, and cut
+// keeps the raw offsets removed so search spans can be mapped onto it.
+typedef struct {
+    MatchSpan span[MAX_VERSE_MARKS];
+    uint8_t   kind[MAX_VERSE_MARKS];
+    uint8_t   count;
+    uint16_t  cut[2 * MAX_VERSE_MARKS];   // ascending
+    uint8_t   cut_count;
+} VerseMarkup;
+
+// Section headings ("The Sermon on the Mount") keyed by the canonical id
+// of the verse they start at. ids is sorted; text holds each heading's
+// offset into blob, the loaded file with its separators NUL-terminated.
+typedef struct {
+    uint32_t* ids;
+    uint16_t* text;
+    char*     blob;
+    uint16_t  count;
+} HeadingTable;
 
 // A discovered verse file on the SD card
 typedef struct {
@@ -164,6 +313,7 @@ typedef struct App {
     Gui*              gui;
     ViewPort*         view_port;
     FuriMessageQueue* queue;
+    FuriThreadId      thread_id;   // the event loop's thread
     Storage*          storage;
 
     bool     running;
@@ -174,17 +324,53 @@ typedef struct App {
     VerseIndex* index;
     uint16_t    verse_count;
 
+    // Phonetic name table (PHON section of the .idx cache)
+    uint32_t    phon_off;     // file offset of the first entry
+    uint16_t    phon_count;   // 0 = no table
+    uint8_t     phon_algo;    // PhoneticAlgo the keys were built with
+
+    // MinHash LSH buckets (LSHB section of the .idx cache)
+    uint32_t    lsh_off;      // file offset of band 0
+    uint16_t    lsh_count;    // entries per band; 0 = no table
+
+    // Inline markup spans (MARK section of the .idx cache)
+    uint32_t    mark_off;
+    uint16_t    mark_count;
+    uint8_t     verse_menu_sel;   // reader's OK menu
+    SimilarList similar;
+    CompareState compare;
+    NoteState   note;
+
+    // Section headings from the optional headings file
+    HeadingTable headings;
+
     // Verse files available on SD
     VerseFile vfiles[8];
     uint8_t   vfile_count;
     uint8_t   vfile_sel;
+    uint8_t   versify;   // VersifyScheme of the open file
 
-    // Open file handle (kept open for fast seeking)
+    // Open file handle (kept open for fast seeking). Shared with the I/O
+    // worker: access it from the app thread only under io_sched_lock.
     File*     vfile;
+    IoSched*  io;
+
+    // Idle-time maintenance
+    IdleRunner idle;
+    int8_t     idle_warm;   // glyph warming job, re-armed on font change
+    int8_t     idle_drain;  // offline lookup replay, re-armed on enqueue and reconnect
+    int8_t     idle_trim;   // lookup cache compaction, re-armed when it passes its limit
 
     // Currently displayed verse
     int16_t   cur_verse;
     char      cur_ref[REF_LEN];
+    char*     verse_line;   // raw SD line; wrap.src points into it
+    char*     spare_line;   // prefetched next verse, or NULL while loading
+    int16_t   prefetch_idx; // verse held in spare_line, -1 = none
+    uint16_t  vfile_gen;    // bumped per file switch to drop stale prefetches
+    int16_t   cur_heading;  // section the verse belongs to, -1 = none
+    VerseMarkup cur_markup;
+    char      verse_bufs[2][LINE_BUF_LEN];
     WrapState wrap;
 
     // Main menu
@@ -199,6 +385,9 @@ typedef struct App {
     char        search_buf[MAX_SEARCH_LEN];
     uint8_t     search_len;
     SearchHits  hits;
+    SearchHits* book_pass;      // open_book's hits when the full pass kept too few
+    uint16_t    search_job;     // running search job id, 0 = none
+    bool        search_busy;
     uint8_t     kb_row;
     uint8_t     kb_col;
     bool        kb_caps;
@@ -209,14 +398,18 @@ typedef struct App {
 
     // Bookmarks
     BookmarkList bmarks;
+    ReviewState  review;
 
     // Settings
     uint8_t settings_sel;
-    uint8_t settings_sec;   // 0=Version, 1=Font
+    uint8_t settings_sec;   // 0=Version, 1=Font, 2=Search mode
 
     // Active font
     FontChoice font_choice;
 
+    // Search matching mode
+    SearchMode search_mode;
+
     // Error / loading
     char error_msg[48];
     char loading_msg[48];
@@ -239,6 +432,13 @@ typedef struct App {
     uint8_t      api_menu_sel;
     uint8_t      api_menu_scroll;
     bool         wifi_connected;
+    uint32_t     api_baud;        // last UART rate the board confirmed, 0 = never asked
+    bool         api_queued;      // the failed lookup was queued for later
+    bool         api_drain_hold;  // a replay failed; stop draining until re-armed
+    uint32_t     api_drain_ping;  // tick the replay batch's PING went out, 0 = none
+    ApiSlot      api_slots[API_MAX_INFLIGHT];
+    ApiBackends  backends;
+    LookupStore  lookups;
     char         api_status_ssid[33];
     char         api_status_ip[16];
     uint8_t      api_trans_scroll;
@@ -246,6 +446,14 @@ typedef struct App {
     uint8_t      api_chapter_sel;
     uint8_t      api_verse_sel;
     uint8_t      about_scroll;
+
+    // Font draw benchmark: us per full-screen frame, [font][0=canvas, 1=cached]
+    uint16_t     font_bench_us[FONT_COUNT][2];
+
+    // Benchmark suite (hold OK on About), one result per BENCH_CASES entry
+    BenchResult  bench[BENCH_CASE_COUNT];
+    uint8_t      bench_scroll;
+    bool         bench_saved;     // the run was appended to BENCH_CSV_PATH
 } App;
 
 // ============================================================
@@ -259,7 +467,10 @@ void draw_scrollbar(Canvas* canvas, uint16_t pos, uint16_t total, uint8_t vis);
 void draw_list_item(Canvas* canvas, uint8_t y, const char* text, bool sel);
 
 // Search
-void do_search(App* app);
+void do_search(App* app);       // starts the search; results arrive later
+void search_cancel(App* app);
+void search_expand_book(App* app, uint8_t book);   // fetch a book's hits if not all kept
+const char* bible_book_name(uint8_t book);
 
 // Keyboard callbacks (called by keyboard.c)
 void kb_submit(App* app);          // GO! pressed on keyboard
@@ -268,6 +479,12 @@ void kb_update_suggestion(App* app); // update book-name ghost hint
 
 // Verse navigation (called by keyboard.c results handler)
 void open_verse(App* app, uint16_t vi, AppView ret);
+void verse_highlight(App* app, const MatchSpan* spans, uint8_t n);
+
+// Canonical verse ids: (book + 1) << 16 | chapter << 8 | verse, the same
+// for a verse in every translation. 0 = reference not understood.
+uint32_t verse_canon_id(const App* app, uint16_t vi);
+int16_t  verse_find_canon(const App* app, uint32_t id);   // -1 if absent
 
 #ifdef __cplusplus
 }
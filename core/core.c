@@ -0,0 +1,110 @@
+// core.c — Limits, verse index scan and word wrap shared by the app and
+//          the host tools
+
+#include "core.h"
+#include "../meta/bible_meta.h"
+
+#include <string.h>
+
+const uint8_t FONT_CHARS[FONT_COUNT] = { 22, 30, 24, 20, 13 };
+
+// ============================================================
+// Verse index
+// ============================================================
+
+static bool name_is(const char* pooled, const char* name, size_t len) {
+    return strncmp(pooled, name, len) == 0 && pooled[len] == '\0';
+}
+
+uint8_t verse_book_id(const char* name, size_t len) {
+    for(uint8_t l = 0; l < BIBLE_LANG_COUNT; l++)
+        for(uint8_t b = 0; b < BIBLE_BOOKS_COUNT; b++)
+            if(name_is(bible_meta_name((BibleLang)l, b), name, len)) return b;
+    for(uint8_t a = 0; a < BIBLE_ALIAS_COUNT; a++)
+        if(name_is(BIBLE_NAME_POOL + BIBLE_ALIAS_NAME[a], name, len)) return BIBLE_ALIAS_BOOK[a];
+    return BOOK_NONE;
+}
+
+uint16_t verse_index_scan(const VerseScan* s, VerseIndex* index) {
+    char line[LINE_BUF_LEN];
+    uint32_t offset = 0;
+    uint16_t count = 0;
+
+    while(count < MAX_VERSES) {
+        uint32_t line_start = offset;
+        uint16_t li = 0;
+        bool eof = false;
+        while(li < sizeof(line) - 1) {
+            char ch;
+            if(s->read(s->ctx, &ch, 1) == 0) { eof = true; break; }
+            offset++;
+            if(ch == '\r') continue;
+            if(ch == '\n') break;
+            line[li++] = ch;
+        }
+        line[li] = '\0';
+        if(li == 0 && eof) break;
+        if(li == 0) continue;
+
+        const char* p = strchr(line, '|');
+        if(!p) { if(eof) break; continue; }
+
+        VerseIndex* vi = &index[count];
+        vi->offset = line_start;
+        size_t rlen = (size_t)(p - line);
+        if(rlen >= REF_LEN) rlen = REF_LEN - 1;
+        memcpy(vi->ref, line, rlen);
+        vi->ref[rlen] = '\0';
+        const char* p2 = strchr(p + 1, '|');
+        vi->book = p2 ? verse_book_id(p + 1, (size_t)(p2 - p - 1)) : BOOK_NONE;
+        if(s->verse) s->verse(s->ctx, count, line);
+        count++;
+
+        if(eof) break;
+    }
+    return count;
+}
+
+// ============================================================
+// Word wrap
+// ============================================================
+
+void word_wrap(WrapState* w, const char* text, uint8_t cols) {
+    memset(w, 0, sizeof(WrapState));
+    w->src = text;
+    size_t len = strlen(text), pos = 0;
+    if(cols < 1) cols = 1;
+    if(cols > WRAP_LINE_LEN) cols = WRAP_LINE_LEN;
+    while(pos < len && w->count < WRAP_MAX_LINES) {
+        size_t rem = len - pos;
+        w->start[w->count] = (uint16_t)pos;
+        if(rem <= cols) {
+            w->len[w->count++] = (uint8_t)rem;
+            break;
+        }
+        size_t brk = cols;
+        while(brk > 0 && text[pos + brk] != ' ') brk--;
+        if(!brk) brk = cols;
+        w->len[w->count++] = (uint8_t)brk;
+        pos += brk;
+        if(pos < len && text[pos] == ' ') pos++;
+    }
+}
+
+void wrap_mark_spans(WrapState* w, const MatchSpan* spans, uint8_t n, uint8_t style) {
+    for(uint8_t s = 0; s < n; s++) {
+        uint16_t s0 = spans[s].off, s1 = (uint16_t)(spans[s].off + spans[s].len);
+        for(uint8_t l = 0; l < w->count && w->run_count < WRAP_MAX_RUNS; l++) {
+            uint16_t l0 = w->start[l];
+            uint16_t l1 = (uint16_t)(l0 + w->len[l]);
+            uint16_t a = s0 > l0 ? s0 : l0;
+            uint16_t b = s1 < l1 ? s1 : l1;
+            if(a >= b) continue;
+            WrapRun* r = &w->runs[w->run_count++];
+            r->line  = l;
+            r->col   = (uint8_t)(a - l0);
+            r->len   = (uint8_t)(b - a);
+            r->style = style;
+        }
+    }
+}
@@ -0,0 +1,90 @@
+// core.h — Limits, verse index scan and word wrap shared by the app and
+//          the host tools
+// Pure C (no Furi dependencies) so it can be shared with host tools.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../search/search.h"
+#include "../search/idxfmt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define APP_VERSION  "1.4"
+
+#define MAX_BOOKMARKS      75
+#define MAX_VERSES        600
+#define LINE_BUF_LEN      320
+#define WRAP_MAX_LINES     40   // 512-char API text at 13 columns
+#define WRAP_LINE_LEN      32
+#define WRAP_MAX_RUNS      24   // word-diff marks need more than search hits
+#define FONT_COUNT          5
+#define BOOK_NONE        0xFF   // book field not in meta/books.txt
+
+// Text columns per line for each FontChoice
+extern const uint8_t FONT_CHARS[FONT_COUNT];
+
+// ============================================================
+// Verse index
+// ============================================================
+
+// One entry per verse: byte offset in the source file + cached reference string
+typedef struct {
+    uint32_t offset;
+    char     ref[REF_LEN];
+    uint8_t  book;   // canonical book id (meta/books.txt order) or BOOK_NONE
+} VerseIndex;
+
+typedef struct {
+    void* ctx;
+    // Next bytes of the verse file; 0 at the end
+    size_t (*read)(void* ctx, void* buf, size_t n);
+    // Each indexed verse's whole line, CR dropped; may be NULL
+    void (*verse)(void* ctx, uint16_t vi, const char* line);
+} VerseScan;
+
+// Canonical id of a verse file's book field. Any language's name from
+// meta/books.txt is accepted, and the aliases ("Psalm").
+uint8_t verse_book_id(const char* name, size_t len);
+
+// Single pass over a verse file read from its start. Lines without a '|'
+// are skipped. Fills index[0..MAX_VERSES) and returns the verse count.
+uint16_t verse_index_scan(const VerseScan* s, VerseIndex* index);
+
+// ============================================================
+// Word wrap
+// ============================================================
+
+// Highlighted run on one wrapped line (columns are byte offsets)
+typedef struct {
+    uint8_t line;
+    uint8_t col;
+    uint8_t len;
+    uint8_t style;   // WrapRunStyle
+} WrapRun;
+
+// Wrapped view of a text owned elsewhere: lines are (offset, length)
+// pairs into src, so wrapping copies nothing.
+typedef struct {
+    const char* src;
+    uint16_t start[WRAP_MAX_LINES];   // source offset of each line
+    uint8_t  len[WRAP_MAX_LINES];     // bytes on each line
+    uint8_t  count;
+    uint8_t  scroll;
+    WrapRun  runs[WRAP_MAX_RUNS];
+    uint8_t  run_count;
+} WrapState;
+
+// Break text at spaces into lines of at most cols bytes; a word longer
+// than a line is cut. Clears scroll and runs.
+void word_wrap(WrapState* w, const char* text, uint8_t cols);
+
+// Append highlight runs in the given style for spans (offsets into
+// w->src). A span that straddles a line break becomes one run per line.
+void wrap_mark_spans(WrapState* w, const MatchSpan* spans, uint8_t n, uint8_t style);
+
+#ifdef __cplusplus
+}
+#endif
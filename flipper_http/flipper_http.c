@@ -4,6 +4,184 @@
 // File: flipper_http.c
 #include <flipper_http/flipper_http.h>
 
+static void flipper_http_pending_finish(FlipperHTTP *fhttp, bool ok, bool all); // forward declaration
+
+// Frame decoder positions
+enum
+{
+    FRAME_HUNT, // waiting for FRAME_SOF
+    FRAME_TYPE,
+    FRAME_LEN_LO,
+    FRAME_LEN_HI,
+    FRAME_PAYLOAD,
+    FRAME_CRC_LO,
+    FRAME_CRC_HI,
+};
+
+/**
+ * @brief      Update a CRC-16/CCITT (poly 0x1021, init 0xFFFF) with one byte.
+ * @return     The updated CRC.
+ * @param      crc  The CRC so far.
+ * @param      b    The next byte.
+ */
+static uint16_t flipper_http_crc16(uint16_t crc, uint8_t b)
+{
+    crc ^= (uint16_t)b << 8;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+/**
+ * @brief      Buffer response bytes for the file of a bytes request.
+ * @return     void
+ * @param      fhttp The FlipperHTTP context
+ * @param      data  The bytes to save.
+ * @param      len   The number of bytes.
+ */
+static void flipper_http_save_bytes(FlipperHTTP *fhttp, const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        // Add byte to the buffer
+        fhttp->file_buffer[fhttp->file_buffer_len++] = data[i];
+        // Write to file if buffer is full
+        if (fhttp->file_buffer_len >= FILE_BUFFER_SIZE)
+        {
+            if (!flipper_http_append_to_file(
+                    fhttp->file_buffer,
+                    fhttp->file_buffer_len,
+                    fhttp->just_started_bytes,
+                    fhttp->file_path))
+            {
+                FURI_LOG_E(HTTP_TAG, "Failed to append data to file");
+            }
+            fhttp->file_buffer_len = 0;
+            fhttp->just_started_bytes = false;
+        }
+    }
+}
+
+/**
+ * @brief      Finish the current response on a FRAME_END.
+ * @return     void
+ * @param      fhttp The FlipperHTTP context
+ * @note       The framed counterpart of the END marker handling in flipper_http_rx_callback;
+ *             no end marker has to be found or cut out of the file buffer.
+ */
+static void flipper_http_frame_end(FlipperHTTP *fhttp)
+{
+    furi_timer_stop(fhttp->get_timeout_timer);
+    if (fhttp->save_bytes && fhttp->file_buffer_len > 0)
+    {
+        if (!flipper_http_append_to_file(fhttp->file_buffer, fhttp->file_buffer_len, fhttp->just_started_bytes, fhttp->file_path))
+        {
+            FURI_LOG_E(HTTP_TAG, "Failed to append data to file.");
+        }
+    }
+    fhttp->file_buffer_len = 0;
+    fhttp->started_receiving = false;
+    fhttp->just_started = false;
+    fhttp->state = IDLE;
+    fhttp->save_bytes = false;
+    fhttp->is_bytes_request = false;
+    fhttp->save_received_data = false;
+    flipper_http_pending_finish(fhttp, true, false);
+}
+
+/**
+ * @brief      Feed one received byte to the frame decoder.
+ * @return     void
+ * @param      fhttp The FlipperHTTP context
+ * @param      b     The received byte.
+ * @note       A frame with a bad length or CRC is dropped and the decoder hunts for the
+ *             next FRAME_SOF; a lost FRAME_END is caught by the request timeout.
+ */
+static void flipper_http_frame_byte(FlipperHTTP *fhttp, uint8_t b)
+{
+    switch (fhttp->frame_state)
+    {
+    case FRAME_HUNT:
+        if (b == FRAME_SOF)
+        {
+            fhttp->frame_crc = 0xFFFF;
+            fhttp->frame_state = FRAME_TYPE;
+        }
+        return;
+    case FRAME_TYPE:
+        fhttp->frame_type = b;
+        fhttp->frame_crc = flipper_http_crc16(fhttp->frame_crc, b);
+        fhttp->frame_state = FRAME_LEN_LO;
+        return;
+    case FRAME_LEN_LO:
+        fhttp->frame_len = b;
+        fhttp->frame_crc = flipper_http_crc16(fhttp->frame_crc, b);
+        fhttp->frame_state = FRAME_LEN_HI;
+        return;
+    case FRAME_LEN_HI:
+        fhttp->frame_len |= (uint16_t)b << 8;
+        fhttp->frame_crc = flipper_http_crc16(fhttp->frame_crc, b);
+        fhttp->frame_pos = 0;
+        if (fhttp->frame_len >= RX_LINE_BUFFER_SIZE)
+        {
+            fhttp->frame_errors++;
+            fhttp->frame_state = FRAME_HUNT;
+            return;
+        }
+        fhttp->frame_state = fhttp->frame_len ? FRAME_PAYLOAD : FRAME_CRC_LO;
+        return;
+    case FRAME_PAYLOAD:
+        fhttp->rx_line_buffer[fhttp->frame_pos++] = (char)b;
+        fhttp->frame_crc = flipper_http_crc16(fhttp->frame_crc, b);
+        if (fhttp->frame_pos == fhttp->frame_len)
+        {
+            fhttp->frame_state = FRAME_CRC_LO;
+        }
+        return;
+    case FRAME_CRC_LO:
+        fhttp->frame_rx_crc = b;
+        fhttp->frame_state = FRAME_CRC_HI;
+        return;
+    default:
+        fhttp->frame_rx_crc |= (uint16_t)b << 8;
+        fhttp->frame_state = FRAME_HUNT;
+        break;
+    }
+
+    if (fhttp->frame_rx_crc != fhttp->frame_crc)
+    {
+        FURI_LOG_E(HTTP_TAG, "Dropped frame with bad CRC.");
+        fhttp->frame_errors++;
+        return;
+    }
+    switch (fhttp->frame_type)
+    {
+    case FRAME_LINE:
+        fhttp->rx_line_buffer[fhttp->frame_len] = '\0';
+        if (fhttp->handle_rx_line_cb)
+        {
+            fhttp->handle_rx_line_cb(fhttp->rx_line_buffer, fhttp->callback_context);
+        }
+        break;
+    case FRAME_DATA:
+        // Text responses come as FRAME_LINE; data is only kept for bytes requests
+        if (fhttp->save_bytes)
+        {
+            flipper_http_save_bytes(fhttp, (const uint8_t *)fhttp->rx_line_buffer, fhttp->frame_len);
+        }
+        furi_timer_restart(fhttp->get_timeout_timer, TIMEOUT_DURATION_TICKS);
+        break;
+    case FRAME_END:
+        flipper_http_frame_end(fhttp);
+        break;
+    default:
+        fhttp->frame_errors++;
+        break;
+    }
+}
+
 /**
  * @brief      Worker thread to handle UART data asynchronously.
  * @return     0
@@ -53,25 +231,17 @@ static int32_t flipper_http_worker(void *context)
                 // print amount of bytes received
                 // FURI_LOG_I(HTTP_TAG, "Bytes received: %d", fhttp->bytes_received);
 
+                // Framed mode: the decoder routes lines, data and ends itself
+                if (fhttp->framed)
+                {
+                    flipper_http_frame_byte(fhttp, (uint8_t)c);
+                    continue;
+                }
+
                 // Append the received byte to the file if saving is enabled
                 if (fhttp->save_bytes)
                 {
-                    // Add byte to the buffer
-                    fhttp->file_buffer[fhttp->file_buffer_len++] = c;
-                    // Write to file if buffer is full
-                    if (fhttp->file_buffer_len >= FILE_BUFFER_SIZE)
-                    {
-                        if (!flipper_http_append_to_file(
-                                fhttp->file_buffer,
-                                fhttp->file_buffer_len,
-                                fhttp->just_started_bytes,
-                                fhttp->file_path))
-                        {
-                            FURI_LOG_E(HTTP_TAG, "Failed to append data to file");
-                        }
-                        fhttp->file_buffer_len = 0;
-                        fhttp->just_started_bytes = false;
-                    }
+                    flipper_http_save_bytes(fhttp, (const uint8_t *)&c, 1);
                 }
 
                 // Handle line buffering only if callback is set (text data)
@@ -128,6 +298,55 @@ static void _flipper_http_rx_callback(
     }
 }
 
+/**
+ * @brief      Complete the oldest tagged request, or every one in flight.
+ * @return     void
+ * @param      fhttp The FlipperHTTP context
+ * @param      ok    true if the response ended normally.
+ * @param      all   true to fail the whole queue once responses can no longer be matched.
+ * @note       Callbacks run after the queue is updated and the mutex released.
+ */
+static void flipper_http_pending_finish(FlipperHTTP *fhttp, bool ok, bool all)
+{
+    if (!fhttp->pending_mutex)
+    {
+        return;
+    }
+    FlipperHTTPPending done[FHTTP_MAX_INFLIGHT];
+    uint8_t count = 0;
+
+    furi_mutex_acquire(fhttp->pending_mutex, FuriWaitForever);
+    while (fhttp->pending_count > 0 && (all || count == 0))
+    {
+        done[count++] = fhttp->pending[fhttp->pending_head];
+        fhttp->pending_head = (fhttp->pending_head + 1) % FHTTP_MAX_INFLIGHT;
+        fhttp->pending_count--;
+    }
+    bool more = fhttp->pending_count > 0;
+    if (more)
+    {
+        fhttp->method = fhttp->pending[fhttp->pending_head].method;
+    }
+    furi_mutex_release(fhttp->pending_mutex);
+
+    if (count > 0 && !all)
+    {
+        // The next response has not started yet; time it from now
+        if (more)
+            furi_timer_restart(fhttp->get_timeout_timer, TIMEOUT_DURATION_TICKS);
+        else
+            furi_timer_stop(fhttp->get_timeout_timer);
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (done[i].callback)
+        {
+            done[i].callback(done[i].id, ok, fhttp->last_response, done[i].context);
+        }
+    }
+}
+
 // Timer callback function
 /**
  * @brief      Callback function for the GET timeout timer.
@@ -150,6 +369,9 @@ static void get_timeout_timer_callback(void *context)
 
     // Update UART state
     fhttp->state = ISSUE;
+
+    // Whatever arrives next can't be matched to a request any more
+    flipper_http_pending_finish(fhttp, false, true);
 }
 
 static void flipper_http_rx_callback(const char *line, void *context); // forward declaration
@@ -226,6 +448,7 @@ FlipperHTTP *flipper_http_alloc()
 
     // Initialize UART with acquired handle
     furi_hal_serial_init(fhttp->serial_handle, BAUDRATE);
+    fhttp->baudrate = BAUDRATE;
 
     // Enable RX direction
     furi_hal_serial_enable_direction(fhttp->serial_handle, FuriHalSerialDirectionRx);
@@ -281,6 +504,8 @@ FlipperHTTP *flipper_http_alloc()
     }
     memset(fhttp->last_response, 0, RX_BUF_SIZE); // Initialize last_response
 
+    fhttp->pending_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+
     fhttp->state = IDLE;
 
     // FURI_LOG_I(HTTP_TAG, "UART initialized successfully.");
@@ -341,6 +566,8 @@ bool flipper_http_deauth_stop(FlipperHTTP *fhttp)
  * @return     void
  * @param fhttp The FlipperHTTP context
  * @note       This function will stop the asynchronous RX, release the serial handle, and free the resources.
+ *             A board switched to framed mode or another rate is put back in text mode at
+ *             BAUDRATE first, the rate confirmed with a PING as flipper_http_set_baudrate does.
  */
 void flipper_http_free(FlipperHTTP *fhttp)
 {
@@ -354,6 +581,31 @@ void flipper_http_free(FlipperHTTP *fhttp)
         FURI_LOG_E(HTTP_TAG, "UART handle is NULL. Already deinitialized?");
         return;
     }
+
+    // Drop tagged requests so no callback runs during teardown
+    furi_timer_stop(fhttp->get_timeout_timer);
+    if (fhttp->pending_mutex)
+    {
+        furi_mutex_acquire(fhttp->pending_mutex, FuriWaitForever);
+        fhttp->pending_count = 0;
+        furi_mutex_release(fhttp->pending_mutex);
+    }
+    fhttp->started_receiving = false;
+
+    // Put the board back in text mode for the next connection
+    if (fhttp->framed)
+    {
+        flipper_http_send_data(fhttp, "[FRAME/OFF]");
+        furi_hal_serial_tx_wait_complete(fhttp->serial_handle);
+    }
+
+    // and at the connect rate. The board keeps a new rate only once a PING
+    // confirms it, so the step down goes through the same handshake as a
+    // step up; a bare [BAUD] would be dropped after BAUD_REVERT_MS.
+    if (fhttp->baudrate != BAUDRATE && !flipper_http_set_baudrate(fhttp, BAUDRATE))
+    {
+        FURI_LOG_E(HTTP_TAG, "Board left at %lu baud.", (unsigned long)fhttp->baudrate);
+    }
     // Stop asynchronous RX
     furi_hal_serial_async_rx_stop(fhttp->serial_handle);
 
@@ -386,6 +638,13 @@ void flipper_http_free(FlipperHTTP *fhttp)
         fhttp->last_response = NULL;
     }
 
+    // Free the tagged request mutex
+    if (fhttp->pending_mutex)
+    {
+        furi_mutex_free(fhttp->pending_mutex);
+        fhttp->pending_mutex = NULL;
+    }
+
     // Free the FlipperHTTP context
     free(fhttp);
     fhttp = NULL;
@@ -465,215 +724,286 @@ bool flipper_http_append_to_file(
  * @brief      Load data from a file.
  * @return     The loaded data as a FuriString.
  * @param      file_path The path to the file to load.
+ * @note       Only the first MAX_FILE_SHOW bytes are loaded.
  */
 FuriString *flipper_http_load_from_file(char *file_path)
 {
-    // Open the storage record
-    Storage *storage = furi_record_open(RECORD_STORAGE);
-    if (!storage)
+    uint8_t chunk_buf[256];
+    FlipperHTTPFileIter it;
+    if (!flipper_http_iter_open(&it, file_path, chunk_buf, sizeof(chunk_buf)))
     {
-        FURI_LOG_E(HTTP_TAG, "Failed to open storage record");
+        flipper_http_iter_close(&it);
         return NULL;
     }
 
-    // Allocate a file handle
-    File *file = storage_file_alloc(storage);
-    if (!file)
+    FuriString *str_result = furi_string_alloc();
+    const uint8_t *chunk;
+    size_t n;
+    while (furi_string_size(str_result) < MAX_FILE_SHOW && (n = flipper_http_iter_next_chunk(&it, &chunk)) > 0)
     {
-        FURI_LOG_E(HTTP_TAG, "Failed to allocate storage file");
-        furi_record_close(RECORD_STORAGE);
+        size_t room = MAX_FILE_SHOW - furi_string_size(str_result);
+        for (size_t i = 0; i < n && i < room; i++)
+        {
+            furi_string_push_back(str_result, (char)chunk[i]);
+        }
+    }
+    bool error = it.error;
+    flipper_http_iter_close(&it);
+    if (error)
+    {
+        FURI_LOG_E(HTTP_TAG, "Error reading from file.");
+        furi_string_free(str_result);
         return NULL;
     }
+    return str_result;
+}
 
-    // Open the file for reading
-    if (!storage_file_open(file, file_path, FSAM_READ, FSOM_OPEN_EXISTING))
+/**
+ * @brief      Load data from a file with a size limit.
+ * @return     The loaded data as a FuriString.
+ * @param      file_path The path to the file to load.
+ * @param      limit     The size limit for loading data.
+ * @note       The file streams into the string in chunks, so the only large
+ *             allocation is the string itself.
+ */
+FuriString *flipper_http_load_from_file_with_limit(char *file_path, size_t limit)
+{
+    uint8_t chunk_buf[256];
+    FlipperHTTPFileIter it;
+    if (!flipper_http_iter_open(&it, file_path, chunk_buf, sizeof(chunk_buf)))
     {
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
-        FURI_LOG_E(HTTP_TAG, "Failed to open file for reading: %s", file_path);
+        flipper_http_iter_close(&it);
         return NULL;
     }
 
-    size_t file_size = storage_file_size(file);
-
-    // final memory check
-    if (memmgr_heap_get_max_free_block() < file_size)
+    size_t file_size = storage_file_size(it.file);
+    if (file_size > limit)
     {
-        FURI_LOG_E(HTTP_TAG, "Not enough heap to read file.");
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
+        FURI_LOG_E(HTTP_TAG, "File size exceeds limit: %d > %d", file_size, limit);
+        flipper_http_iter_close(&it);
         return NULL;
     }
-
-    // Allocate a buffer to hold the read data
-    uint8_t *buffer = (uint8_t *)malloc(file_size);
-    if (!buffer)
+    if (file_size == 0)
     {
-        FURI_LOG_E(HTTP_TAG, "Failed to allocate buffer");
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
+        FURI_LOG_E(HTTP_TAG, "No data read from file.");
+        flipper_http_iter_close(&it);
         return NULL;
     }
 
-    // Allocate a FuriString to hold the received data
-    FuriString *str_result = furi_string_alloc();
-    if (!str_result)
+    // final memory check
+    if (memmgr_heap_get_max_free_block() < file_size + 1)
     {
-        FURI_LOG_E(HTTP_TAG, "Failed to allocate FuriString");
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
+        FURI_LOG_E(HTTP_TAG, "Not enough heap to read file.");
+        flipper_http_iter_close(&it);
         return NULL;
     }
 
-    // Reset the FuriString to ensure it's empty before reading
-    furi_string_reset(str_result);
-
-    // Read data into the buffer
-    size_t read_count = storage_file_read(file, buffer, MAX_FILE_SHOW);
-    if (storage_file_get_error(file) != FSE_OK)
+    FuriString *str_result = furi_string_alloc();
+    furi_string_reserve(str_result, file_size + 1);
+    const uint8_t *chunk;
+    size_t n;
+    while ((n = flipper_http_iter_next_chunk(&it, &chunk)) > 0)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            furi_string_push_back(str_result, (char)chunk[i]);
+        }
+    }
+    bool error = it.error;
+    flipper_http_iter_close(&it);
+    if (error)
     {
         FURI_LOG_E(HTTP_TAG, "Error reading from file.");
         furi_string_free(str_result);
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
         return NULL;
     }
-
-    // Append each byte to the FuriString
-    for (size_t i = 0; i < read_count; i++)
-    {
-        furi_string_push_back(str_result, buffer[i]);
-    }
-
-    // Clean up
-    storage_file_close(file);
-    storage_file_free(file);
-    furi_record_close(RECORD_STORAGE);
-    free(buffer);
     return str_result;
 }
 
 /**
- * @brief      Load data from a file with a size limit.
- * @return     The loaded data as a FuriString.
- * @param      file_path The path to the file to load.
- * @param      limit     The size limit for loading data.
+ * @brief      Open a file for reading in chunks or lines.
+ * @return     true if the file was opened, false otherwise.
+ * @param      it          The iterator to initialize.
+ * @param      file_path   The path to the file.
+ * @param      buffer      The buffer every chunk or line is read into.
+ * @param      buffer_size The size of the buffer; also the longest line returned whole.
+ * @note       Memory use is the caller's buffer whatever the file size. Close with
+ *             flipper_http_iter_close, also after a failed open.
  */
-FuriString *flipper_http_load_from_file_with_limit(char *file_path, size_t limit)
+bool flipper_http_iter_open(FlipperHTTPFileIter *it, const char *file_path, void *buffer, size_t buffer_size)
 {
-    if (memmgr_heap_get_max_free_block() < limit)
+    if (!it)
     {
-        FURI_LOG_E(HTTP_TAG, "Not enough heap to read file.");
-        return NULL;
+        FURI_LOG_E(HTTP_TAG, "Invalid arguments provided to flipper_http_iter_open.");
+        return false;
     }
-
-    // Open the storage record
-    Storage *storage = furi_record_open(RECORD_STORAGE);
-    if (!storage)
+    memset(it, 0, sizeof(*it));
+    if (!file_path || !buffer || buffer_size < 2)
     {
-        FURI_LOG_E(HTTP_TAG, "Failed to open storage record");
-        return NULL;
+        FURI_LOG_E(HTTP_TAG, "Invalid arguments provided to flipper_http_iter_open.");
+        return false;
     }
+    it->buf = (uint8_t *)buffer;
+    it->buf_size = buffer_size;
 
-    // Allocate a file handle
-    File *file = storage_file_alloc(storage);
-    if (!file)
+    it->storage = furi_record_open(RECORD_STORAGE);
+    it->file = storage_file_alloc(it->storage);
+    if (!storage_file_open(it->file, file_path, FSAM_READ, FSOM_OPEN_EXISTING))
     {
-        FURI_LOG_E(HTTP_TAG, "Failed to allocate storage file");
-        furi_record_close(RECORD_STORAGE);
-        return NULL;
+        FURI_LOG_E(HTTP_TAG, "Failed to open file for reading: %s", file_path);
+        return false;
     }
+    return true;
+}
 
-    // Open the file for reading
-    if (!storage_file_open(file, file_path, FSAM_READ, FSOM_OPEN_EXISTING))
+/**
+ * @brief      Read more of the file into the free end of the buffer.
+ * @return     The number of bytes read.
+ * @param      it The iterator.
+ */
+static size_t flipper_http_iter_fill(FlipperHTTPFileIter *it)
+{
+    if (it->eof || it->error || !it->file || it->len >= it->buf_size)
     {
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
-        FURI_LOG_E(HTTP_TAG, "Failed to open file for reading: %s", file_path);
-        return NULL;
+        return 0;
     }
-
-    size_t file_size = storage_file_size(file);
-
-    if (file_size > limit)
+    size_t n = storage_file_read(it->file, it->buf + it->len, it->buf_size - it->len);
+    if (storage_file_get_error(it->file) != FSE_OK)
     {
-        FURI_LOG_E(HTTP_TAG, "File size exceeds limit: %d > %d", file_size, limit);
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
-        return NULL;
+        it->error = true;
+        return 0;
     }
-
-    // final memory check
-    if (memmgr_heap_get_max_free_block() < file_size)
+    if (n == 0)
     {
-        FURI_LOG_E(HTTP_TAG, "Not enough heap to read file.");
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
-        return NULL;
+        it->eof = true;
     }
+    it->len += n;
+    return n;
+}
 
-    // Allocate a buffer to hold the read data
-    uint8_t *buffer = (uint8_t *)malloc(file_size);
-    if (!buffer)
+/**
+ * @brief      Read the next chunk of the file.
+ * @return     The number of bytes in the chunk, 0 at the end of the file or on error.
+ * @param      it    The iterator.
+ * @param      chunk Set to the chunk, which stays valid until the next call.
+ */
+size_t flipper_http_iter_next_chunk(FlipperHTTPFileIter *it, const uint8_t **chunk)
+{
+    if (!it || !chunk)
     {
-        FURI_LOG_E(HTTP_TAG, "Failed to allocate buffer");
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
-        return NULL;
+        return 0;
     }
+    it->offset += it->len;
+    it->len = 0;
+    it->pos = 0;
+    size_t n = flipper_http_iter_fill(it);
+    it->pos = it->len;
+    *chunk = it->buf;
+    return n;
+}
 
-    // Allocate a FuriString with preallocated capacity
-    FuriString *str_result = furi_string_alloc();
-    if (!str_result)
+/**
+ * @brief      Read the next line of the file.
+ * @return     true if a line was read, false at the end of the file or on error.
+ * @param      it   The iterator.
+ * @param      line Set to the NUL-terminated line without its "\n" or "\r\n".
+ * @param      len  Set to the length of the line.
+ * @note       A line longer than buffer_size - 1 comes back in pieces. Do not mix with
+ *             flipper_http_iter_next_chunk on one iterator.
+ */
+bool flipper_http_iter_next_line(FlipperHTTPFileIter *it, const char **line, size_t *len)
+{
+    if (!it || !line || !len)
     {
-        FURI_LOG_E(HTTP_TAG, "Failed to allocate FuriString");
-        free(buffer);
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
-        return NULL;
+        return false;
     }
-    furi_string_reserve(str_result, file_size);
+    for (;;)
+    {
+        if (it->held)
+        {
+            it->buf[it->pos] = it->hold;
+            it->held = false;
+        }
+        uint8_t *start = it->buf + it->pos;
+        size_t avail = it->len - it->pos;
+        if (it->split_cr && (avail >= 2 || it->eof || it->error))
+        {
+            // The piece split off before this "\r" already ended its line;
+            // a "\r\n" here, or a lone "\r" ending the file, is only the
+            // terminator and not an empty line
+            it->split_cr = false;
+            if (avail >= 2 ? start[1] == '\n' : it->eof)
+            {
+                it->pos += MIN(avail, 2);
+                continue;
+            }
+        }
+        uint8_t *nl = it->split_cr ? NULL : memchr(start, '\n', avail);
+        if (nl)
+        {
+            size_t n = (size_t)(nl - start);
+            it->pos += n + 1;
+            if (n > 0 && start[n - 1] == '\r')
+            {
+                n--;
+            }
+            start[n] = '\0';
+            *line = (const char *)start;
+            *len = n;
+            return true;
+        }
+        if (!it->split_cr && it->pos == 0 && (avail >= it->buf_size - 1 || (it->eof && avail > 0)))
+        {
+            // The last line, or a piece of one too long for the buffer;
+            // a full buffer lends its last byte to the terminator
+            size_t n = MIN(avail, it->buf_size - 1);
+            if (n < avail)
+            {
+                it->hold = start[n];
+                it->held = true;
+                it->split_cr = it->hold == '\r';
+            }
+            it->pos = n;
+            start[n] = '\0';
+            *line = (const char *)start;
+            *len = n;
+            return true;
+        }
+        if (it->error || (it->eof && avail == 0))
+        {
+            return false;
+        }
+        // Keep the partial line at the front and read behind it
+        if (it->pos > 0)
+        {
+            memmove(it->buf, start, avail);
+            it->offset += it->pos;
+            it->len = avail;
+            it->pos = 0;
+        }
+        flipper_http_iter_fill(it);
+    }
+}
 
-    // Read data into the buffer
-    size_t read_count = storage_file_read(file, buffer, file_size);
-    if (storage_file_get_error(file) != FSE_OK)
+/**
+ * @brief      Close the file and release the storage record.
+ * @return     void
+ * @param      it The iterator.
+ */
+void flipper_http_iter_close(FlipperHTTPFileIter *it)
+{
+    if (!it || !it->storage)
     {
-        FURI_LOG_E(HTTP_TAG, "Error reading from file.");
-        furi_string_free(str_result);
-        free(buffer);
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
-        return NULL;
+        return;
     }
-    if (read_count == 0)
+    if (it->file)
     {
-        FURI_LOG_E(HTTP_TAG, "No data read from file.");
-        furi_string_free(str_result);
-        free(buffer);
-        storage_file_close(file);
-        storage_file_free(file);
-        furi_record_close(RECORD_STORAGE);
-        return NULL;
+        storage_file_close(it->file);
+        storage_file_free(it->file);
+        it->file = NULL;
     }
-
-    // Append the entire buffer to FuriString in one operation
-    furi_string_cat_str(str_result, (char *)buffer);
-
-    // Clean up
-    storage_file_close(file);
-    storage_file_free(file);
     furi_record_close(RECORD_STORAGE);
-    free(buffer);
-    return str_result;
+    it->storage = NULL;
 }
 
 /**
@@ -849,6 +1179,190 @@ bool flipper_http_process_response_async(FlipperHTTP *fhttp, bool (*http_request
     return true;
 }
 
+/**
+ * @brief      Send a PING and wait for the PONG.
+ * @return     true if the board answered in time.
+ * @param      fhttp The FlipperHTTP context
+ * @param      timeout_ms How long to wait.
+ */
+static bool flipper_http_ping_wait(FlipperHTTP *fhttp, uint32_t timeout_ms)
+{
+    if (!flipper_http_send_data(fhttp, "[PING]"))
+    {
+        return false;
+    }
+    // INACTIVE until the rx callback sees [PONG]
+    fhttp->state = INACTIVE;
+    for (uint32_t waited = 0; waited < timeout_ms; waited += 50)
+    {
+        furi_delay_ms(50);
+        if (fhttp->state == IDLE)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief      Switch both ends of the UART to another rate.
+ * @return     true if the board confirmed the rate, false if it still runs at the old one.
+ * @param      fhttp The FlipperHTTP context
+ * @param      baudrate The rate to switch to.
+ * @note       Sends [BAUD]<rate> and waits for [BAUD/OK], then changes the local rate and
+ *             checks it with a PING. Without a PONG the Flipper goes back to the old rate
+ *             and waits BAUD_REVERT_MS, after which the board has dropped the new one too.
+ *             Refused while requests are in flight.
+ */
+bool flipper_http_set_baudrate(FlipperHTTP *fhttp, uint32_t baudrate)
+{
+    if (!fhttp)
+    {
+        FURI_LOG_E(HTTP_TAG, "Failed to get context.");
+        return false;
+    }
+    if (baudrate == fhttp->baudrate)
+    {
+        return true;
+    }
+    if (fhttp->started_receiving || flipper_http_pending_count(fhttp) > 0)
+    {
+        FURI_LOG_E(HTTP_TAG, "Cannot change the baudrate while receiving.");
+        return false;
+    }
+
+    char command[32];
+    snprintf(command, sizeof(command), "[BAUD]%lu", (unsigned long)baudrate);
+    HTTPState state = fhttp->state;
+    fhttp->baud_ack = false;
+    if (!flipper_http_send_data(fhttp, command))
+    {
+        return false;
+    }
+    for (uint8_t i = 0; i < 10 && !fhttp->baud_ack; i++)
+    {
+        furi_delay_ms(50);
+    }
+    if (!fhttp->baud_ack)
+    {
+        // Refused ([ERROR]) or unknown to the firmware; nothing changed
+        fhttp->state = state;
+        return false;
+    }
+
+    uint32_t old = fhttp->baudrate;
+    furi_hal_serial_tx_wait_complete(fhttp->serial_handle);
+    furi_hal_serial_set_br(fhttp->serial_handle, baudrate);
+    fhttp->baudrate = baudrate;
+    if (flipper_http_ping_wait(fhttp, 500))
+    {
+        return true;
+    }
+
+    FURI_LOG_E(HTTP_TAG, "No PONG at %lu baud, falling back.", (unsigned long)baudrate);
+    furi_hal_serial_set_br(fhttp->serial_handle, old);
+    fhttp->baudrate = old;
+    furi_delay_ms(BAUD_REVERT_MS);
+    if (!flipper_http_ping_wait(fhttp, 500))
+    {
+        FURI_LOG_E(HTTP_TAG, "No PONG after falling back.");
+    }
+    return false;
+}
+
+/**
+ * @brief      Step the UART up to the fastest rate the link carries.
+ * @return     The rate in use afterwards.
+ * @param      fhttp The FlipperHTTP context
+ * @param      preferred The last rate known to work, tried first; 0 for none.
+ * @note       Steps through 230400, 460800 and 921600 and stops at the first rate that fails.
+ *             A remembered rate caps the search, so a link that failed above it is not retried.
+ */
+uint32_t flipper_http_negotiate_baudrate(FlipperHTTP *fhttp, uint32_t preferred)
+{
+    static const uint32_t rates[] = {230400, 460800, 921600};
+    if (!fhttp)
+    {
+        FURI_LOG_E(HTTP_TAG, "Failed to get context.");
+        return 0;
+    }
+    if (preferred > fhttp->baudrate && flipper_http_set_baudrate(fhttp, preferred))
+    {
+        return fhttp->baudrate;
+    }
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++)
+    {
+        if (rates[i] <= fhttp->baudrate)
+        {
+            continue;
+        }
+        if (preferred && rates[i] >= preferred)
+        {
+            break;
+        }
+        if (!flipper_http_set_baudrate(fhttp, rates[i]))
+        {
+            break;
+        }
+    }
+    return fhttp->baudrate;
+}
+
+/**
+ * @brief      Change only the Flipper side of the UART.
+ * @return     void
+ * @param      fhttp The FlipperHTTP context
+ * @param      baudrate The rate to listen and send at.
+ * @note       For finding a board that was left at another rate; nothing is sent.
+ */
+void flipper_http_resync_baudrate(FlipperHTTP *fhttp, uint32_t baudrate)
+{
+    if (!fhttp || baudrate == fhttp->baudrate)
+    {
+        return;
+    }
+    furi_hal_serial_tx_wait_complete(fhttp->serial_handle);
+    furi_hal_serial_set_br(fhttp->serial_handle, baudrate);
+    fhttp->baudrate = baudrate;
+}
+
+/**
+ * @brief      Ask the board to send length-prefixed frames instead of text lines.
+ * @return     true if the board switched to framed mode, false to stay in text mode.
+ * @param      fhttp The FlipperHTTP context
+ * @note       Sent once per connection; firmware without framing answers [ERROR] or nothing.
+ *             Commands to the board stay text lines in both modes.
+ */
+bool flipper_http_frame_negotiate(FlipperHTTP *fhttp)
+{
+    if (!fhttp)
+    {
+        FURI_LOG_E(HTTP_TAG, "Failed to get context.");
+        return false;
+    }
+    if (fhttp->framed || fhttp->frame_tried)
+    {
+        return fhttp->framed;
+    }
+    fhttp->frame_tried = true;
+    HTTPState state = fhttp->state;
+    if (!flipper_http_send_data(fhttp, "[FRAME/ON]"))
+    {
+        return false;
+    }
+    // The rx callback switches modes on the [FRAME/OK] line
+    for (uint8_t i = 0; i < 10 && !fhttp->framed; i++)
+    {
+        furi_delay_ms(50);
+    }
+    if (!fhttp->framed)
+    {
+        // An unknown command is an [ERROR]; the connection itself is fine
+        fhttp->state = state;
+    }
+    return fhttp->framed;
+}
+
 /**
  * @brief      Send a request to the specified URL.
  * @return     true if the request was successful, false otherwise.
@@ -954,6 +1468,119 @@ bool flipper_http_request(FlipperHTTP *fhttp, HTTPMethod method, const char *url
     return flipper_http_send_data(fhttp, command);
 }
 
+/**
+ * @brief      Send a request without waiting for the response.
+ * @return     The correlation id of the request, or 0 if it could not be sent.
+ * @param      fhttp The FlipperHTTP context
+ * @param      method The HTTP method to use (GET, POST, PUT or DELETE).
+ * @param      url  The URL to send the request to.
+ * @param      headers  The headers to send with the request.
+ * @param      payload  The data to send with the request.
+ * @param      callback The function to call with the response.
+ * @param      context  The context passed to the callback.
+ * @note       The board answers commands in the order it reads them, so responses are
+ *             matched to requests first-in, first-out.
+ */
+uint16_t flipper_http_request_tagged(FlipperHTTP *fhttp, HTTPMethod method, const char *url, const char *headers, const char *payload, FlipperHTTP_ResponseCallback callback, void *context)
+{
+    if (!fhttp || !fhttp->pending_mutex)
+    {
+        FURI_LOG_E(HTTP_TAG, "Failed to get context.");
+        return 0;
+    }
+    if (!callback || method == BYTES || method == BYTES_POST)
+    {
+        // Byte streams share one file path, so they stay untagged
+        FURI_LOG_E("FlipperHTTP", "Invalid arguments provided to flipper_http_request_tagged.");
+        return 0;
+    }
+
+    // Hold the queue across the send so a response can't complete the
+    // request before it is recorded
+    furi_mutex_acquire(fhttp->pending_mutex, FuriWaitForever);
+    if (fhttp->pending_count >= FHTTP_MAX_INFLIGHT)
+    {
+        furi_mutex_release(fhttp->pending_mutex);
+        FURI_LOG_E("FlipperHTTP", "Too many requests in flight.");
+        return 0;
+    }
+    if (++fhttp->next_id == 0)
+    {
+        fhttp->next_id = 1;
+    }
+    uint16_t id = fhttp->next_id;
+    uint8_t slot = (fhttp->pending_head + fhttp->pending_count) % FHTTP_MAX_INFLIGHT;
+    fhttp->pending[slot].id = id;
+    fhttp->pending[slot].method = method;
+    fhttp->pending[slot].callback = callback;
+    fhttp->pending[slot].context = context;
+    fhttp->pending_count++;
+
+    HTTPMethod current = fhttp->method;
+    fhttp->save_received_data = false;
+    bool sent = flipper_http_request(fhttp, method, url, headers, payload);
+    if (!sent)
+    {
+        fhttp->pending_count--;
+        id = 0;
+    }
+    if (fhttp->pending_count > 1 || (!sent && fhttp->pending_count > 0))
+    {
+        // The response being received belongs to an older request
+        fhttp->method = current;
+    }
+    else if (sent)
+    {
+        // Time the response from now so a silent board can't wedge the queue
+        furi_timer_restart(fhttp->get_timeout_timer, TIMEOUT_DURATION_TICKS);
+    }
+    furi_mutex_release(fhttp->pending_mutex);
+    return id;
+}
+
+/**
+ * @brief      Drop the callback of a tagged request.
+ * @return     void
+ * @param      fhttp The FlipperHTTP context
+ * @param      id   The correlation id returned by flipper_http_request_tagged.
+ * @note       The request keeps its place in the queue so later responses still match.
+ */
+void flipper_http_cancel(FlipperHTTP *fhttp, uint16_t id)
+{
+    if (!fhttp || !fhttp->pending_mutex || id == 0)
+    {
+        return;
+    }
+    furi_mutex_acquire(fhttp->pending_mutex, FuriWaitForever);
+    for (uint8_t i = 0; i < fhttp->pending_count; i++)
+    {
+        FlipperHTTPPending *p = &fhttp->pending[(fhttp->pending_head + i) % FHTTP_MAX_INFLIGHT];
+        if (p->id == id)
+        {
+            p->callback = NULL;
+            break;
+        }
+    }
+    furi_mutex_release(fhttp->pending_mutex);
+}
+
+/**
+ * @brief      Count the tagged requests still waiting for a response.
+ * @return     The number of tagged requests in flight.
+ * @param      fhttp The FlipperHTTP context
+ */
+uint8_t flipper_http_pending_count(FlipperHTTP *fhttp)
+{
+    if (!fhttp || !fhttp->pending_mutex)
+    {
+        return 0;
+    }
+    furi_mutex_acquire(fhttp->pending_mutex, FuriWaitForever);
+    uint8_t count = fhttp->pending_count;
+    furi_mutex_release(fhttp->pending_mutex);
+    return count;
+}
+
 /**
  * @brief      Send a command to save WiFi settings.
  * @return     true if the request was successful, false otherwise.
@@ -1079,7 +1706,7 @@ bool flipper_http_send_data(FlipperHTTP *fhttp, const char *data)
                                      (strstr(send_buffer, "[WIFI/CONNECT]") == NULL)))
     {
         FURI_LOG_E("FlipperHTTP", "Cannot send data while INACTIVE.");
-        fhttp->last_response = "Cannot send data while INACTIVE.";
+        snprintf(fhttp->last_response, RX_BUF_SIZE, "Cannot send data while INACTIVE.");
         return false;
     }
 
@@ -1230,10 +1857,12 @@ static void flipper_http_rx_callback(const char *line, void *context)
     if (trimmed_line != NULL && trimmed_line[0] != '\0')
     {
         // if the line is not [GET/END] or [POST/END] or [PUT/END] or [DELETE/END]
-        if (strstr(trimmed_line, "[GET/END]") == NULL &&
-            strstr(trimmed_line, "[POST/END]") == NULL &&
-            strstr(trimmed_line, "[PUT/END]") == NULL &&
-            strstr(trimmed_line, "[DELETE/END]") == NULL)
+        // (framed mode ends responses with FRAME_END, never with a marker line)
+        if (fhttp->framed ||
+            (strstr(trimmed_line, "[GET/END]") == NULL &&
+             strstr(trimmed_line, "[POST/END]") == NULL &&
+             strstr(trimmed_line, "[PUT/END]") == NULL &&
+             strstr(trimmed_line, "[DELETE/END]") == NULL))
         {
             strncpy(fhttp->last_response, trimmed_line, RX_BUF_SIZE);
         }
@@ -1254,7 +1883,7 @@ static void flipper_http_rx_callback(const char *line, void *context)
         // Restart the timeout timer each time new data is received
         furi_timer_restart(fhttp->get_timeout_timer, TIMEOUT_DURATION_TICKS);
 
-        if (strstr(line, "[GET/END]") != NULL)
+        if (!fhttp->framed && strstr(line, "[GET/END]") != NULL)
         {
             // FURI_LOG_I(HTTP_TAG, "GET request completed.");
             //  Stop the timer since we've completed the GET request
@@ -1296,6 +1925,7 @@ static void flipper_http_rx_callback(const char *line, void *context)
             }
 
             fhttp->is_bytes_request = false;
+            flipper_http_pending_finish(fhttp, true, false);
             return;
         }
 
@@ -1324,7 +1954,7 @@ static void flipper_http_rx_callback(const char *line, void *context)
         // Restart the timeout timer each time new data is received
         furi_timer_restart(fhttp->get_timeout_timer, TIMEOUT_DURATION_TICKS);
 
-        if (strstr(line, "[POST/END]") != NULL)
+        if (!fhttp->framed && strstr(line, "[POST/END]") != NULL)
         {
             // FURI_LOG_I(HTTP_TAG, "POST request completed.");
             //  Stop the timer since we've completed the POST request
@@ -1366,6 +1996,7 @@ static void flipper_http_rx_callback(const char *line, void *context)
             }
 
             fhttp->is_bytes_request = false;
+            flipper_http_pending_finish(fhttp, true, false);
             return;
         }
 
@@ -1394,7 +2025,7 @@ static void flipper_http_rx_callback(const char *line, void *context)
         // Restart the timeout timer each time new data is received
         furi_timer_restart(fhttp->get_timeout_timer, TIMEOUT_DURATION_TICKS);
 
-        if (strstr(line, "[PUT/END]") != NULL)
+        if (!fhttp->framed && strstr(line, "[PUT/END]") != NULL)
         {
             // FURI_LOG_I(HTTP_TAG, "PUT request completed.");
             //  Stop the timer since we've completed the PUT request
@@ -1405,6 +2036,7 @@ static void flipper_http_rx_callback(const char *line, void *context)
             fhttp->save_bytes = false;
             fhttp->is_bytes_request = false;
             fhttp->save_received_data = false;
+            flipper_http_pending_finish(fhttp, true, false);
             return;
         }
 
@@ -1433,7 +2065,7 @@ static void flipper_http_rx_callback(const char *line, void *context)
         // Restart the timeout timer each time new data is received
         furi_timer_restart(fhttp->get_timeout_timer, TIMEOUT_DURATION_TICKS);
 
-        if (strstr(line, "[DELETE/END]") != NULL)
+        if (!fhttp->framed && strstr(line, "[DELETE/END]") != NULL)
         {
             // FURI_LOG_I(HTTP_TAG, "DELETE request completed.");
             //  Stop the timer since we've completed the DELETE request
@@ -1444,6 +2076,7 @@ static void flipper_http_rx_callback(const char *line, void *context)
             fhttp->save_bytes = false;
             fhttp->is_bytes_request = false;
             fhttp->save_received_data = false;
+            flipper_http_pending_finish(fhttp, true, false);
             return;
         }
 
@@ -1538,6 +2171,20 @@ static void flipper_http_rx_callback(const char *line, void *context)
         set_header(fhttp);
         return;
     }
+    else if (strstr(line, "[FRAME/OK]") != NULL)
+    {
+        // Everything after this line arrives in frames
+        fhttp->framed = true;
+        fhttp->frame_state = FRAME_HUNT;
+    }
+    else if (strstr(line, "[FRAME/OFF]") != NULL)
+    {
+        fhttp->framed = false;
+    }
+    else if (strstr(line, "[BAUD/OK]") != NULL)
+    {
+        fhttp->baud_ack = true;
+    }
     else if (strstr(line, "[DISCONNECTED]") != NULL)
     {
         // FURI_LOG_I(HTTP_TAG, "WiFi disconnected successfully.");
@@ -1546,6 +2193,7 @@ static void flipper_http_rx_callback(const char *line, void *context)
     {
         FURI_LOG_E(HTTP_TAG, "Received error: %s", line);
         fhttp->state = ISSUE;
+        flipper_http_pending_finish(fhttp, false, false);
         return;
     }
     else if (strstr(line, "[PONG]") != NULL)
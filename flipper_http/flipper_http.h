@@ -23,15 +23,23 @@ extern "C"
 #define http_tag "hello_world"            // change this to your app id
 #define UART_CH (FuriHalSerialIdUsart)    // UART channel
 #define TIMEOUT_DURATION_TICKS (5 * 1000) // 5 seconds
-#define BAUDRATE (115200)                 // UART baudrate
+#define BAUDRATE (115200)                 // UART baudrate at connect; see flipper_http_negotiate_baudrate
+#define BAUD_REVERT_MS 600                // Silence after which the board drops an unconfirmed rate
 #define RX_BUF_SIZE 2048                  // UART RX buffer size
 #define RX_LINE_BUFFER_SIZE 2048          // UART RX line buffer size (increase for large responses)
 #define MAX_FILE_SHOW 2048                // Maximum data from file to show
 #define FILE_BUFFER_SIZE 512              // File buffer size
+#define FHTTP_MAX_INFLIGHT 4              // Tagged requests queued on the board at once
+#define FRAME_SOF 0xA5                    // First byte of every frame in framed mode
 
     // Forward declaration for callback
     typedef void (*FlipperHTTP_Callback)(const char *line, void *context);
 
+    // Completion of a tagged request. Runs on the RX thread (or the timer
+    // thread on timeout); response is the last body line and is only
+    // valid during the call. ok is false on timeout or [ERROR].
+    typedef void (*FlipperHTTP_ResponseCallback)(uint16_t id, bool ok, const char *response, void *context);
+
     // State variable to track the UART state
     typedef enum
     {
@@ -78,6 +86,41 @@ extern "C"
         HTTP_CMD_WIFI_LIST,       // [WIFI/LIST] - list saved WiFi networks
     } HTTPCommand;                // list of non-input commands
 
+    // Frame types sent by the board in framed mode. A frame is
+    // SOF, type, u16 length (LE), payload, CRC-16/CCITT (LE) over type, length and payload.
+    typedef enum
+    {
+        FRAME_LINE = 0x01, // One text line, handled like a line in text mode
+        FRAME_DATA = 0x02, // Raw response bytes, saved to the file of a bytes request
+        FRAME_END = 0x03,  // End of the current response (replaces the [*/END] markers)
+    } FrameType;
+
+    // Reads a saved response file a buffer at a time; see flipper_http_iter_open
+    typedef struct
+    {
+        Storage *storage; // Storage record, held while the file is open
+        File *file;       // The open file
+        uint8_t *buf;     // Caller's buffer, reused for every chunk or line
+        size_t buf_size;  // Size of the buffer
+        size_t len;       // Bytes of the file currently in the buffer
+        size_t pos;       // Next unread byte in the buffer
+        size_t offset;    // File offset of buf[0]
+        bool eof;         // The file has been read to its end
+        bool error;       // A read failed; iteration stopped early
+        bool held;        // hold belongs at buf[pos] (a long line was split there)
+        uint8_t hold;     // Byte the split line's terminator replaced
+        bool split_cr;    // The split fell on a '\r'; a "\r\n" there ends the line
+    } FlipperHTTPFileIter;
+
+    // One outstanding tagged request
+    typedef struct
+    {
+        uint16_t id;                           // Correlation id, never 0
+        HTTPMethod method;                     // Method, restored when its response starts
+        FlipperHTTP_ResponseCallback callback; // NULL once cancelled
+        void *context;                         // Context for the callback
+    } FlipperHTTPPending;
+
     // FlipperHTTP Structure
     typedef struct
     {
@@ -104,6 +147,22 @@ extern "C"
         size_t file_buffer_len;                   // Length of the file buffer
         size_t content_length;                    // Length of the content received
         int status_code;                          // HTTP status code
+        FlipperHTTPPending pending[FHTTP_MAX_INFLIGHT]; // Ring of tagged requests, oldest first
+        uint8_t pending_head;                     // Index of the oldest tagged request
+        uint8_t pending_count;                    // Number of tagged requests in flight
+        uint16_t next_id;                         // Last correlation id handed out
+        FuriMutex *pending_mutex;                 // Guards the ring across RX, timer and app threads
+        bool framed;                              // The board sends frames instead of lines
+        bool frame_tried;                         // [FRAME/ON] was sent on this connection
+        uint8_t frame_state;                      // Frame decoder position
+        uint8_t frame_type;                       // Type of the frame being received
+        uint16_t frame_len;                       // Payload length of the frame being received
+        uint16_t frame_pos;                       // Payload bytes received so far
+        uint16_t frame_crc;                       // CRC over the frame so far
+        uint16_t frame_rx_crc;                    // CRC sent with the frame
+        uint32_t frame_errors;                    // Frames dropped for a bad length or CRC
+        uint32_t baudrate;                        // Current UART rate on the Flipper side
+        bool baud_ack;                            // [BAUD/OK] seen since the last [BAUD] command
     } FlipperHTTP;
 
     /**
@@ -118,6 +177,8 @@ extern "C"
      * @return     void
      * @param fhttp The FlipperHTTP context
      * @note       This function will stop the asynchronous RX, release the serial handle, and free the resources.
+     *             A board switched to framed mode or another rate is put back in text mode at
+     *             BAUDRATE first, the rate confirmed with a PING as flipper_http_set_baudrate does.
      */
     void flipper_http_free(FlipperHTTP *fhttp);
 
@@ -147,6 +208,44 @@ extern "C"
      */
     FuriString *flipper_http_load_from_file_with_limit(char *file_path, size_t limit);
 
+    /**
+     * @brief      Open a file for reading in chunks or lines.
+     * @return     true if the file was opened, false otherwise.
+     * @param      it          The iterator to initialize.
+     * @param      file_path   The path to the file.
+     * @param      buffer      The buffer every chunk or line is read into.
+     * @param      buffer_size The size of the buffer; also the longest line returned whole.
+     * @note       Memory use is the caller's buffer whatever the file size. Close with
+     *             flipper_http_iter_close, also after a failed read.
+     */
+    bool flipper_http_iter_open(FlipperHTTPFileIter *it, const char *file_path, void *buffer, size_t buffer_size);
+
+    /**
+     * @brief      Read the next chunk of the file.
+     * @return     The number of bytes in the chunk, 0 at the end of the file or on error.
+     * @param      it    The iterator.
+     * @param      chunk Set to the chunk, which stays valid until the next call.
+     */
+    size_t flipper_http_iter_next_chunk(FlipperHTTPFileIter *it, const uint8_t **chunk);
+
+    /**
+     * @brief      Read the next line of the file.
+     * @return     true if a line was read, false at the end of the file or on error.
+     * @param      it   The iterator.
+     * @param      line Set to the NUL-terminated line without its "\n" or "\r\n".
+     * @param      len  Set to the length of the line.
+     * @note       A line longer than buffer_size - 1 comes back in pieces. Do not mix with
+     *             flipper_http_iter_next_chunk on one iterator.
+     */
+    bool flipper_http_iter_next_line(FlipperHTTPFileIter *it, const char **line, size_t *len);
+
+    /**
+     * @brief      Close the file and release the storage record.
+     * @return     void
+     * @param      it The iterator.
+     */
+    void flipper_http_iter_close(FlipperHTTPFileIter *it);
+
     /**
      * @brief Perform a task while displaying a loading screen
      * @param fhttp The FlipperHTTP context
@@ -194,6 +293,78 @@ extern "C"
      */
     bool flipper_http_process_response_async(FlipperHTTP *fhttp, bool (*http_request)(void), bool (*parse_json)(void));
 
+    /**
+     * @brief      Send a request without waiting for the response.
+     * @return     The correlation id of the request, or 0 if it could not be sent.
+     * @param      fhttp The FlipperHTTP context
+     * @param      method The HTTP method to use (GET, POST, PUT or DELETE).
+     * @param      url  The URL to send the request to.
+     * @param      headers  The headers to send with the request.
+     * @param      payload  The data to send with the request.
+     * @param      callback The function to call with the response.
+     * @param      context  The context passed to the callback.
+     * @note       The board answers commands in the order it reads them, so responses are
+     *             matched to requests first-in, first-out. A timeout loses that ordering and
+     *             fails every request still in flight.
+     */
+    uint16_t flipper_http_request_tagged(FlipperHTTP *fhttp, HTTPMethod method, const char *url, const char *headers, const char *payload, FlipperHTTP_ResponseCallback callback, void *context);
+
+    /**
+     * @brief      Drop the callback of a tagged request.
+     * @return     void
+     * @param      fhttp The FlipperHTTP context
+     * @param      id   The correlation id returned by flipper_http_request_tagged.
+     * @note       The request keeps its place in the queue so later responses still match.
+     */
+    void flipper_http_cancel(FlipperHTTP *fhttp, uint16_t id);
+
+    /**
+     * @brief      Count the tagged requests still waiting for a response.
+     * @return     The number of tagged requests in flight.
+     * @param      fhttp The FlipperHTTP context
+     */
+    uint8_t flipper_http_pending_count(FlipperHTTP *fhttp);
+
+    /**
+     * @brief      Switch both ends of the UART to another rate.
+     * @return     true if the board confirmed the rate, false if it still runs at the old one.
+     * @param      fhttp The FlipperHTTP context
+     * @param      baudrate The rate to switch to.
+     * @note       Sends [BAUD]<rate> and waits for [BAUD/OK], then changes the local rate and
+     *             checks it with a PING. Without a PONG the Flipper goes back to the old rate
+     *             and waits BAUD_REVERT_MS, after which the board has dropped the new one too.
+     *             Refused while requests are in flight.
+     */
+    bool flipper_http_set_baudrate(FlipperHTTP *fhttp, uint32_t baudrate);
+
+    /**
+     * @brief      Step the UART up to the fastest rate the link carries.
+     * @return     The rate in use afterwards.
+     * @param      fhttp The FlipperHTTP context
+     * @param      preferred The last rate known to work, tried first; 0 for none.
+     * @note       Steps through 230400, 460800 and 921600 and stops at the first rate that fails.
+     *             A remembered rate caps the search, so a link that failed above it is not retried.
+     */
+    uint32_t flipper_http_negotiate_baudrate(FlipperHTTP *fhttp, uint32_t preferred);
+
+    /**
+     * @brief      Change only the Flipper side of the UART.
+     * @return     void
+     * @param      fhttp The FlipperHTTP context
+     * @param      baudrate The rate to listen and send at.
+     * @note       For finding a board that was left at another rate; nothing is sent.
+     */
+    void flipper_http_resync_baudrate(FlipperHTTP *fhttp, uint32_t baudrate);
+
+    /**
+     * @brief      Ask the board to send length-prefixed frames instead of text lines.
+     * @return     true if the board switched to framed mode, false to stay in text mode.
+     * @param      fhttp The FlipperHTTP context
+     * @note       Sent once per connection; firmware without framing answers [ERROR] or nothing.
+     *             Commands to the board stay text lines in both modes.
+     */
+    bool flipper_http_frame_negotiate(FlipperHTTP *fhttp);
+
     /**
      * @brief      Send a request to the specified URL.
      * @return     true if the request was successful, false otherwise.
@@ -1,4 +1,6 @@
 #include <font/font.h>
+#include <stdlib.h>
+#include <string.h>
 
 static const uint8_t u8g2_font_4x6_tf[];
 static const uint8_t u8g2_font_6x10_tf[];
@@ -40,6 +42,303 @@ void canvas_draw_str_multi(Canvas *canvas, uint8_t x, uint8_t y, const char *str
     elements_multiline_text(canvas, x, y, str);
 }
 
+/*
+  Decoded glyph cache
+
+  u8g2 fonts are RLE bitstreams that u8g2 decodes on every draw. Here each
+  glyph is decoded once into an XBM bitmap (rows LSB-first, (w+7)/8 bytes
+  per row). One cache per FontSize is allocated on first use and sized
+  from the font's bounding box; slots are found by hashing the code point
+  with a short linear probe, evicting the home slot when all are taken.
+*/
+#define GLYPH_CACHE_SLOTS 96
+#define GLYPH_CACHE_PROBE 4
+#define U8G2_FONT_HDR 23
+
+typedef struct
+{
+    uint16_t cp; // 0 = empty slot
+    uint8_t w;
+    uint8_t h;
+    int8_t x;  // left bearing
+    int8_t y;  // bottom above baseline
+    int8_t dx; // advance
+} GlyphMeta;
+
+typedef struct
+{
+    const uint8_t *font;
+    uint8_t slot_size; // bitmap bytes per slot
+    GlyphMeta meta[GLYPH_CACHE_SLOTS];
+    uint8_t bits[];
+} GlyphCache;
+
+typedef struct
+{
+    const uint8_t *p;
+    uint8_t bit;
+} GlyphBits;
+
+static GlyphCache *glyph_caches[FONT_SIZE_XLARGE + 1];
+
+static const uint8_t *font_blob(FontSize font_size)
+{
+    switch (font_size)
+    {
+    case FONT_SIZE_SMALL:
+        return u8g2_font_4x6_tf;
+    case FONT_SIZE_MEDIUM:
+        return u8g2_font_5x8_tf;
+    case FONT_SIZE_LARGE:
+        return u8g2_font_6x10_tf;
+    case FONT_SIZE_XLARGE:
+        return u8g2_font_9x15_tf;
+    default:
+        return NULL;
+    }
+}
+
+static uint8_t glyph_bits_u(GlyphBits *r, uint8_t cnt)
+{
+    uint8_t val = (uint8_t)(r->p[0] >> r->bit);
+    uint8_t end = (uint8_t)(r->bit + cnt);
+    if (end >= 8)
+    {
+        r->p++;
+        val |= (uint8_t)(r->p[0] << (8 - r->bit));
+        end -= 8;
+    }
+    r->bit = end;
+    return (uint8_t)(val & ((1U << cnt) - 1));
+}
+
+static int8_t glyph_bits_s(GlyphBits *r, uint8_t cnt)
+{
+    return (int8_t)((int16_t)glyph_bits_u(r, cnt) - (1 << (cnt - 1)));
+}
+
+// The bundled _tf fonts only cover U+0020..U+00FF, so the unicode
+// lookup table is never needed.
+static const uint8_t *font_find_glyph(const uint8_t *font, uint16_t cp)
+{
+    if (cp >= 0x100)
+    {
+        return NULL;
+    }
+    const uint8_t *p = font + U8G2_FONT_HDR;
+    if (cp >= 'a')
+    {
+        p += ((uint16_t)font[19] << 8) | font[20];
+    }
+    else if (cp >= 'A')
+    {
+        p += ((uint16_t)font[17] << 8) | font[18];
+    }
+    while (p[1] != 0)
+    {
+        if (p[0] == cp)
+        {
+            return p + 2;
+        }
+        p += p[1];
+    }
+    return NULL;
+}
+
+static void glyph_decode(const uint8_t *font, uint16_t cp, GlyphMeta *m, uint8_t *bits, uint8_t bits_sz)
+{
+    memset(m, 0, sizeof(*m));
+    memset(bits, 0, bits_sz);
+    m->cp = cp;
+    const uint8_t *g = font_find_glyph(font, cp);
+    if (!g)
+    {
+        return;
+    }
+    GlyphBits r = {g, 0};
+    m->w = glyph_bits_u(&r, font[4]);
+    m->h = glyph_bits_u(&r, font[5]);
+    m->x = glyph_bits_s(&r, font[6]);
+    m->y = glyph_bits_s(&r, font[7]);
+    m->dx = glyph_bits_s(&r, font[8]);
+
+    uint8_t stride = (uint8_t)((m->w + 7) / 8);
+    uint16_t total = (uint16_t)m->w * m->h;
+    if (!total || (uint16_t)stride * m->h > bits_sz)
+    {
+        m->w = m->h = 0;
+        return;
+    }
+    // Runs of background (a) and foreground (b) pixels; a 1-bit flag
+    // repeats the same pair
+    uint16_t pos = 0;
+    while (pos < total)
+    {
+        uint8_t a = glyph_bits_u(&r, font[2]);
+        uint8_t b = glyph_bits_u(&r, font[3]);
+        do
+        {
+            pos += a;
+            for (uint8_t i = 0; i < b && pos < total; i++, pos++)
+            {
+                uint8_t px = (uint8_t)(pos % m->w);
+                uint8_t py = (uint8_t)(pos / m->w);
+                bits[py * stride + px / 8] |= (uint8_t)(1 << (px % 8));
+            }
+        } while (pos < total && glyph_bits_u(&r, 1));
+    }
+}
+
+static GlyphCache *glyph_cache_get(FontSize font_size)
+{
+    const uint8_t *font = font_blob(font_size);
+    if (!font)
+    {
+        return NULL;
+    }
+    if (!glyph_caches[font_size])
+    {
+        uint8_t slot_size = (uint8_t)(((font[9] + 7) / 8) * font[10]);
+        GlyphCache *c = malloc(sizeof(GlyphCache) + (size_t)GLYPH_CACHE_SLOTS * slot_size);
+        if (!c)
+        {
+            return NULL;
+        }
+        memset(c->meta, 0, sizeof(c->meta));
+        c->font = font;
+        c->slot_size = slot_size;
+        glyph_caches[font_size] = c;
+    }
+    return glyph_caches[font_size];
+}
+
+static const GlyphMeta *glyph_lookup(GlyphCache *c, uint16_t cp, const uint8_t **bits)
+{
+    uint8_t home = (uint8_t)((cp * 37u) % GLYPH_CACHE_SLOTS);
+    uint8_t slot = home;
+    for (uint8_t i = 0; i < GLYPH_CACHE_PROBE; i++)
+    {
+        uint8_t s = (uint8_t)((home + i) % GLYPH_CACHE_SLOTS);
+        if (c->meta[s].cp == cp)
+        {
+            *bits = c->bits + (size_t)s * c->slot_size;
+            return &c->meta[s];
+        }
+        if (c->meta[s].cp == 0)
+        {
+            slot = s;
+            break;
+        }
+    }
+    uint8_t *b = c->bits + (size_t)slot * c->slot_size;
+    glyph_decode(c->font, cp, &c->meta[slot], b, c->slot_size);
+    *bits = b;
+    return &c->meta[slot];
+}
+
+static uint16_t utf8_next(const char **s)
+{
+    const uint8_t *p = (const uint8_t *)*s;
+    uint16_t cp = p[0];
+    uint8_t n = 1;
+    if ((cp & 0xE0) == 0xC0 && (p[1] & 0xC0) == 0x80)
+    {
+        cp = (uint16_t)(((cp & 0x1F) << 6) | (p[1] & 0x3F));
+        n = 2;
+    }
+    else if ((cp & 0xF0) == 0xE0 && (p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80)
+    {
+        cp = (uint16_t)(((cp & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F));
+        n = 3;
+    }
+    *s += n;
+    return cp;
+}
+
+uint16_t canvas_draw_strn_cached(Canvas *canvas, FontSize font_size, int32_t x, int32_t y, const char *str, size_t len)
+{
+    GlyphCache *c = glyph_cache_get(font_size);
+    if (!c || !str)
+    {
+        return 0;
+    }
+    const char *end = str + len;
+    int32_t pen = x;
+    while (str < end && *str)
+    {
+        const uint8_t *bits;
+        const GlyphMeta *m = glyph_lookup(c, utf8_next(&str), &bits);
+        if (canvas && m->w)
+        {
+            canvas_draw_xbm(canvas, pen + m->x, y - (m->h + m->y), m->w, m->h, bits);
+        }
+        pen += m->dx;
+    }
+    return (uint16_t)(pen - x);
+}
+
+uint16_t canvas_draw_str_cached(Canvas *canvas, FontSize font_size, int32_t x, int32_t y, const char *str)
+{
+    return canvas_draw_strn_cached(canvas, font_size, x, y, str, str ? strlen(str) : 0);
+}
+
+uint16_t font_strn_width_cached(FontSize font_size, const char *str, size_t len)
+{
+    return canvas_draw_strn_cached(NULL, font_size, 0, 0, str, len);
+}
+
+uint16_t font_str_width_cached(FontSize font_size, const char *str)
+{
+    return canvas_draw_str_cached(NULL, font_size, 0, 0, str);
+}
+
+uint16_t font_draw_str_xbm(uint8_t *xbm, uint8_t xbm_w, uint8_t xbm_h, FontSize font_size, int16_t x, int16_t y, const char *str)
+{
+    GlyphCache *c = glyph_cache_get(font_size);
+    if (!c || !xbm || !str)
+    {
+        return 0;
+    }
+    uint8_t dst_stride = (uint8_t)((xbm_w + 7) / 8);
+    int16_t pen = x;
+    while (*str)
+    {
+        const uint8_t *bits;
+        const GlyphMeta *m = glyph_lookup(c, utf8_next(&str), &bits);
+        uint8_t src_stride = (uint8_t)((m->w + 7) / 8);
+        int16_t gx = (int16_t)(pen + m->x);
+        int16_t gy = (int16_t)(y - (m->h + m->y));
+        for (uint8_t j = 0; j < m->h; j++)
+        {
+            int16_t py = (int16_t)(gy + j);
+            if (py < 0 || py >= xbm_h)
+            {
+                continue;
+            }
+            for (uint8_t i = 0; i < m->w; i++)
+            {
+                int16_t px = (int16_t)(gx + i);
+                if (px < 0 || px >= xbm_w || !(bits[j * src_stride + i / 8] & (1 << (i % 8))))
+                {
+                    continue;
+                }
+                xbm[py * dst_stride + px / 8] |= (uint8_t)(1 << (px % 8));
+            }
+        }
+        pen += m->dx;
+    }
+    return (uint16_t)(pen - x);
+}
+
+void font_cache_free(void)
+{
+    for (uint8_t i = 0; i <= FONT_SIZE_XLARGE; i++)
+    {
+        free(glyph_caches[i]);
+        glyph_caches[i] = NULL;
+    }
+}
+
 /*
   Fontname: -Misc-Fixed-Medium-R-Normal--6-60-75-75-C-40-ISO10646-1
   Copyright: Public domain font.  Share and enjoy.
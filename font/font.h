@@ -15,6 +15,25 @@ extern "C"
     } FontSize;
     extern bool canvas_set_font_custom(Canvas *canvas, FontSize font_size);
     extern void canvas_draw_str_multi(Canvas *canvas, uint8_t x, uint8_t y, const char *str);
+
+    /*
+     * Cached text path for the custom fonts. Glyphs are decoded from the
+     * u8g2 blob once, kept as 1-bpp XBM bitmaps in a small per-font RAM
+     * cache and blitted with canvas_draw_xbm. Text is UTF-8; glyphs the
+     * font lacks are skipped. Both functions return the advance width.
+     * Does not change the canvas font; draws in the current color.
+     */
+    extern uint16_t canvas_draw_str_cached(Canvas *canvas, FontSize font_size, int32_t x, int32_t y, const char *str);
+    extern uint16_t font_str_width_cached(FontSize font_size, const char *str);
+    // Same as above for the first len bytes of str (no NUL needed)
+    extern uint16_t canvas_draw_strn_cached(Canvas *canvas, FontSize font_size, int32_t x, int32_t y, const char *str, size_t len);
+    extern uint16_t font_strn_width_cached(FontSize font_size, const char *str, size_t len);
+    /*
+     * Render into an XBM buffer (rows LSB-first, (xbm_w+7)/8 bytes per row)
+     * instead of the canvas, setting pixels and clipping to the buffer.
+     */
+    extern uint16_t font_draw_str_xbm(uint8_t *xbm, uint8_t xbm_w, uint8_t xbm_h, FontSize font_size, int16_t x, int16_t y, const char *str);
+    extern void font_cache_free(void);
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
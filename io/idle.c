@@ -0,0 +1,59 @@
+// idle.c — Maintenance jobs that run only while the user is idle
+
+#include "idle.h"
+
+void idle_init(IdleRunner* r, uint32_t idle_ms, uint32_t budget_ms) {
+    memset(r, 0, sizeof(*r));
+    r->idle_ticks   = furi_ms_to_ticks(idle_ms);
+    r->budget_ticks = furi_ms_to_ticks(budget_ms);
+    r->last_input   = furi_get_tick();
+}
+
+int8_t idle_register(IdleRunner* r, IdleStepFn step, void* ctx) {
+    if(r->count >= IDLE_MAX_JOBS) return -1;
+    IdleJob* j = &r->jobs[r->count];
+    j->step   = step;
+    j->ctx    = ctx;
+    j->cursor = 0;
+    j->done   = false;
+    return (int8_t)r->count++;
+}
+
+void idle_rearm(IdleRunner* r, int8_t id) {
+    if(id < 0 || id >= r->count) return;
+    r->jobs[id].cursor = 0;
+    r->jobs[id].done   = false;
+}
+
+void idle_kick(IdleRunner* r) {
+    r->last_input = furi_get_tick();
+    r->kicked     = true;
+}
+
+bool idle_should_yield(const IdleRunner* r) {
+    return r->kicked || (int32_t)(furi_get_tick() - r->deadline) >= 0;
+}
+
+void idle_tick(IdleRunner* r) {
+    // A key seen since the last tick restarts the quiet period
+    if(r->kicked) {
+        r->kicked = false;
+        return;
+    }
+    uint32_t now = furi_get_tick();
+    if(now - r->last_input < r->idle_ticks) return;
+
+    r->deadline = now + r->budget_ticks;
+    for(uint8_t n = 0; n < r->count; n++) {
+        uint8_t i = (uint8_t)((r->next + n) % r->count);
+        IdleJob* j = &r->jobs[i];
+        if(j->done) continue;
+        if(j->step(j->ctx, &j->cursor, r) == IdleStepDone) j->done = true;
+        if(idle_should_yield(r)) {
+            // Resume with the following job so one long job can't starve
+            // the others
+            r->next = (uint8_t)((i + 1) % r->count);
+            return;
+        }
+    }
+}
@@ -0,0 +1,67 @@
+// idle.h — Maintenance jobs that run only while the user is idle
+//
+// Registered jobs are stepped from the app's event loop once no key has
+// been pressed for a while. Each step gets a per-tick deadline and a
+// checkpoint cursor it advances as work is committed, so a job that is
+// interrupted (budget spent or a key pressed) resumes where it stopped
+// on the next idle tick.
+#pragma once
+#include <furi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IDLE_MAX_JOBS 4
+
+typedef enum {
+    IdleStepMore,   // yielded; call again with the same cursor
+    IdleStepDone,   // finished until re-armed
+} IdleStep;
+
+typedef struct IdleRunner IdleRunner;
+
+// One step of a job. cursor is the job's checkpoint (0 on first run or
+// after idle_rearm). Poll idle_should_yield between units of work and
+// return IdleStepMore as soon as it says so.
+typedef IdleStep (*IdleStepFn)(void* ctx, uint32_t* cursor, const IdleRunner* r);
+
+typedef struct {
+    IdleStepFn step;
+    void*      ctx;
+    uint32_t   cursor;
+    bool       done;
+} IdleJob;
+
+struct IdleRunner {
+    IdleJob       jobs[IDLE_MAX_JOBS];
+    uint8_t       count;
+    uint8_t       next;          // round-robin start for the next tick
+    uint32_t      idle_ticks;    // quiet time before any job runs
+    uint32_t      budget_ticks;  // work allowed per tick
+    uint32_t      deadline;
+    volatile uint32_t last_input;
+    volatile bool     kicked;    // a key arrived during the current tick
+};
+
+void idle_init(IdleRunner* r, uint32_t idle_ms, uint32_t budget_ms);
+
+// Returns the job id, or -1 when the table is full
+int8_t idle_register(IdleRunner* r, IdleStepFn step, void* ctx);
+
+// Restart a job from cursor 0, e.g. after the data it maintains changed
+void idle_rearm(IdleRunner* r, int8_t id);
+
+// Note user activity. Safe to call from the input callback; a job that
+// is mid-step sees it through idle_should_yield.
+void idle_kick(IdleRunner* r);
+
+bool idle_should_yield(const IdleRunner* r);
+
+// Run pending jobs if the idle threshold has passed. Call from the
+// event loop whenever it wakes without an event.
+void idle_tick(IdleRunner* r);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,251 @@
+// io_sched.c — Prioritized I/O worker for the shared verse file
+
+#include "io_sched.h"
+
+#define IO_FLAG_WAKE  (1U << 0)
+#define IO_NONE       0xFF
+
+typedef struct {
+    uint16_t id;       // 0 = free slot
+    uint8_t  kind;
+    uint8_t  prio;
+    bool     cancel;
+    uint32_t seq;      // FIFO order within a priority; renewed per slice
+    uint32_t pos;
+    IoStepFn step;
+    void*    ctx;
+} IoJob;
+
+struct IoSched {
+    FuriThread* thread;
+    FuriMutex*  queue_mx;   // guards jobs, heap and the fields below
+    FuriMutex*  file_mx;    // held for one slice, or by a foreground reader
+    File*       file;
+    IoDoneFn    done;
+    void*       user;
+    IoJob       jobs[IO_MAX_JOBS];
+    uint8_t     heap[IO_MAX_JOBS];   // slot indices, min-heap on (prio, seq)
+    uint8_t     heap_n;
+    uint8_t     running;
+    uint16_t    next_id;
+    uint32_t    seq;
+    bool        stop;
+};
+
+// ============================================================
+// Priority heap
+// ============================================================
+
+static bool job_before(const IoSched* s, uint8_t a, uint8_t b) {
+    const IoJob* x = &s->jobs[a];
+    const IoJob* y = &s->jobs[b];
+    if(x->prio != y->prio) return x->prio < y->prio;
+    return (int32_t)(x->seq - y->seq) < 0;
+}
+
+static void heap_sift_down(IoSched* s, uint8_t i) {
+    for(;;) {
+        uint8_t l = (uint8_t)(2 * i + 1), r = (uint8_t)(l + 1), m = i;
+        if(l < s->heap_n && job_before(s, s->heap[l], s->heap[m])) m = l;
+        if(r < s->heap_n && job_before(s, s->heap[r], s->heap[m])) m = r;
+        if(m == i) return;
+        uint8_t t = s->heap[i]; s->heap[i] = s->heap[m]; s->heap[m] = t;
+        i = m;
+    }
+}
+
+static void heap_push(IoSched* s, uint8_t slot) {
+    uint8_t i = s->heap_n++;
+    s->heap[i] = slot;
+    while(i > 0) {
+        uint8_t p = (uint8_t)((i - 1) / 2);
+        if(!job_before(s, s->heap[i], s->heap[p])) break;
+        uint8_t t = s->heap[i]; s->heap[i] = s->heap[p]; s->heap[p] = t;
+        i = p;
+    }
+}
+
+static uint8_t heap_pop(IoSched* s) {
+    uint8_t top = s->heap[0];
+    s->heap[0] = s->heap[--s->heap_n];
+    heap_sift_down(s, 0);
+    return top;
+}
+
+static void heap_remove_at(IoSched* s, uint8_t i) {
+    s->heap[i] = s->heap[--s->heap_n];
+    // The heap is tiny; rebuilding is simpler than a two-way sift
+    for(int8_t k = (int8_t)(s->heap_n / 2) - 1; k >= 0; k--) heap_sift_down(s, (uint8_t)k);
+}
+
+// ============================================================
+// Worker
+// ============================================================
+
+static int32_t io_worker(void* context) {
+    IoSched* s = context;
+    for(;;) {
+        furi_mutex_acquire(s->queue_mx, FuriWaitForever);
+        if(s->stop) {
+            furi_mutex_release(s->queue_mx);
+            break;
+        }
+        if(!s->heap_n) {
+            furi_mutex_release(s->queue_mx);
+            furi_thread_flags_wait(IO_FLAG_WAKE, FuriFlagWaitAny, FuriWaitForever);
+            continue;
+        }
+        uint8_t  slot = heap_pop(s);
+        IoJob    job  = s->jobs[slot];
+        s->running    = slot;
+        furi_mutex_release(s->queue_mx);
+
+        // One slice, at this job's own file position
+        IoStep   r   = IoStepFailed;
+        uint32_t pos = job.pos;
+        furi_mutex_acquire(s->file_mx, FuriWaitForever);
+        if(s->file && storage_file_seek(s->file, job.pos, true)) {
+            r   = job.step(job.ctx, s->file);
+            pos = (uint32_t)storage_file_tell(s->file);
+        }
+        furi_mutex_release(s->file_mx);
+
+        furi_mutex_acquire(s->queue_mx, FuriWaitForever);
+        IoJob* j   = &s->jobs[slot];
+        j->pos     = pos;
+        s->running = IO_NONE;
+        if(r == IoStepMore && !j->cancel && !s->stop) {
+            // Re-queue behind its peers so equal priorities round-robin
+            j->seq = s->seq++;
+            heap_push(s, slot);
+            furi_mutex_release(s->queue_mx);
+            continue;
+        }
+        IoCompletion c = {
+            .id     = j->id,
+            .kind   = j->kind,
+            .result = j->cancel ? IoResultCancelled :
+                      (r == IoStepDone ? IoResultOk : IoResultFailed),
+            .ctx    = j->ctx,
+        };
+        j->id = 0;
+        furi_mutex_release(s->queue_mx);
+        s->done(&c, s->user);
+    }
+    return 0;
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+IoSched* io_sched_alloc(IoDoneFn done, void* user) {
+    IoSched* s = malloc(sizeof(IoSched));
+    if(!s) return NULL;
+    memset(s, 0, sizeof(IoSched));
+    s->done     = done;
+    s->user     = user;
+    s->running  = IO_NONE;
+    s->next_id  = 1;
+    s->queue_mx = furi_mutex_alloc(FuriMutexTypeNormal);
+    s->file_mx  = furi_mutex_alloc(FuriMutexTypeNormal);
+    s->thread   = furi_thread_alloc_ex("BibleIO", 2048, io_worker, s);
+    furi_thread_start(s->thread);
+    return s;
+}
+
+void io_sched_free(IoSched* s) {
+    if(!s) return;
+    furi_mutex_acquire(s->queue_mx, FuriWaitForever);
+    s->stop = true;
+    furi_mutex_release(s->queue_mx);
+    furi_thread_flags_set(furi_thread_get_id(s->thread), IO_FLAG_WAKE);
+    furi_thread_join(s->thread);
+    furi_thread_free(s->thread);
+
+    // The worker is gone: report whatever was still queued
+    for(uint8_t i = 0; i < IO_MAX_JOBS; i++) {
+        if(!s->jobs[i].id) continue;
+        IoCompletion c = {
+            .id = s->jobs[i].id, .kind = s->jobs[i].kind,
+            .result = IoResultCancelled, .ctx = s->jobs[i].ctx,
+        };
+        s->jobs[i].id = 0;
+        s->done(&c, s->user);
+    }
+    furi_mutex_free(s->queue_mx);
+    furi_mutex_free(s->file_mx);
+    free(s);
+}
+
+void io_sched_set_file(IoSched* s, File* file) {
+    s->file = file;
+}
+
+uint16_t io_sched_submit(IoSched* s, IoPriority prio, uint8_t kind,
+                         IoStepFn step, void* ctx, uint32_t pos) {
+    uint16_t id = 0;
+    furi_mutex_acquire(s->queue_mx, FuriWaitForever);
+    for(uint8_t i = 0; i < IO_MAX_JOBS && !s->stop; i++) {
+        if(s->jobs[i].id) continue;
+        id = s->next_id++;
+        if(!s->next_id) s->next_id = 1;
+        s->jobs[i] = (IoJob){
+            .id = id, .kind = kind, .prio = (uint8_t)prio, .seq = s->seq++,
+            .pos = pos, .step = step, .ctx = ctx,
+        };
+        heap_push(s, i);
+        break;
+    }
+    furi_mutex_release(s->queue_mx);
+    if(id) furi_thread_flags_set(furi_thread_get_id(s->thread), IO_FLAG_WAKE);
+    return id;
+}
+
+// Flag a running job, or pull a queued one and report it. Caller holds
+// queue_mx; returns true if c was filled for a dropped job.
+static bool io_cancel_slot(IoSched* s, uint8_t slot, IoCompletion* c) {
+    IoJob* j = &s->jobs[slot];
+    if(!j->id) return false;
+    if(slot == s->running) {
+        j->cancel = true;
+        return false;
+    }
+    for(uint8_t h = 0; h < s->heap_n; h++) {
+        if(s->heap[h] != slot) continue;
+        heap_remove_at(s, h);
+        break;
+    }
+    *c = (IoCompletion){ .id = j->id, .kind = j->kind, .result = IoResultCancelled, .ctx = j->ctx };
+    j->id = 0;
+    return true;
+}
+
+void io_sched_cancel(IoSched* s, uint16_t id) {
+    if(!id) return;
+    IoCompletion c;
+    bool dropped = false;
+    furi_mutex_acquire(s->queue_mx, FuriWaitForever);
+    for(uint8_t i = 0; i < IO_MAX_JOBS; i++)
+        if(s->jobs[i].id == id) { dropped = io_cancel_slot(s, i, &c); break; }
+    furi_mutex_release(s->queue_mx);
+    if(dropped) s->done(&c, s->user);
+}
+
+void io_sched_cancel_all(IoSched* s) {
+    IoCompletion c[IO_MAX_JOBS];
+    uint8_t n = 0;
+    furi_mutex_acquire(s->queue_mx, FuriWaitForever);
+    for(uint8_t i = 0; i < IO_MAX_JOBS; i++)
+        if(io_cancel_slot(s, i, &c[n])) n++;
+    furi_mutex_release(s->queue_mx);
+    for(uint8_t i = 0; i < n; i++) s->done(&c[i], s->user);
+}
+
+void io_sched_lock(IoSched* s) {
+    furi_mutex_acquire(s->file_mx, FuriWaitForever);
+}
+
+void io_sched_unlock(IoSched* s) {
+    furi_mutex_release(s->file_mx);
+}
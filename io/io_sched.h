@@ -0,0 +1,79 @@
+// io_sched.h — Prioritized I/O worker for the shared verse file
+//
+// One worker thread owns all background access to the open verse file.
+// Jobs are stepped in bounded slices from a priority queue, so a
+// foreground job (or a foreground read through io_sched_lock) waits for
+// at most one slice of background work. Every job keeps its own file
+// position across slices.
+#pragma once
+#include <furi.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IO_MAX_JOBS 8
+
+typedef enum {
+    IoPriorityForeground = 0,   // the user is waiting on it
+    IoPriorityNormal     = 1,
+    IoPriorityBackground = 2,   // prefetch, warming, maintenance
+} IoPriority;
+
+typedef enum {
+    IoStepMore,     // slice done, more work left
+    IoStepDone,
+    IoStepFailed,
+} IoStep;
+
+typedef enum {
+    IoResultOk,
+    IoResultFailed,
+    IoResultCancelled,
+} IoResult;
+
+// One bounded slice of a job. file is positioned at the job's own offset
+// on entry; the position it is left at is saved for the next slice, so
+// interleaved jobs never see each other's seeks.
+typedef IoStep (*IoStepFn)(void* ctx, File* file);
+
+typedef struct {
+    uint16_t id;
+    uint8_t  kind;     // caller-defined job type
+    IoResult result;
+    void*    ctx;      // handed back to the receiver, which now owns it
+} IoCompletion;
+
+// Called once per job when it finishes, fails or is cancelled. Runs on
+// the worker thread, or on the cancelling thread for a job dropped from
+// the queue; there it must not block on anything that thread drains.
+typedef void (*IoDoneFn)(const IoCompletion* done, void* user);
+
+typedef struct IoSched IoSched;
+
+IoSched* io_sched_alloc(IoDoneFn done, void* user);
+
+// Cancels everything still queued and joins the worker
+void io_sched_free(IoSched* s);
+
+// Replace the shared file. Call with the lock held.
+void io_sched_set_file(IoSched* s, File* file);
+
+// Queue a job starting at file offset pos. Returns its id, 0 if full.
+uint16_t io_sched_submit(IoSched* s, IoPriority prio, uint8_t kind,
+                         IoStepFn step, void* ctx, uint32_t pos);
+
+// A running job stops after its current slice; queued ones are dropped.
+// Either way the completion reports IoResultCancelled.
+void io_sched_cancel(IoSched* s, uint16_t id);
+void io_sched_cancel_all(IoSched* s);
+
+// Exclusive access to the shared file from the calling thread. Waits for
+// at most the slice in progress.
+void io_sched_lock(IoSched* s);
+void io_sched_unlock(IoSched* s);
+
+#ifdef __cplusplus
+}
+#endif
@@ -61,6 +61,69 @@ static void search_buf_backspace(App* app) {
         app->search_buf[--app->search_len] = '\0';
 }
 
+// Precomposed keyboard layer: key labels of the current page plus the
+// special-button frames and labels, rendered once into a 1-bpp XBM and
+// rebuilt only when the page or caps state changes.
+
+#define KB_KEY_W    9
+#define KB_KEY_H   10                                  // 3 rows x 10px = 30px
+#define KB_KEY_X0   4
+#define KB_BTN_H    8
+#define KB_BTN_W   23
+#define KB_BTN_Y   (SCREEN_H - KB_BTN_H)               // 56 -- special row, flush to bottom
+#define KB_LAYER_Y (KB_BTN_Y - KB_NROWS * KB_KEY_H)    // 26 -- first key row
+#define KB_LAYER_H (SCREEN_H - KB_LAYER_Y)
+
+static const uint8_t kb_btn_x[5] = { 2, 27, 52, 77, 102 };
+
+static struct {
+    uint8_t bits[(SCREEN_W / 8) * KB_LAYER_H];
+    uint8_t key;   // page | caps << 2 | valid << 3
+} kb_layer;
+
+static void kb_layer_frame(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+    const uint8_t stride = SCREEN_W / 8;
+    for(uint8_t i = x; i < x + w; i++) {
+        kb_layer.bits[y * stride + i / 8]           |= (uint8_t)(1 << (i % 8));
+        kb_layer.bits[(y + h - 1) * stride + i / 8] |= (uint8_t)(1 << (i % 8));
+    }
+    for(uint8_t j = y; j < y + h; j++) {
+        kb_layer.bits[j * stride + x / 8]           |= (uint8_t)(1 << (x % 8));
+        kb_layer.bits[j * stride + (x + w - 1) / 8] |= (uint8_t)(1 << ((x + w - 1) % 8));
+    }
+}
+
+static void kb_layer_update(App* app) {
+    uint8_t key = (uint8_t)(app->kb_page | (app->kb_caps ? 4 : 0) | 8);
+    if(kb_layer.key == key) return;
+    memset(kb_layer.bits, 0, sizeof(kb_layer.bits));
+
+    for(uint8_t r = 0; r < KB_NROWS; r++) {
+        for(uint8_t c = 0; c < KB_NCOLS; c++) {
+            font_draw_str_xbm(kb_layer.bits, SCREEN_W, KB_LAYER_H, FONT_SIZE_MEDIUM,
+                              KB_KEY_X0 + c * KB_KEY_W + 1, r * KB_KEY_H + 7,
+                              kb_key_label(app, r, c));
+        }
+    }
+
+    // Special buttons row: DEL | SPC | CAP | SYM/ABC | GO!
+    const char* btns[5] = {
+        "DEL", "SPC",
+        (app->kb_page == 0) ? "CAP" : "---",  // CAP only on page 0
+        (app->kb_page == 0) ? "SYM" : (app->kb_page == 1) ? "UML" : "ABC",
+        "GO!"
+    };
+    const uint8_t by = KB_BTN_Y - KB_LAYER_Y;
+    for(uint8_t i = 0; i < 5; i++) {
+        kb_layer_frame(kb_btn_x[i], by, KB_BTN_W, KB_BTN_H);
+        uint16_t w = font_str_width_cached(FONT_SIZE_SMALL, btns[i]);
+        font_draw_str_xbm(kb_layer.bits, SCREEN_W, KB_LAYER_H, FONT_SIZE_SMALL,
+                          (int16_t)(kb_btn_x[i] + KB_BTN_W / 2 - w / 2), by + KB_BTN_H - 1,
+                          btns[i]);
+    }
+    kb_layer.key = key;
+}
+
 // draw_search_input
 
 void draw_search_input(Canvas* canvas, App* app) {
@@ -87,63 +150,81 @@ void draw_search_input(Canvas* canvas, App* app) {
     // Keyboard grid
     // Special row is 8px tall, pinned to the very bottom (y=56..63).
     // The 3 key rows fill y=26..55 equally: 30px / 3 = 10px each.
-    const uint8_t bkh = 8;
-    const uint8_t by  = SCREEN_H - bkh;          // 56 -- special row, flush to bottom
-    const uint8_t kw  = 9;
-    const uint8_t kh  = 10;                       // 3 rows x 10px = 30px
-    const uint8_t ky  = by - KB_NROWS * kh;       // 26 -- first key row
-    for(uint8_t r = 0; r < KB_NROWS; r++) {
-        for(uint8_t c = 0; c < KB_NCOLS; c++) {
-            uint8_t x = 4 + c * kw, y = ky + r * kh;
-            bool sel = (r == app->kb_row && c == app->kb_col);
-            if(sel) {
-                canvas_set_color(canvas, ColorBlack);
-                canvas_draw_box(canvas, x, y, kw - 1, kh - 1);
-                canvas_set_color(canvas, ColorWhite);
-            } else {
-                canvas_set_color(canvas, ColorBlack);
-            }
-            canvas_draw_str(canvas, x + 1, y + 7, kb_key_label(app, r, c));
-            canvas_set_color(canvas, ColorBlack);
-        }
+    // The labels and button frames come from the precomposed layer; only
+    // the selected cell and the lit CAP button are inverted per frame.
+    kb_layer_update(app);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_draw_xbm(canvas, 0, KB_LAYER_Y, SCREEN_W, KB_LAYER_H, kb_layer.bits);
+    canvas_set_color(canvas, ColorXOR);
+    if(app->kb_row < KB_NROWS) {
+        canvas_draw_box(canvas, KB_KEY_X0 + app->kb_col * KB_KEY_W,
+                        KB_LAYER_Y + app->kb_row * KB_KEY_H, KB_KEY_W - 1, KB_KEY_H - 1);
     }
-
-    // Special buttons row: DEL | SPC | CAP | SYM/ABC | GO!
-    // Pinned flush to the bottom of the screen.
-    const char* btns[5] = {
-        "DEL", "SPC",
-        (app->kb_page == 0) ? "CAP" : "---",  // CAP only on page 0
-        (app->kb_page == 0) ? "SYM" : (app->kb_page == 1) ? "UML" : "ABC",
-        "GO!"
-    };
-    const uint8_t bx[5] = {  2, 27, 52, 77, 102 };
-    const uint8_t bw[5] = { 23, 23, 23, 23,  23 };
     for(uint8_t i = 0; i < 5; i++) {
         bool btn_sel  = (app->kb_row == KB_NROWS && app->kb_col == i);
         bool caps_lit = (i == 2 && app->kb_page == 0 && app->kb_caps);  // CAP only lights on page 0
-        bool fill = btn_sel || caps_lit;
-        if(fill) {
-            canvas_set_color(canvas, ColorBlack);
-            canvas_draw_box(canvas, bx[i], by, bw[i], bkh);
-            canvas_set_color(canvas, ColorWhite);
-        } else {
-            canvas_set_color(canvas, ColorBlack);
-            canvas_draw_frame(canvas, bx[i], by, bw[i], bkh);
+        // Invert inside the frame so a lit button matches a filled box
+        if(btn_sel || caps_lit)
+            canvas_draw_box(canvas, kb_btn_x[i] + 1, KB_BTN_Y + 1, KB_BTN_W - 2, KB_BTN_H - 2);
+    }
+    canvas_set_color(canvas, ColorBlack);
+    canvas_set_font(canvas, FontSecondary);
+}
+
+// Grouped results: one row per book with hits, followed (for the expanded
+// book only) by that book's kept hits. Expanding runs search_expand_book,
+// so a book the full pass kept too few hits for lists app->book_pass's
+// once its pass ends. Book rows are tagged RESULT_ROW_BOOK and rows into
+// app->book_pass RESULT_ROW_PASS.
+
+#define RESULT_ROW_BOOK  0x8000
+#define RESULT_ROW_PASS  0x4000
+#define RESULT_ROWS_MAX  (BIBLE_BOOKS_COUNT + MAX_SEARCH_RESULTS)
+
+// The hits a verse row points into, and its index there
+static const SearchHits* row_hits(const App* app, uint16_t row, uint8_t* i) {
+    *i = (uint8_t)(row & 0xFF);
+    return (row & RESULT_ROW_PASS) ? app->book_pass : &app->hits;
+}
+
+static uint8_t results_rows(App* app, uint16_t* rows) {
+    const SearchHits* h = &app->hits;
+    if(!h->grouped) {
+        for(uint8_t i = 0; i < h->count; i++) rows[i] = i;
+        return h->count;
+    }
+    uint8_t n = 0;
+    for(uint8_t b = 0; b < BIBLE_BOOKS_COUNT; b++) {
+        if(!h->book_hits[b]) continue;
+        rows[n++] = RESULT_ROW_BOOK | b;
+        if(b != h->open_book) continue;
+        const SearchHits* bp = app->book_pass;
+        if(bp && bp->open_book == b) {
+            for(uint8_t i = 0; i < bp->count; i++) rows[n++] = RESULT_ROW_PASS | i;
+            continue;
         }
-        canvas_set_font_custom(canvas, FONT_SIZE_SMALL);   // smallest custom font
-        canvas_draw_str_aligned(canvas, bx[i] + bw[i] / 2, by + bkh - 1,
-                                AlignCenter, AlignBottom, btns[i]);
-        canvas_set_font(canvas, FontSecondary);   // restore default for next iteration
-        canvas_set_color(canvas, ColorBlack);
+        for(uint8_t i = 0; i < h->count; i++)
+            if(app->index[h->idx[i]].book == b) rows[n++] = i;
     }
+    return n;
 }
 
 // draw_search_results
 
 void draw_search_results(Canvas* canvas, App* app) {
     char hdr_buf[24];
-    if(app->hits.count == 0)
+    if(app->search_busy) {
+        draw_hdr(canvas, "Searching...");
+        canvas_set_font(canvas, FontSecondary);
+        canvas_draw_str_aligned(canvas, SCREEN_W / 2, 40,
+                                AlignCenter, AlignCenter, "Back to cancel");
+        return;
+    }
+    if(app->hits.total == 0)
         snprintf(hdr_buf, sizeof(hdr_buf), "Not found");
+    else if(app->hits.total > app->hits.count)
+        snprintf(hdr_buf, sizeof(hdr_buf), "Found: %u (%u)",
+                 (unsigned)app->hits.total, (unsigned)app->hits.count);
     else
         snprintf(hdr_buf, sizeof(hdr_buf), "Found: %d", (int)app->hits.count);
     draw_hdr(canvas, hdr_buf);
@@ -159,6 +240,8 @@ void draw_search_results(Canvas* canvas, App* app) {
     }
 
     const uint8_t vis = (uint8_t)((SCREEN_H - HDR_H - 2) / LINE_H);
+    uint16_t rows[RESULT_ROWS_MAX];
+    uint8_t  nrows = results_rows(app, rows);
 
     // Auto-scroll so selected item stays visible
     if(app->hits.sel < app->hits.scroll)
@@ -166,7 +249,7 @@ void draw_search_results(Canvas* canvas, App* app) {
     if(app->hits.sel >= app->hits.scroll + vis)
         app->hits.scroll = (uint8_t)(app->hits.sel - vis + 1);
 
-    for(uint8_t i = 0; i < vis && (app->hits.scroll + i) < app->hits.count; i++) {
+    for(uint8_t i = 0; i < vis && (app->hits.scroll + i) < nrows; i++) {
         uint8_t si = app->hits.scroll + i;
         uint8_t y  = HDR_H + 2 + i * LINE_H;
         bool    sel = (si == app->hits.sel);
@@ -179,11 +262,23 @@ void draw_search_results(Canvas* canvas, App* app) {
             canvas_set_color(canvas, ColorBlack);
         }
 
-        canvas_draw_str(canvas, 4, y + 8, app->index[app->hits.idx[si]].ref);
+        if(rows[si] & RESULT_ROW_BOOK) {
+            uint8_t b = (uint8_t)(rows[si] & 0xFF);
+            char cnt[8];
+            snprintf(cnt, sizeof(cnt), "%u", (unsigned)app->hits.book_hits[b]);
+            canvas_draw_str(canvas, 4, y + 8, b == app->hits.open_book ? "-" : "+");
+            canvas_draw_str(canvas, 12, y + 8, bible_book_name(b));
+            canvas_draw_str_aligned(canvas, SCREEN_W - SB_W - 5, y + 8,
+                                    AlignRight, AlignBottom, cnt);
+        } else {
+            uint8_t x = app->hits.grouped ? 16 : 4, hi;
+            const SearchHits* rh = row_hits(app, rows[si], &hi);
+            canvas_draw_str(canvas, x, y + 8, app->index[rh->idx[hi]].ref);
+        }
         canvas_set_color(canvas, ColorBlack);
     }
 
-    draw_scrollbar(canvas, app->hits.scroll, app->hits.count, vis);
+    draw_scrollbar(canvas, app->hits.scroll, nrows, vis);
 }
 
 // on_search  (input handler for the keyboard view)
@@ -332,29 +427,62 @@ void on_search_results(App* app, InputEvent* ev) {
     if(ev->type != InputTypeShort && ev->type != InputTypeRepeat) return;
 
     const uint8_t vis = (uint8_t)((SCREEN_H - HDR_H - 2) / LINE_H);
+    SearchHits* h = &app->hits;
+    uint16_t rows[RESULT_ROWS_MAX];
+    uint8_t  nrows = results_rows(app, rows);
 
     switch(ev->key) {
     case InputKeyUp:
-        if(app->hits.sel > 0) app->hits.sel--;
+        if(h->sel > 0) h->sel--;
         break;
     case InputKeyDown:
-        if(app->hits.sel < app->hits.count - 1) app->hits.sel++;
+        if(h->sel + 1 < nrows) h->sel++;
+        break;
+    case InputKeyLeft:
+    case InputKeyRight:
+        // Switch between the flat list and the per-book view
+        h->grouped   = !h->grouped;
+        h->open_book = BOOK_NONE;
+        h->sel       = 0;
+        h->scroll    = 0;
         break;
     case InputKeyOk:
-        if(app->hits.count == 0) break;
-        open_verse(app, app->hits.idx[app->hits.sel], ViewSearchResults);
+        if(h->sel >= nrows) break;
+        if(rows[h->sel] & RESULT_ROW_BOOK) {
+            // Expand or collapse, keeping the cursor on this book's row
+            uint8_t b = (uint8_t)(rows[h->sel] & 0xFF);
+            h->open_book = (h->open_book == b) ? BOOK_NONE : b;
+            if(h->open_book == b) search_expand_book(app, b);
+            nrows = results_rows(app, rows);
+            for(uint8_t i = 0; i < nrows; i++)
+                if(rows[i] == (RESULT_ROW_BOOK | b)) { h->sel = i; break; }
+            break;
+        }
+        {
+            uint8_t hi;
+            const SearchHits* rh = row_hits(app, rows[h->sel], &hi);
+            open_verse(app, rh->idx[hi], ViewSearchResults);
+            verse_highlight(app, rh->spans[hi], rh->span_count[hi]);
+        }
         break;
     case InputKeyBack:
+        if(app->search_busy && h->open_book != BOOK_NONE) {
+            // Cancel a book's pass but keep the full pass's results
+            search_cancel(app);
+            h->open_book = BOOK_NONE;
+            break;
+        }
+        search_cancel(app);
         app->view = ViewSearchInput;
         break;
     default: break;
     }
 
     // Keep scroll in sync
-    if(app->hits.count > 0) {
-        if(app->hits.sel < app->hits.scroll)
-            app->hits.scroll = app->hits.sel;
-        if(app->hits.sel >= app->hits.scroll + vis)
-            app->hits.scroll = (uint8_t)(app->hits.sel - vis + 1);
+    if(nrows > 0) {
+        if(h->sel < h->scroll)
+            h->scroll = h->sel;
+        if(h->sel >= h->scroll + vis)
+            h->scroll = (uint8_t)(h->sel - vis + 1);
     }
 }
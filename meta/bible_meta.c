@@ -0,0 +1,341 @@
+// bible_meta.c — Bible book metadata tables
+// Generated by tools/gen_meta.py from meta/books.txt; do not edit.
+
+#include "bible_meta.h"
+
+const char BIBLE_NAME_POOL[] =
+    "Genesis\0"
+    "Exodus\0"
+    "Leviticus\0"
+    "Numbers\0"
+    "Deuteronomy\0"
+    "Joshua\0"
+    "Judges\0"
+    "Ruth\0"
+    "1 Samuel\0"
+    "2 Samuel\0"
+    "1 Kings\0"
+    "2 Kings\0"
+    "1 Chronicles\0"
+    "2 Chronicles\0"
+    "Ezra\0"
+    "Nehemiah\0"
+    "Esther\0"
+    "Job\0"
+    "Psalms\0"
+    "Proverbs\0"
+    "Ecclesiastes\0"
+    "Song of Solomon\0"
+    "Isaiah\0"
+    "Jeremiah\0"
+    "Lamentations\0"
+    "Ezekiel\0"
+    "Daniel\0"
+    "Hosea\0"
+    "Joel\0"
+    "Amos\0"
+    "Obadiah\0"
+    "Jonah\0"
+    "Micah\0"
+    "Nahum\0"
+    "Habakkuk\0"
+    "Zephaniah\0"
+    "Haggai\0"
+    "Zechariah\0"
+    "Malachi\0"
+    "Matthew\0"
+    "Mark\0"
+    "Luke\0"
+    "John\0"
+    "Acts\0"
+    "Romans\0"
+    "1 Corinthians\0"
+    "2 Corinthians\0"
+    "Galatians\0"
+    "Ephesians\0"
+    "Philippians\0"
+    "Colossians\0"
+    "1 Thessalonians\0"
+    "2 Thessalonians\0"
+    "1 Timothy\0"
+    "2 Timothy\0"
+    "Titus\0"
+    "Philemon\0"
+    "Hebrews\0"
+    "James\0"
+    "1 Peter\0"
+    "2 Peter\0"
+    "1 John\0"
+    "2 John\0"
+    "3 John\0"
+    "Jude\0"
+    "Revelation\0"
+    "1. Mose\0"
+    "2. Mose\0"
+    "3. Mose\0"
+    "4. Mose\0"
+    "5. Mose\0"
+    "Josua\0"
+    "Richter\0"
+    "1. Samuel\0"
+    "2. Samuel\0"
+    "1. K\303\266nige\0"
+    "2. K\303\266nige\0"
+    "1. Chronik\0"
+    "2. Chronik\0"
+    "Esra\0"
+    "Nehemia\0"
+    "Hiob\0"
+    "Psalmen\0"
+    "Spr\303\274che\0"
+    "Prediger\0"
+    "Hoheslied\0"
+    "Jesaja\0"
+    "Jeremia\0"
+    "Klagelieder\0"
+    "Hesekiel\0"
+    "Obadja\0"
+    "Jona\0"
+    "Micha\0"
+    "Habakuk\0"
+    "Zephanja\0"
+    "Sacharja\0"
+    "Maleachi\0"
+    "Matth\303\244us\0"
+    "Markus\0"
+    "Lukas\0"
+    "Johannes\0"
+    "Apostelgeschichte\0"
+    "R\303\266mer\0"
+    "1. Korinther\0"
+    "2. Korinther\0"
+    "Galater\0"
+    "Epheser\0"
+    "Philipper\0"
+    "Kolosser\0"
+    "1. Thessalonicher\0"
+    "2. Thessalonicher\0"
+    "1. Timotheus\0"
+    "2. Timotheus\0"
+    "Hebr\303\244er\0"
+    "Jakobus\0"
+    "1. Petrus\0"
+    "2. Petrus\0"
+    "1. Johannes\0"
+    "2. Johannes\0"
+    "3. Johannes\0"
+    "Judas\0"
+    "Offenbarung\0"
+    "Psalm\0"
+    "Song of Songs\0";
+
+const char BIBLE_LANG_CODES[BIBLE_LANG_COUNT][4] = { "en", "de" };
+
+const uint16_t BIBLE_BOOK_NAME[BIBLE_LANG_COUNT][BIBLE_BOOKS_COUNT] = {
+    {
+        0, 8, 15, 25, 33, 45, 52, 59, 64, 73, 82, 90,
+        98, 111, 124, 129, 138, 145, 149, 156, 165, 178, 194, 201,
+        210, 223, 231, 238, 244, 249, 254, 262, 268, 274, 280, 289,
+        299, 306, 316, 324, 332, 337, 342, 347, 352, 359, 373, 387,
+        397, 407, 419, 430, 446, 462, 472, 482, 488, 497, 505, 511,
+        519, 527, 534, 541, 548, 553,
+    },
+    {
+        564, 572, 580, 588, 596, 604, 610, 59, 618, 628, 638, 649,
+        660, 671, 682, 687, 138, 695, 700, 708, 717, 726, 736, 743,
+        751, 763, 231, 238, 244, 249, 772, 779, 784, 274, 790, 798,
+        299, 807, 816, 825, 835, 842, 848, 857, 875, 882, 895, 908,
+        916, 924, 934, 943, 961, 979, 992, 482, 488, 1005, 1014, 1022,
+        1032, 1042, 1054, 1066, 1078, 1084,
+    },
+};
+
+const uint16_t BIBLE_ALIAS_NAME[BIBLE_ALIAS_COUNT] = {
+    1096, 1102,
+};
+
+const uint8_t BIBLE_ALIAS_BOOK[BIBLE_ALIAS_COUNT] = {
+    18, 21,
+};
+
+const uint8_t BIBLE_BOOK_CHAPTERS[BIBLE_BOOKS_COUNT] = {
+    50, 40, 27, 36, 34, 24, 21, 4, 31, 24, 22, 25, 29, 36, 10, 13, 10, 42, 150, 31,
+    12, 8, 66, 52, 5, 48, 12, 14, 3, 9, 1, 4, 7, 3, 3, 3, 2, 14, 4, 28,
+    16, 24, 21, 28, 16, 16, 13, 6, 6, 4, 4, 5, 3, 6, 4, 3, 1, 13, 5, 5,
+    3, 5, 1, 1, 1, 22,
+};
+
+const uint16_t BIBLE_CHAPTER_START[BIBLE_BOOKS_COUNT + 1] = {
+    0, 50, 90, 117, 153, 187, 211, 232, 236, 267, 291, 313,
+    338, 367, 403, 413, 426, 436, 478, 628, 659, 671, 679, 745,
+    797, 802, 850, 862, 876, 879, 888, 889, 893, 900, 903, 906,
+    909, 911, 925, 929, 957, 973, 997, 1018, 1046, 1062, 1078, 1091,
+    1097, 1103, 1107, 1111, 1116, 1119, 1125, 1129, 1132, 1133, 1146, 1151,
+    1156, 1159, 1164, 1165, 1166, 1167, 1189,
+};
+
+const uint8_t BIBLE_VERSE_COUNTS[BIBLE_CHAPTERS_COUNT] = {
+    31, 25, 24, 26, 32, 22, 24, 22, 29, 32, 32, 20, 18, 24, 21, 16, 27, 33, 38, 18,
+    34, 24, 20, 67, 34, 35, 46, 22, 35, 43, 55, 32, 20, 31, 29, 43, 36, 30, 23, 23,
+    57, 38, 34, 34, 28, 34, 31, 22, 33, 26, 22, 25, 22, 31, 23, 30, 25, 32, 35, 29,
+    10, 51, 22, 31, 27, 36, 16, 27, 25, 26, 36, 31, 33, 18, 40, 37, 21, 43, 46, 38,
+    18, 35, 23, 35, 35, 38, 29, 31, 43, 38, 17, 16, 17, 35, 19, 30, 38, 36, 24, 20,
+    47, 8, 59, 57, 33, 34, 16, 30, 24, 16, 15, 49, 52, 45, 23, 26, 20, 54, 34, 51,
+    49, 31, 27, 89, 26, 23, 36, 35, 16, 33, 45, 41, 50, 13, 32, 22, 29, 35, 41, 30,
+    25, 18, 65, 23, 31, 40, 16, 54, 42, 56, 29, 34, 13, 46, 37, 29, 49, 33, 25, 26,
+    20, 29, 22, 32, 32, 18, 29, 23, 22, 20, 22, 21, 20, 23, 30, 25, 22, 19, 19, 26,
+    68, 29, 20, 30, 52, 29, 12, 18, 24, 17, 24, 15, 27, 26, 35, 27, 43, 23, 24, 33,
+    15, 63, 10, 18, 28, 51, 9, 45, 34, 16, 33, 36, 23, 31, 24, 31, 40, 25, 35, 57,
+    18, 40, 15, 25, 20, 20, 31, 13, 31, 30, 48, 25, 22, 23, 18, 22, 28, 36, 21, 22,
+    12, 21, 17, 22, 27, 27, 15, 25, 23, 52, 35, 23, 58, 30, 24, 42, 15, 23, 29, 22,
+    44, 25, 12, 25, 11, 31, 13, 27, 32, 39, 12, 25, 23, 29, 18, 13, 19, 27, 31, 39,
+    33, 37, 23, 29, 33, 43, 26, 22, 51, 39, 25, 53, 46, 28, 34, 18, 38, 51, 66, 28,
+    29, 43, 33, 34, 31, 34, 34, 24, 46, 21, 43, 29, 53, 18, 25, 27, 44, 27, 33, 20,
+    29, 37, 36, 21, 21, 25, 29, 38, 20, 41, 37, 37, 21, 26, 20, 37, 20, 30, 54, 55,
+    24, 43, 26, 81, 40, 40, 44, 14, 47, 40, 14, 17, 29, 43, 27, 17, 19, 8, 30, 19,
+    32, 31, 31, 32, 34, 21, 30, 17, 18, 17, 22, 14, 42, 22, 18, 31, 19, 23, 16, 22,
+    15, 19, 14, 19, 34, 11, 37, 20, 12, 21, 27, 28, 23, 9, 27, 36, 27, 21, 33, 25,
+    33, 27, 23, 11, 70, 13, 24, 17, 22, 28, 36, 15, 44, 11, 20, 32, 23, 19, 19, 73,
+    18, 38, 39, 36, 47, 31, 22, 23, 15, 17, 14, 14, 10, 17, 32, 3, 22, 13, 26, 21,
+    27, 30, 21, 22, 35, 22, 20, 25, 28, 22, 35, 22, 16, 21, 29, 29, 34, 30, 17, 25,
+    6, 14, 23, 28, 25, 31, 40, 22, 33, 37, 16, 33, 24, 41, 30, 24, 34, 17, 6, 12,
+    8, 8, 12, 10, 17, 9, 20, 18, 7, 8, 6, 7, 5, 11, 15, 50, 14, 9, 13, 31,
+    6, 10, 22, 12, 14, 9, 11, 12, 24, 11, 22, 22, 28, 12, 40, 22, 13, 17, 13, 11,
+    5, 20, 28, 22, 35, 22, 46, 18, 16, 18, 12, 5, 12, 20, 12, 23, 11, 13, 12, 9,
+    9, 5, 8, 28, 22, 35, 45, 48, 43, 13, 31, 7, 10, 10, 9, 8, 18, 19, 2, 29,
+    18, 7, 8, 9, 4, 8, 5, 6, 5, 6, 8, 8, 3, 18, 3, 3, 21, 26, 9, 8,
+    24, 13, 10, 7, 12, 15, 21, 10, 20, 14, 9, 6, 7, 23, 11, 13, 176, 9, 8, 9,
+    4, 8, 5, 6, 5, 3, 8, 8, 3, 18, 3, 3, 21, 26, 9, 8, 24, 13, 10, 7,
+    12, 15, 21, 10, 20, 14, 9, 6, 33, 22, 35, 27, 23, 35, 27, 36, 18, 32, 31, 28,
+    25, 35, 33, 33, 28, 24, 29, 30, 31, 29, 35, 34, 28, 28, 27, 28, 27, 33, 31, 18,
+    26, 22, 16, 20, 12, 29, 17, 18, 20, 10, 14, 17, 17, 11, 16, 16, 13, 13, 14, 31,
+    22, 26, 6, 30, 13, 25, 22, 21, 34, 16, 6, 22, 32, 9, 14, 14, 7, 25, 6, 17,
+    25, 18, 23, 12, 21, 13, 29, 24, 33, 9, 20, 24, 17, 10, 22, 38, 22, 8, 31, 29,
+    25, 28, 28, 25, 13, 15, 22, 26, 11, 23, 15, 12, 17, 13, 12, 21, 14, 21, 22, 11,
+    12, 19, 12, 25, 24, 19, 37, 25, 31, 31, 30, 34, 22, 26, 25, 23, 17, 27, 22, 21,
+    21, 27, 23, 15, 18, 14, 30, 40, 10, 38, 24, 22, 17, 32, 24, 40, 44, 26, 22, 19,
+    32, 21, 28, 18, 16, 18, 22, 13, 30, 5, 28, 7, 47, 39, 46, 64, 34, 22, 22, 66,
+    22, 22, 28, 10, 27, 17, 17, 14, 27, 18, 11, 22, 25, 28, 23, 23, 8, 63, 24, 32,
+    14, 49, 32, 31, 49, 27, 17, 21, 36, 26, 21, 26, 18, 32, 33, 31, 15, 38, 28, 23,
+    29, 49, 26, 20, 27, 31, 25, 24, 23, 35, 21, 49, 30, 37, 31, 28, 28, 27, 27, 21,
+    45, 13, 11, 23, 5, 19, 15, 11, 16, 14, 17, 15, 12, 14, 16, 9, 20, 32, 21, 15,
+    16, 15, 13, 27, 14, 17, 14, 15, 21, 17, 10, 10, 11, 16, 13, 12, 13, 15, 16, 20,
+    15, 13, 19, 17, 20, 19, 18, 15, 20, 15, 23, 21, 13, 10, 14, 11, 15, 14, 23, 17,
+    12, 17, 14, 9, 21, 14, 17, 18, 6, 25, 23, 17, 25, 48, 34, 29, 34, 38, 42, 30,
+    50, 58, 36, 39, 28, 27, 35, 30, 34, 46, 46, 39, 51, 46, 75, 66, 20, 45, 28, 35,
+    41, 43, 56, 37, 38, 50, 52, 33, 44, 37, 72, 47, 20, 80, 52, 38, 44, 39, 49, 50,
+    56, 62, 42, 54, 59, 35, 35, 32, 31, 37, 43, 48, 47, 38, 71, 56, 53, 51, 25, 36,
+    54, 47, 71, 53, 59, 41, 42, 57, 50, 38, 31, 27, 33, 26, 40, 42, 31, 25, 26, 47,
+    26, 37, 42, 15, 60, 40, 43, 48, 30, 25, 52, 28, 41, 40, 34, 28, 41, 38, 40, 30,
+    35, 27, 27, 32, 44, 31, 32, 29, 31, 25, 21, 23, 25, 39, 33, 21, 36, 21, 14, 26,
+    33, 24, 31, 16, 23, 21, 13, 20, 40, 13, 27, 33, 34, 31, 13, 40, 58, 24, 24, 17,
+    18, 18, 21, 18, 16, 24, 15, 18, 33, 21, 14, 24, 21, 29, 31, 26, 18, 23, 22, 21,
+    28, 30, 14, 30, 30, 21, 23, 29, 23, 25, 18, 10, 20, 13, 18, 28, 12, 17, 18, 20,
+    15, 16, 16, 25, 21, 18, 26, 17, 22, 16, 15, 15, 25, 14, 18, 19, 16, 14, 20, 28,
+    13, 28, 39, 40, 29, 25, 27, 26, 18, 17, 20, 25, 25, 22, 19, 14, 21, 22, 18, 10,
+    29, 24, 21, 21, 13, 14, 25, 20, 29, 22, 11, 14, 17, 17, 13, 21, 11, 19, 17, 18,
+    20, 8, 21, 18, 24, 21, 15, 27, 21,
+};
+
+const uint16_t BIBLE_CHAPTER_ORDINAL[BIBLE_CHAPTERS_COUNT + 1] = {
+    0, 31, 56, 80, 106, 138, 160, 184, 206, 235, 267, 299,
+    319, 337, 361, 382, 398, 425, 458, 496, 514, 548, 572, 592,
+    659, 693, 728, 774, 796, 831, 874, 929, 961, 981, 1012, 1041,
+    1084, 1120, 1150, 1173, 1196, 1253, 1291, 1325, 1359, 1387, 1421, 1452,
+    1474, 1507, 1533, 1555, 1580, 1602, 1633, 1656, 1686, 1711, 1743, 1778,
+    1807, 1817, 1868, 1890, 1921, 1948, 1984, 2000, 2027, 2052, 2078, 2114,
+    2145, 2178, 2196, 2236, 2273, 2294, 2337, 2383, 2421, 2439, 2474, 2497,
+    2532, 2567, 2605, 2634, 2665, 2708, 2746, 2763, 2779, 2796, 2831, 2850,
+    2880, 2918, 2954, 2978, 2998, 3045, 3053, 3112, 3169, 3202, 3236, 3252,
+    3282, 3306, 3322, 3337, 3386, 3438, 3483, 3506, 3532, 3552, 3606, 3640,
+    3691, 3740, 3771, 3798, 3887, 3913, 3936, 3972, 4007, 4023, 4056, 4101,
+    4142, 4192, 4205, 4237, 4259, 4288, 4323, 4364, 4394, 4419, 4437, 4502,
+    4525, 4556, 4596, 4612, 4666, 4708, 4764, 4793, 4827, 4840, 4886, 4923,
+    4952, 5001, 5034, 5059, 5085, 5105, 5134, 5156, 5188, 5220, 5238, 5267,
+    5290, 5312, 5332, 5354, 5375, 5395, 5418, 5448, 5473, 5495, 5514, 5533,
+    5559, 5627, 5656, 5676, 5706, 5758, 5787, 5799, 5817, 5841, 5858, 5882,
+    5897, 5924, 5950, 5985, 6012, 6055, 6078, 6102, 6135, 6150, 6213, 6223,
+    6241, 6269, 6320, 6329, 6374, 6408, 6424, 6457, 6493, 6516, 6547, 6571,
+    6602, 6642, 6667, 6702, 6759, 6777, 6817, 6832, 6857, 6877, 6897, 6928,
+    6941, 6972, 7002, 7050, 7075, 7097, 7120, 7138, 7160, 7188, 7224, 7245,
+    7267, 7279, 7300, 7317, 7339, 7366, 7393, 7408, 7433, 7456, 7508, 7543,
+    7566, 7624, 7654, 7678, 7720, 7735, 7758, 7787, 7809, 7853, 7878, 7890,
+    7915, 7926, 7957, 7970, 7997, 8029, 8068, 8080, 8105, 8128, 8157, 8175,
+    8188, 8207, 8234, 8265, 8304, 8337, 8374, 8397, 8426, 8459, 8502, 8528,
+    8550, 8601, 8640, 8665, 8718, 8764, 8792, 8826, 8844, 8882, 8933, 8999,
+    9027, 9056, 9099, 9132, 9166, 9197, 9231, 9265, 9289, 9335, 9356, 9399,
+    9428, 9481, 9499, 9524, 9551, 9595, 9622, 9655, 9675, 9704, 9741, 9777,
+    9798, 9819, 9844, 9873, 9911, 9931, 9972, 10009, 10046, 10067, 10093, 10113,
+    10150, 10170, 10200, 10254, 10309, 10333, 10376, 10402, 10483, 10523, 10563, 10607,
+    10621, 10668, 10708, 10722, 10739, 10768, 10811, 10838, 10855, 10874, 10882, 10912,
+    10931, 10963, 10994, 11025, 11057, 11091, 11112, 11142, 11159, 11177, 11194, 11216,
+    11230, 11272, 11294, 11312, 11343, 11362, 11385, 11401, 11423, 11438, 11457, 11471,
+    11490, 11524, 11535, 11572, 11592, 11604, 11625, 11652, 11680, 11703, 11712, 11739,
+    11775, 11802, 11823, 11856, 11881, 11914, 11941, 11964, 11975, 12045, 12058, 12082,
+    12099, 12121, 12149, 12185, 12200, 12244, 12255, 12275, 12307, 12330, 12349, 12368,
+    12441, 12459, 12497, 12536, 12572, 12619, 12650, 12672, 12695, 12710, 12727, 12741,
+    12755, 12765, 12782, 12814, 12817, 12839, 12852, 12878, 12899, 12926, 12956, 12977,
+    12999, 13034, 13056, 13076, 13101, 13129, 13151, 13186, 13208, 13224, 13245, 13274,
+    13303, 13337, 13367, 13384, 13409, 13415, 13429, 13452, 13480, 13505, 13536, 13576,
+    13598, 13631, 13668, 13684, 13717, 13741, 13782, 13812, 13836, 13870, 13887, 13893,
+    13905, 13913, 13921, 13933, 13943, 13960, 13969, 13989, 14007, 14014, 14022, 14028,
+    14035, 14040, 14051, 14066, 14116, 14130, 14139, 14152, 14183, 14189, 14199, 14221,
+    14233, 14247, 14256, 14267, 14279, 14303, 14314, 14336, 14358, 14386, 14398, 14438,
+    14460, 14473, 14490, 14503, 14514, 14519, 14539, 14567, 14589, 14624, 14646, 14692,
+    14710, 14726, 14744, 14756, 14761, 14773, 14793, 14805, 14828, 14839, 14852, 14864,
+    14873, 14882, 14887, 14895, 14923, 14945, 14980, 15025, 15073, 15116, 15129, 15160,
+    15167, 15177, 15187, 15196, 15204, 15222, 15241, 15243, 15272, 15290, 15297, 15305,
+    15314, 15318, 15326, 15331, 15337, 15342, 15348, 15356, 15364, 15367, 15385, 15388,
+    15391, 15412, 15438, 15447, 15455, 15479, 15492, 15502, 15509, 15521, 15536, 15557,
+    15567, 15587, 15601, 15610, 15616, 15623, 15646, 15657, 15670, 15846, 15855, 15863,
+    15872, 15876, 15884, 15889, 15895, 15900, 15903, 15911, 15919, 15922, 15940, 15943,
+    15946, 15967, 15993, 16002, 16010, 16034, 16047, 16057, 16064, 16076, 16091, 16112,
+    16122, 16142, 16156, 16165, 16171, 16204, 16226, 16261, 16288, 16311, 16346, 16373,
+    16409, 16427, 16459, 16490, 16518, 16543, 16578, 16611, 16644, 16672, 16696, 16725,
+    16755, 16786, 16815, 16850, 16884, 16912, 16940, 16967, 16995, 17022, 17055, 17086,
+    17104, 17130, 17152, 17168, 17188, 17200, 17229, 17246, 17264, 17284, 17294, 17308,
+    17325, 17342, 17353, 17369, 17385, 17398, 17411, 17425, 17456, 17478, 17504, 17510,
+    17540, 17553, 17578, 17600, 17621, 17655, 17671, 17677, 17699, 17731, 17740, 17754,
+    17768, 17775, 17800, 17806, 17823, 17848, 17866, 17889, 17901, 17922, 17935, 17964,
+    17988, 18021, 18030, 18050, 18074, 18091, 18101, 18123, 18161, 18183, 18191, 18222,
+    18251, 18276, 18304, 18332, 18357, 18370, 18385, 18407, 18433, 18444, 18467, 18482,
+    18494, 18511, 18524, 18536, 18557, 18571, 18592, 18614, 18625, 18637, 18656, 18668,
+    18693, 18717, 18736, 18773, 18798, 18829, 18860, 18890, 18924, 18946, 18972, 18997,
+    19020, 19037, 19064, 19086, 19107, 19128, 19155, 19178, 19193, 19211, 19225, 19255,
+    19295, 19305, 19343, 19367, 19389, 19406, 19438, 19462, 19502, 19546, 19572, 19594,
+    19613, 19645, 19666, 19694, 19712, 19728, 19746, 19768, 19781, 19811, 19816, 19844,
+    19851, 19898, 19937, 19983, 20047, 20081, 20103, 20125, 20191, 20213, 20235, 20263,
+    20273, 20300, 20317, 20334, 20348, 20375, 20393, 20404, 20426, 20451, 20479, 20502,
+    20525, 20533, 20596, 20620, 20652, 20666, 20715, 20747, 20778, 20827, 20854, 20871,
+    20892, 20928, 20954, 20975, 21001, 21019, 21051, 21084, 21115, 21130, 21168, 21196,
+    21219, 21248, 21297, 21323, 21343, 21370, 21401, 21426, 21450, 21473, 21508, 21529,
+    21578, 21608, 21645, 21676, 21704, 21732, 21759, 21786, 21807, 21852, 21865, 21876,
+    21899, 21904, 21923, 21938, 21949, 21965, 21979, 21996, 22011, 22023, 22037, 22053,
+    22062, 22082, 22114, 22135, 22150, 22166, 22181, 22194, 22221, 22235, 22252, 22266,
+    22281, 22302, 22319, 22329, 22339, 22350, 22366, 22379, 22391, 22404, 22419, 22435,
+    22455, 22470, 22483, 22502, 22519, 22539, 22558, 22576, 22591, 22611, 22626, 22649,
+    22670, 22683, 22693, 22707, 22718, 22733, 22747, 22770, 22787, 22799, 22816, 22830,
+    22839, 22860, 22874, 22891, 22909, 22915, 22940, 22963, 22980, 23005, 23053, 23087,
+    23116, 23150, 23188, 23230, 23260, 23310, 23368, 23404, 23443, 23471, 23498, 23533,
+    23563, 23597, 23643, 23689, 23728, 23779, 23825, 23900, 23966, 23986, 24031, 24059,
+    24094, 24135, 24178, 24234, 24271, 24309, 24359, 24411, 24444, 24488, 24525, 24597,
+    24644, 24664, 24744, 24796, 24834, 24878, 24917, 24966, 25016, 25072, 25134, 25176,
+    25230, 25289, 25324, 25359, 25391, 25422, 25459, 25502, 25550, 25597, 25635, 25706,
+    25762, 25815, 25866, 25891, 25927, 25981, 26028, 26099, 26152, 26211, 26252, 26294,
+    26351, 26401, 26439, 26470, 26497, 26530, 26556, 26596, 26638, 26669, 26694, 26720,
+    26767, 26793, 26830, 26872, 26887, 26947, 26987, 27030, 27078, 27108, 27133, 27185,
+    27213, 27254, 27294, 27328, 27356, 27397, 27435, 27475, 27505, 27540, 27567, 27594,
+    27626, 27670, 27701, 27733, 27762, 27793, 27818, 27839, 27862, 27887, 27926, 27959,
+    27980, 28016, 28037, 28051, 28077, 28110, 28134, 28165, 28181, 28204, 28225, 28238,
+    28258, 28298, 28311, 28338, 28371, 28405, 28436, 28449, 28489, 28547, 28571, 28595,
+    28612, 28630, 28648, 28669, 28687, 28703, 28727, 28742, 28760, 28793, 28814, 28828,
+    28852, 28873, 28902, 28933, 28959, 28977, 29000, 29022, 29043, 29071, 29101, 29115,
+    29145, 29175, 29196, 29219, 29248, 29271, 29296, 29314, 29324, 29344, 29357, 29375,
+    29403, 29415, 29432, 29450, 29470, 29485, 29501, 29517, 29542, 29563, 29581, 29607,
+    29624, 29646, 29662, 29677, 29692, 29717, 29731, 29749, 29768, 29784, 29798, 29818,
+    29846, 29859, 29887, 29926, 29966, 29995, 30020, 30047, 30073, 30091, 30108, 30128,
+    30153, 30178, 30200, 30219, 30233, 30254, 30276, 30294, 30304, 30333, 30357, 30378,
+    30399, 30412, 30426, 30451, 30471, 30500, 30522, 30533, 30547, 30564, 30581, 30594,
+    30615, 30626, 30645, 30662, 30680, 30700, 30708, 30729, 30747, 30771, 30792, 30807,
+    30834, 30855,
+};
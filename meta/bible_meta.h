@@ -0,0 +1,53 @@
+// bible_meta.h — Bible book metadata tables
+// Generated by tools/gen_meta.py from meta/books.txt; do not edit.
+// Pure C (no Furi dependencies) so it can be shared with host tools.
+//
+// Names are offsets into one NUL-separated pool. Chapter tables are flat,
+// and BIBLE_CHAPTER_START gives each book's first chapter. Verse ordinals
+// count from Genesis 1:1 = 0, so ordinal math is two lookups.
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BIBLE_BOOKS_COUNT    66
+#define BIBLE_CHAPTERS_COUNT 1189
+#define BIBLE_VERSES_COUNT   30855
+#define BIBLE_LANG_COUNT     2
+#define BIBLE_ALIAS_COUNT    2
+
+typedef enum {
+    BibleLangEn,   // first column: the names the app shows
+    BibleLangDe,
+} BibleLang;
+
+extern const char     BIBLE_NAME_POOL[];
+extern const char     BIBLE_LANG_CODES[BIBLE_LANG_COUNT][4];
+extern const uint16_t BIBLE_BOOK_NAME[BIBLE_LANG_COUNT][BIBLE_BOOKS_COUNT];
+extern const uint16_t BIBLE_ALIAS_NAME[BIBLE_ALIAS_COUNT];
+extern const uint8_t  BIBLE_ALIAS_BOOK[BIBLE_ALIAS_COUNT];
+extern const uint8_t  BIBLE_BOOK_CHAPTERS[BIBLE_BOOKS_COUNT];
+extern const uint16_t BIBLE_CHAPTER_START[BIBLE_BOOKS_COUNT + 1];
+extern const uint8_t  BIBLE_VERSE_COUNTS[BIBLE_CHAPTERS_COUNT];
+extern const uint16_t BIBLE_CHAPTER_ORDINAL[BIBLE_CHAPTERS_COUNT + 1];
+
+// Callers check book < BIBLE_BOOKS_COUNT and 1 <= chapter <= its count
+
+static inline const char* bible_meta_name(BibleLang lang, uint8_t book) {
+    return BIBLE_NAME_POOL + BIBLE_BOOK_NAME[lang][book];
+}
+
+static inline uint8_t bible_chapter_verses(uint8_t book, uint8_t chapter) {
+    return BIBLE_VERSE_COUNTS[BIBLE_CHAPTER_START[book] + chapter - 1];
+}
+
+// 0-based position of book chapter:verse in the whole Bible
+static inline uint16_t bible_verse_ordinal(uint8_t book, uint8_t chapter, uint8_t verse) {
+    return (uint16_t)(BIBLE_CHAPTER_ORDINAL[BIBLE_CHAPTER_START[book] + chapter - 1] + verse - 1);
+}
+
+#ifdef __cplusplus
+}
+#endif
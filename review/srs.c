@@ -0,0 +1,256 @@
+// srs.c — Spaced-repetition deck for verse memorization
+//
+// File layout: "BVCD" + version byte + 3 reserved bytes, then one
+// record per card in insertion order:
+//   u32 id, u32 due, u16 interval, u16 ease, u8 reps, u8 lapses
+// Records never move, so a card's slot is its file position for life.
+
+#include "srs.h"
+
+#define SRS_MAGIC    "BVCD"
+#define SRS_VERSION  1
+#define SRS_HDR_SZ   8
+#define SRS_REC_SZ   14
+#define SRS_GROW     64
+#define SRS_CHUNK    16   // records per read while loading or scanning
+
+struct SrsDeck {
+    Storage*  storage;
+    char      path[104];
+    uint32_t* due;    // heap order: min-heap on due day
+    uint16_t* slot;   // record slot of each heap entry
+    uint16_t  count;
+    uint16_t  cap;
+};
+
+// ============================================================
+// Records
+// ============================================================
+
+static void rec_encode(const SrsCard* c, uint8_t* b) {
+    for(uint8_t i = 0; i < 4; i++) {
+        b[i]     = (uint8_t)(c->id  >> (8 * i));
+        b[4 + i] = (uint8_t)(c->due >> (8 * i));
+    }
+    b[8]  = (uint8_t)c->interval;  b[9]  = (uint8_t)(c->interval >> 8);
+    b[10] = (uint8_t)c->ease;      b[11] = (uint8_t)(c->ease >> 8);
+    b[12] = c->reps;
+    b[13] = c->lapses;
+}
+
+static void rec_decode(const uint8_t* b, SrsCard* c) {
+    c->id  = (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+    c->due = (uint32_t)b[4] | ((uint32_t)b[5] << 8) | ((uint32_t)b[6] << 16) | ((uint32_t)b[7] << 24);
+    c->interval = (uint16_t)(b[8]  | (b[9]  << 8));
+    c->ease     = (uint16_t)(b[10] | (b[11] << 8));
+    c->reps     = b[12];
+    c->lapses   = b[13];
+}
+
+static bool rec_read(SrsDeck* d, uint16_t slot, SrsCard* c) {
+    File* f = storage_file_alloc(d->storage);
+    bool ok = false;
+    if(storage_file_open(f, d->path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint8_t b[SRS_REC_SZ];
+        ok = storage_file_seek(f, SRS_HDR_SZ + (uint32_t)slot * SRS_REC_SZ, true) &&
+             storage_file_read(f, b, sizeof(b)) == sizeof(b);
+        if(ok) rec_decode(b, c);
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    return ok;
+}
+
+// Write one record in place; slot == count appends. The first card
+// starts a fresh file, replacing one srs_open could not read.
+static bool rec_write(SrsDeck* d, uint16_t slot, const SrsCard* c) {
+    File* f = storage_file_alloc(d->storage);
+    bool ok = false;
+    FS_OpenMode mode = d->count ? FSOM_OPEN_ALWAYS : FSOM_CREATE_ALWAYS;
+    if(storage_file_open(f, d->path, FSAM_READ_WRITE, mode)) {
+        ok = true;
+        if(storage_file_size(f) < SRS_HDR_SZ) {
+            uint8_t hdr[SRS_HDR_SZ] = { 'B', 'V', 'C', 'D', SRS_VERSION, 0, 0, 0 };
+            ok = storage_file_write(f, hdr, sizeof(hdr)) == sizeof(hdr);
+        }
+        uint8_t b[SRS_REC_SZ];
+        rec_encode(c, b);
+        ok = ok && storage_file_seek(f, SRS_HDR_SZ + (uint32_t)slot * SRS_REC_SZ, true) &&
+             storage_file_write(f, b, sizeof(b)) == sizeof(b);
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    return ok;
+}
+
+// ============================================================
+// Due queue
+// ============================================================
+
+static void heap_swap(SrsDeck* d, uint16_t a, uint16_t b) {
+    uint32_t t = d->due[a];  d->due[a]  = d->due[b];  d->due[b]  = t;
+    uint16_t s = d->slot[a]; d->slot[a] = d->slot[b]; d->slot[b] = s;
+}
+
+static void heap_sift_down(SrsDeck* d, uint16_t i) {
+    for(;;) {
+        uint32_t l = 2u * i + 1, r = l + 1, m = i;
+        if(l < d->count && d->due[l] < d->due[m]) m = l;
+        if(r < d->count && d->due[r] < d->due[m]) m = r;
+        if(m == i) return;
+        heap_swap(d, i, (uint16_t)m);
+        i = (uint16_t)m;
+    }
+}
+
+static void heap_sift_up(SrsDeck* d, uint16_t i) {
+    while(i > 0) {
+        uint16_t p = (uint16_t)((i - 1) / 2);
+        if(d->due[p] <= d->due[i]) return;
+        heap_swap(d, i, p);
+        i = p;
+    }
+}
+
+static bool heap_reserve(SrsDeck* d, uint16_t n) {
+    if(n <= d->cap) return true;
+    if(n > SRS_MAX_CARDS) return false;
+    uint16_t cap = (uint16_t)((n + SRS_GROW - 1) / SRS_GROW * SRS_GROW);
+    uint32_t* due  = realloc(d->due,  (size_t)cap * sizeof(uint32_t));
+    if(due) d->due = due;
+    uint16_t* slot = realloc(d->slot, (size_t)cap * sizeof(uint16_t));
+    if(slot) d->slot = slot;
+    if(!due || !slot) return false;
+    d->cap = cap;
+    return true;
+}
+
+static uint16_t due_below(const SrsDeck* d, uint32_t i, uint32_t today) {
+    if(i >= d->count || d->due[i] > today) return 0;
+    return (uint16_t)(1 + due_below(d, 2 * i + 1, today) + due_below(d, 2 * i + 2, today));
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+SrsDeck* srs_open(Storage* storage, const char* path) {
+    SrsDeck* d = malloc(sizeof(SrsDeck));
+    if(!d) return NULL;
+    memset(d, 0, sizeof(*d));
+    d->storage = storage;
+    strncpy(d->path, path, sizeof(d->path) - 1);
+
+    File* f = storage_file_alloc(storage);
+    if(storage_file_open(f, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint8_t hdr[SRS_HDR_SZ];
+        if(storage_file_read(f, hdr, sizeof(hdr)) == sizeof(hdr) &&
+           memcmp(hdr, SRS_MAGIC, 4) == 0 && hdr[4] == SRS_VERSION) {
+            uint32_t n = (uint32_t)((storage_file_size(f) - SRS_HDR_SZ) / SRS_REC_SZ);
+            if(n > SRS_MAX_CARDS) n = SRS_MAX_CARDS;
+            if(heap_reserve(d, (uint16_t)n)) {
+                uint8_t buf[SRS_CHUNK * SRS_REC_SZ];
+                while(d->count < n) {
+                    uint16_t want = (uint16_t)MIN(n - d->count, SRS_CHUNK);
+                    uint16_t got  = storage_file_read(f, buf, want * SRS_REC_SZ) / SRS_REC_SZ;
+                    for(uint16_t i = 0; i < got; i++) {
+                        SrsCard c;
+                        rec_decode(buf + i * SRS_REC_SZ, &c);
+                        d->due[d->count]  = c.due;
+                        d->slot[d->count] = d->count;
+                        d->count++;
+                    }
+                    if(got < want) break;
+                }
+                for(int32_t i = d->count / 2 - 1; i >= 0; i--) heap_sift_down(d, (uint16_t)i);
+            }
+        }
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    return d;
+}
+
+void srs_close(SrsDeck* d) {
+    if(!d) return;
+    free(d->due);
+    free(d->slot);
+    free(d);
+}
+
+uint16_t srs_count(const SrsDeck* d) {
+    return d->count;
+}
+
+uint16_t srs_due_count(const SrsDeck* d, uint32_t today) {
+    return due_below(d, 0, today);
+}
+
+bool srs_peek_due(SrsDeck* d, uint32_t today, SrsCard* out) {
+    if(!d->count || d->due[0] > today) return false;
+    return rec_read(d, d->slot[0], out);
+}
+
+bool srs_grade(SrsDeck* d, uint8_t quality, uint32_t today) {
+    SrsCard c;
+    if(!srs_peek_due(d, today, &c)) return false;
+    srs_schedule(&c, quality, today);
+    if(!rec_write(d, d->slot[0], &c)) return false;
+    d->due[0] = c.due;
+    heap_sift_down(d, 0);
+    return true;
+}
+
+bool srs_add(SrsDeck* d, uint32_t id, uint32_t today) {
+    if(d->count >= SRS_MAX_CARDS) return false;
+
+    // Adding is rare; a sequential scan of the file keeps ids out of RAM
+    File* f = storage_file_alloc(d->storage);
+    bool dup = false;
+    if(d->count && storage_file_open(f, d->path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint8_t buf[SRS_CHUNK * SRS_REC_SZ];
+        storage_file_seek(f, SRS_HDR_SZ, true);
+        uint16_t got;
+        while(!dup && (got = storage_file_read(f, buf, sizeof(buf)) / SRS_REC_SZ) > 0) {
+            for(uint16_t i = 0; i < got && !dup; i++) {
+                const uint8_t* b = buf + i * SRS_REC_SZ;
+                dup = ((uint32_t)b[0] | ((uint32_t)b[1] << 8) |
+                       ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24)) == id;
+            }
+        }
+        storage_file_close(f);
+    }
+    storage_file_free(f);
+    if(dup || !heap_reserve(d, (uint16_t)(d->count + 1))) return false;
+
+    SrsCard c = { .id = id, .due = today, .interval = 0, .ease = SRS_EASE_INIT };
+    if(!rec_write(d, d->count, &c)) return false;
+    d->due[d->count]  = c.due;
+    d->slot[d->count] = d->count;
+    d->count++;
+    heap_sift_up(d, (uint16_t)(d->count - 1));
+    return true;
+}
+
+void srs_schedule(SrsCard* c, uint8_t quality, uint32_t today) {
+    if(quality > 5) quality = 5;
+    if(quality < 3) {
+        // Lapse: relearn from a one-day interval
+        if(c->reps) c->lapses++;
+        c->reps     = 0;
+        c->interval = 1;
+    } else {
+        if(c->reps == 0)      c->interval = 1;
+        else if(c->reps == 1) c->interval = 6;
+        else {
+            uint32_t iv = ((uint32_t)c->interval * c->ease + 500) / 1000;
+            c->interval = (uint16_t)MIN(iv, 36500u);
+        }
+        if(c->reps < 255) c->reps++;
+    }
+    // EF' = EF + 0.1 - (5 - q) * (0.08 + (5 - q) * 0.02)
+    int32_t miss = 5 - quality;
+    int32_t ease = (int32_t)c->ease + 100 - miss * (80 + miss * 20);
+    c->ease = (uint16_t)MAX(ease, SRS_EASE_MIN);
+    c->due  = today + c->interval;
+}
@@ -0,0 +1,57 @@
+// srs.h — Spaced-repetition deck for verse memorization
+//
+// SM-2 scheduling over a flat card file. Each card is a fixed 14-byte
+// record keyed by canonical verse id, so a review rewrites one record in
+// place. Only the due queue lives in RAM: a binary min-heap of
+// (due day, record slot), 6 bytes per card, so the next due card is at
+// the root and a review costs O(log n).
+#pragma once
+#include <furi.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SRS_MAX_CARDS 4096
+#define SRS_EASE_INIT 2500   // ease factor x1000
+#define SRS_EASE_MIN  1300
+
+typedef struct {
+    uint32_t id;         // canonical verse id, see verse_canon_id
+    uint32_t due;        // day number (days since 1970-01-01)
+    uint16_t interval;   // days
+    uint16_t ease;       // x1000
+    uint8_t  reps;       // successful reviews in a row
+    uint8_t  lapses;
+} SrsCard;
+
+typedef struct SrsDeck SrsDeck;
+
+// Open (or create) the card file and build the due queue. NULL on
+// allocation failure; a missing or unreadable file gives an empty deck.
+SrsDeck* srs_open(Storage* storage, const char* path);
+void     srs_close(SrsDeck* d);
+
+uint16_t srs_count(const SrsDeck* d);
+
+// Cards due on or before today. Walks only the due part of the heap.
+uint16_t srs_due_count(const SrsDeck* d, uint32_t today);
+
+// The most overdue card, if any is due today
+bool srs_peek_due(SrsDeck* d, uint32_t today, SrsCard* out);
+
+// Grade the card srs_peek_due returned (quality 0..5, SM-2 scale),
+// rewrite its record and requeue it
+bool srs_grade(SrsDeck* d, uint8_t quality, uint32_t today);
+
+// Add a new card due today. False if the id is already in the deck or
+// the deck is full.
+bool srs_add(SrsDeck* d, uint32_t id, uint32_t today);
+
+// SM-2 update of one card; exposed for host tools
+void srs_schedule(SrsCard* c, uint8_t quality, uint32_t today);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,66 @@
+// idxfmt.c — Layout of the .idx verse index cache
+
+#include "idxfmt.h"
+
+#include <string.h>
+
+void idx_header_put(uint8_t hdr[IDX_HDR_SZ], uint16_t verse_count, uint32_t src_size) {
+    memcpy(hdr, IDX_MAGIC, 4);
+    hdr[4] = IDX_VERSION;
+    idx_put_u16(hdr + 5, verse_count);
+    idx_put_u32(hdr + 7, src_size);
+}
+
+bool idx_header_get(const uint8_t hdr[IDX_HDR_SZ], uint16_t* verse_count, uint32_t* src_size) {
+    if(memcmp(hdr, IDX_MAGIC, 4) != 0 || hdr[4] != IDX_VERSION) return false;
+    *verse_count = idx_get_u16(hdr + 5);
+    *src_size    = idx_get_u32(hdr + 7);
+    return true;
+}
+
+void idx_entry_put(uint8_t e[IDX_ENTRY_SZ], uint32_t offset, const char* ref, uint8_t book) {
+    idx_put_u32(e, offset);
+    memcpy(e + 4, ref, REF_LEN);
+    e[4 + REF_LEN] = book;
+}
+
+uint32_t idx_entry_get(const uint8_t e[IDX_ENTRY_SZ], char* ref, uint8_t* book) {
+    if(ref) {
+        memcpy(ref, e + 4, REF_LEN);
+        ref[REF_LEN - 1] = '\0';
+    }
+    if(book) *book = e[4 + REF_LEN];
+    return idx_get_u32(e);
+}
+
+void idx_section_put(uint8_t sh[IDX_SEC_HDR_SZ], const char* tag, uint32_t len) {
+    memcpy(sh, tag, 4);
+    idx_put_u32(sh + 4, len);
+}
+
+void idx_sections_read(const IdxReader* rd, uint32_t at, IdxSections* out) {
+    memset(out, 0, sizeof(*out));
+    uint8_t sh[IDX_SEC_HDR_SZ];
+    while(rd->read(rd->ctx, sh, sizeof(sh))) {
+        uint32_t len  = idx_get_u32(sh + 4);
+        uint32_t body = at + IDX_SEC_HDR_SZ;
+        uint8_t  th[3];
+        if(memcmp(sh, IDX_SEC_PHON, 4) == 0 && len >= 3) {
+            if(!rd->read(rd->ctx, th, 3)) break;
+            out->phon_algo  = th[0];
+            out->phon_count = idx_get_u16(th + 1);
+            out->phon_off   = body + 3;
+        } else if(memcmp(sh, IDX_SEC_LSH, 4) == 0 && len >= 3) {
+            if(!rd->read(rd->ctx, th, 3)) break;
+            out->lsh_bands = th[0];
+            out->lsh_count = idx_get_u16(th + 1);
+            out->lsh_off   = body + 3;
+        } else if(memcmp(sh, IDX_SEC_MARK, 4) == 0 && len >= 2) {
+            if(!rd->read(rd->ctx, th, 2)) break;
+            out->mark_count = idx_get_u16(th);
+            out->mark_off   = body + 2;
+        }
+        at = body + len;
+        if(!rd->seek(rd->ctx, at)) break;
+    }
+}
@@ -0,0 +1,91 @@
+// idxfmt.h — Layout of the .idx verse index cache
+// Pure C (no Furi dependencies) so it can be shared with host tools.
+//
+// An 11-byte header ("BVIX", version u8, verse count u16, verse file
+// size u32), verse_count fixed-size entries (offset u32, reference,
+// book u8), then optional sections, each a 4-byte tag + u32 length +
+// payload. All integers are little-endian. Unknown sections are skipped
+// on load.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IDX_MAGIC      "BVIX"
+#define IDX_VERSION    ((uint8_t)6)
+#define REF_LEN        24   // verse reference, NUL-terminated
+#define IDX_HDR_SZ     11
+#define IDX_ENTRY_SZ   (4 + REF_LEN + 1)
+#define IDX_SEC_HDR_SZ 8
+
+// PHON: algo u8, count u16, then (key u32, verse u16, span u16) sorted
+#define IDX_SEC_PHON   "PHON"
+#define PHON_ENTRY_SZ  8
+// LSHB: bands u8, count u16, then per band count (bucket u16, verse u16)
+#define IDX_SEC_LSH    "LSHB"
+#define LSH_ENTRY_SZ   4
+// MARK: count u16, then (verse u16, open u16, close u16, kind u8)
+#define IDX_SEC_MARK   "MARK"
+#define MARK_ENTRY_SZ  7
+
+static inline void idx_put_u16(uint8_t* b, uint16_t v) {
+    b[0] = (uint8_t)(v & 0xFF);
+    b[1] = (uint8_t)(v >> 8);
+}
+
+static inline void idx_put_u32(uint8_t* b, uint32_t v) {
+    for(uint8_t i = 0; i < 4; i++) b[i] = (uint8_t)((v >> (8 * i)) & 0xFF);
+}
+
+static inline uint16_t idx_get_u16(const uint8_t* b) {
+    return (uint16_t)b[0] | ((uint16_t)b[1] << 8);
+}
+
+static inline uint32_t idx_get_u32(const uint8_t* b) {
+    return (uint32_t)b[0] | ((uint32_t)b[1] << 8) |
+           ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+void idx_header_put(uint8_t hdr[IDX_HDR_SZ], uint16_t verse_count, uint32_t src_size);
+// False unless the magic and version match this build
+bool idx_header_get(const uint8_t hdr[IDX_HDR_SZ], uint16_t* verse_count, uint32_t* src_size);
+
+void idx_entry_put(uint8_t e[IDX_ENTRY_SZ], uint32_t offset, const char* ref, uint8_t book);
+// ref gets REF_LEN bytes and is always terminated; ref and book may be NULL
+uint32_t idx_entry_get(const uint8_t e[IDX_ENTRY_SZ], char* ref, uint8_t* book);
+
+void idx_section_put(uint8_t sh[IDX_SEC_HDR_SZ], const char* tag, uint32_t len);
+
+// Sequential reader over an open .idx file. read fills len bytes or
+// fails; seek moves to an absolute offset.
+typedef struct {
+    void* ctx;
+    bool (*read)(void* ctx, void* buf, uint32_t len);
+    bool (*seek)(void* ctx, uint32_t offset);
+} IdxReader;
+
+// Where each known section's entries start. An offset of 0 means the
+// section is missing.
+typedef struct {
+    uint32_t phon_off;
+    uint16_t phon_count;
+    uint8_t  phon_algo;
+    uint32_t lsh_off;
+    uint16_t lsh_count;
+    uint8_t  lsh_bands;
+    uint32_t mark_off;
+    uint16_t mark_count;
+} IdxSections;
+
+// Walk the sections from offset at (the end of the verse entries), where
+// the reader must already be. Stops quietly at the end of the file or on
+// a short section.
+void idx_sections_read(const IdxReader* rd, uint32_t at, IdxSections* out);
+
+#ifdef __cplusplus
+}
+#endif
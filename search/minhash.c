@@ -0,0 +1,47 @@
+// minhash.c — MinHash / LSH signatures for "similar verses"
+
+#include "minhash.h"
+#include "search.h"
+
+// Murmur3 finalizer: cheap, well-mixed 32-bit hash of a 32-bit value
+static inline uint32_t mix32(uint32_t h) {
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35U;
+    h ^= h >> 16;
+    return h;
+}
+
+// Hash function i is mix32(shingle ^ seed_i)
+static void minhash_add(uint32_t mins[MINHASH_K], uint32_t shingle) {
+    for(uint8_t i = 0; i < MINHASH_K; i++) {
+        uint32_t v = mix32(shingle ^ (0x9E3779B9U * (uint32_t)(i + 1)));
+        if(v < mins[i]) mins[i] = v;
+    }
+}
+
+bool minhash_bands(const char* text, size_t n, uint16_t bands[MINHASH_BANDS]) {
+    uint32_t mins[MINHASH_K];
+    for(uint8_t i = 0; i < MINHASH_K; i++) mins[i] = 0xFFFFFFFFU;
+
+    size_t pos = 0, st, len;
+    uint32_t prev = 0;
+    uint16_t words = 0;
+    while(search_next_word(text, n, &pos, &st, &len)) {
+        uint32_t w = search_word_hash(text + st, len);
+        if(words) minhash_add(mins, mix32(prev * 0x01000193U ^ w));
+        prev = w;
+        words++;
+    }
+    if(!words) return false;
+    if(words == 1) minhash_add(mins, prev);
+
+    for(uint8_t b = 0; b < MINHASH_BANDS; b++) {
+        uint32_t h = (uint32_t)b;
+        for(uint8_t r = 0; r < MINHASH_ROWS; r++)
+            h = mix32(h * 0x01000193U ^ mins[b * MINHASH_ROWS + r]);
+        bands[b] = (uint16_t)(h ^ (h >> 16));
+    }
+    return true;
+}
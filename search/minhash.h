@@ -0,0 +1,26 @@
+// minhash.h — MinHash / LSH signatures for "similar verses"
+// Pure C (no Furi dependencies) so it can be shared with host tools.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 16 hash functions split into 8 bands of 2 rows. Two verses share a
+// band bucket with probability J^2 (J = Jaccard similarity of their word
+// pairs), so a verse is a candidate from about J = 0.35 upward.
+#define MINHASH_BANDS  8
+#define MINHASH_ROWS   2
+#define MINHASH_K      (MINHASH_BANDS * MINHASH_ROWS)
+
+// Compute the LSH bucket of each band for one verse text.
+// Shingles are case-folded word pairs; a one-word text uses the word.
+// Returns false if the text has no words.
+bool minhash_bands(const char* text, size_t n, uint16_t bands[MINHASH_BANDS]);
+
+#ifdef __cplusplus
+}
+#endif
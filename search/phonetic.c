@@ -0,0 +1,208 @@
+// phonetic.c — Sound-alike keys for proper-name search
+//
+// Metaphone keys are up to 6 symbols packed 5 bits each; Cologne keys are
+// up to 8 digits packed 4 bits each. The first symbol lands in the highest
+// bits, so a sorted key table groups names by their leading sounds.
+
+#include "phonetic.h"
+#include <string.h>
+
+#define PH_MAX_LETTERS 24
+
+// Fold a UTF-8 word to uppercase ASCII letters. Umlauts become their base
+// vowel and ß becomes S; everything else that is not a letter is dropped.
+static size_t fold_word(const char* w, size_t n, char* out, size_t out_sz) {
+    size_t o = 0;
+    for(size_t i = 0; i < n && o < out_sz - 1; i++) {
+        uint8_t c = (uint8_t)w[i];
+        if(c >= 'a' && c <= 'z') { out[o++] = (char)(c - 32); continue; }
+        if(c >= 'A' && c <= 'Z') { out[o++] = (char)c; continue; }
+        if(c == 0xC3 && i + 1 < n) {
+            uint8_t d = (uint8_t)w[++i] | 0x20;   // fold Latin-1 capitals
+            char base = 0;
+            if(d >= 0xA0 && d <= 0xA5) base = 'A';
+            else if(d == 0xA7)               base = 'C';
+            else if(d >= 0xA8 && d <= 0xAB) base = 'E';
+            else if(d >= 0xAC && d <= 0xAF) base = 'I';
+            else if(d == 0xB1)               base = 'N';
+            else if(d >= 0xB2 && d <= 0xB6) base = 'O';
+            else if(d >= 0xB9 && d <= 0xBC) base = 'U';
+            else if(w[i] == (char)0x9F)      base = 'S';   // ß
+            if(base) out[o++] = base;
+        }
+    }
+    out[o] = '\0';
+    return o;
+}
+
+static inline bool is_vowel(char c) {
+    return c == 'A' || c == 'E' || c == 'I' || c == 'O' || c == 'U';
+}
+
+static inline char at(const char* s, size_t n, long i) {
+    return (i >= 0 && (size_t)i < n) ? s[i] : '\0';
+}
+
+// ---- Metaphone ----------------------------------------------------------
+
+#define MP_MAX_LEN 6
+static const char MP_SYMBOLS[] = "AEIOUBFHJKLMNPRSTWXY0";
+
+static uint32_t mp_pack(const char* code, size_t n) {
+    uint32_t key = 0;
+    for(size_t i = 0; i < MP_MAX_LEN; i++) {
+        uint32_t sym = 0;
+        if(i < n) {
+            const char* p = strchr(MP_SYMBOLS, code[i]);
+            sym = p ? (uint32_t)(p - MP_SYMBOLS) + 1 : 0;
+        }
+        key = (key << 5) | sym;
+    }
+    return key;
+}
+
+// Classic Metaphone. With alt set, CH and TH take the hard readings
+// (K, T) that Double Metaphone offers as alternates — this is what makes
+// "melkisedek" find "Melchizedek".
+static uint32_t metaphone(const char* s, size_t n, bool alt) {
+    char code[MP_MAX_LEN + 2];
+    size_t o = 0;
+    long i = 0;
+
+    // Initial-letter exceptions
+    char c0 = at(s, n, 0), c1 = at(s, n, 1);
+    if((c0 == 'A' && c1 == 'E') || (c0 == 'G' && c1 == 'N') ||
+       (c0 == 'K' && c1 == 'N') || (c0 == 'P' && c1 == 'N') ||
+       (c0 == 'W' && c1 == 'R'))
+        i = 1;
+    else if(c0 == 'X') { code[o++] = 'S'; i = 1; }
+    else if(c0 == 'W' && c1 == 'H') { code[o++] = 'W'; i = 2; }
+
+    for(; (size_t)i < n && o < MP_MAX_LEN; i++) {
+        char c = s[i], prev = at(s, n, i - 1), next = at(s, n, i + 1);
+        char next2 = at(s, n, i + 2);
+        if(c == prev && c != 'C') continue;
+        switch(c) {
+        case 'A': case 'E': case 'I': case 'O': case 'U':
+            if(i == 0) code[o++] = c;
+            break;
+        case 'B':
+            if(!(prev == 'M' && (size_t)i == n - 1)) code[o++] = 'B';
+            break;
+        case 'C':
+            if(next == 'I' && next2 == 'A') code[o++] = 'X';
+            else if(next == 'H') {
+                code[o++] = (prev == 'S' || alt) ? 'K' : 'X';
+                i++;
+            } else if(next == 'I' || next == 'E' || next == 'Y') {
+                if(prev != 'S') code[o++] = 'S';
+            } else code[o++] = 'K';
+            break;
+        case 'D':
+            if(next == 'G' && (next2 == 'E' || next2 == 'I' || next2 == 'Y')) {
+                code[o++] = 'J'; i++;
+            } else code[o++] = 'T';
+            break;
+        case 'G':
+            if(next == 'H' && next2 && !is_vowel(next2)) break;
+            if(next == 'N' && ((size_t)i + 2 == n)) break;
+            if(next == 'I' || next == 'E' || next == 'Y') code[o++] = 'J';
+            else code[o++] = 'K';
+            break;
+        case 'H':
+            if(prev && strchr("CSPTG", prev)) break;
+            if(is_vowel(next)) code[o++] = 'H';
+            break;
+        case 'K':
+            if(prev != 'C') code[o++] = 'K';
+            break;
+        case 'P':
+            if(next == 'H') { code[o++] = 'F'; i++; }
+            else code[o++] = 'P';
+            break;
+        case 'Q': code[o++] = 'K'; break;
+        case 'S':
+            if(next == 'H') { code[o++] = 'X'; i++; }
+            else if(next == 'I' && (next2 == 'O' || next2 == 'A')) code[o++] = 'X';
+            else code[o++] = 'S';
+            break;
+        case 'T':
+            if(next == 'I' && (next2 == 'O' || next2 == 'A')) code[o++] = 'X';
+            else if(next == 'H') { code[o++] = alt ? 'T' : '0'; i++; }
+            else if(!(next == 'C' && next2 == 'H')) code[o++] = 'T';
+            break;
+        case 'V': code[o++] = 'F'; break;
+        case 'W': case 'Y':
+            if(is_vowel(next)) code[o++] = c;
+            break;
+        case 'X':
+            code[o++] = 'K';
+            if(o < MP_MAX_LEN) code[o++] = 'S';
+            break;
+        case 'Z': code[o++] = 'S'; break;
+        default:  code[o++] = c; break;   // F J L M N R
+        }
+    }
+    return o ? mp_pack(code, o) : 0;
+}
+
+// ---- Kölner Phonetik -----------------------------------------------------
+
+#define KP_MAX_LEN 8
+
+static uint32_t cologne(const char* s, size_t n) {
+    uint32_t key = 0;
+    uint8_t  len = 0;
+    char     last = -1;
+    for(size_t i = 0; i < n; i++) {
+        char c = s[i], prev = at(s, n, (long)i - 1), next = at(s, n, (long)i + 1);
+        const char* code;
+        switch(c) {
+        case 'A': case 'E': case 'I': case 'J': case 'O': case 'U': case 'Y':
+            code = "0"; break;
+        case 'H': continue;
+        case 'B': code = "1"; break;
+        case 'P': code = (next == 'H') ? "3" : "1"; break;
+        case 'D': case 'T': code = (next && strchr("CSZ", next)) ? "8" : "2"; break;
+        case 'F': case 'V': case 'W': code = "3"; break;
+        case 'G': case 'K': case 'Q': code = "4"; break;
+        case 'C':
+            if(i == 0)
+                code = (next && strchr("AHKLOQRUX", next)) ? "4" : "8";
+            else
+                code = (next && strchr("AHKOQUX", next) && !(prev && strchr("SZ", prev))) ?
+                       "4" : "8";
+            break;
+        case 'X': code = (prev && strchr("CKQ", prev)) ? "8" : "48"; break;
+        case 'L': code = "5"; break;
+        case 'M': case 'N': code = "6"; break;
+        case 'R': code = "7"; break;
+        case 'S': case 'Z': code = "8"; break;
+        default: continue;
+        }
+        for(const char* d = code; *d; d++) {
+            if(*d == last) continue;
+            last = *d;
+            if(*d == '0' && len > 0) continue;   // vowels only count up front
+            if(len < KP_MAX_LEN) {
+                key |= (uint32_t)(*d - '0' + 1) << (28 - 4 * len);
+                len++;
+            }
+        }
+    }
+    return key;
+}
+
+uint8_t phonetic_keys(const char* word, size_t len, PhoneticAlgo algo, uint32_t keys[2]) {
+    char up[PH_MAX_LETTERS + 1];
+    size_t n = fold_word(word, len, up, sizeof(up));
+    if(!n) return 0;
+    if(algo == PhoneticCologne) {
+        keys[0] = cologne(up, n);
+        return keys[0] ? 1 : 0;
+    }
+    keys[0] = metaphone(up, n, false);
+    keys[1] = metaphone(up, n, true);
+    if(!keys[0]) return 0;
+    return (keys[1] && keys[1] != keys[0]) ? 2 : 1;
+}
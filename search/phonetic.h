@@ -0,0 +1,24 @@
+// phonetic.h — Sound-alike keys for proper-name search
+// Pure C (no Furi dependencies) so it can be shared with host tools.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    PhoneticMetaphone = 0,   // English files: Metaphone with a Double-Metaphone style alternate
+    PhoneticCologne   = 1,   // German files: Kölner Phonetik
+} PhoneticAlgo;
+
+// Compute up to two packed keys for one word (UTF-8, any case).
+// Keys sort by their leading sounds; 0 means "no key".
+// Returns the number of distinct keys written to keys[].
+uint8_t phonetic_keys(const char* word, size_t len, PhoneticAlgo algo, uint32_t keys[2]);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,138 @@
+// search.c — Verse text matching engine for Bible Verse Viewer
+
+#include "search.h"
+#include <string.h>
+
+// Case-fold the byte at s[i]. ASCII letters fold directly; Latin-1
+// capitals (UTF-8 C3 80..9E, except the multiplication sign) fold to
+// their lowercase forms, which are the same length, so byte-wise
+// comparison stays valid for Luther umlauts.
+static inline char fold_at(const char* s, size_t i) {
+    char c = s[i];
+    if(c >= 'A' && c <= 'Z') return (char)(c + 32);
+    uint8_t u = (uint8_t)c;
+    if(i > 0 && (uint8_t)s[i - 1] == 0xC3 && u >= 0x80 && u <= 0x9E && u != 0x97)
+        return (char)(u + 0x20);
+    return c;
+}
+
+// Decode the code point starting at s[i]; stores its byte length in *len
+static uint32_t utf8_decode(const char* s, size_t i, size_t n, uint8_t* len) {
+    uint8_t c = (uint8_t)s[i];
+    if(c < 0x80 || i + 1 >= n) { *len = 1; return c; }
+    if((c & 0xE0) == 0xC0) {
+        *len = 2;
+        return ((uint32_t)(c & 0x1F) << 6) | ((uint8_t)s[i + 1] & 0x3F);
+    }
+    if((c & 0xF0) == 0xE0 && i + 2 < n) {
+        *len = 3;
+        return ((uint32_t)(c & 0x0F) << 12) |
+               ((uint32_t)((uint8_t)s[i + 1] & 0x3F) << 6) |
+               ((uint8_t)s[i + 2] & 0x3F);
+    }
+    *len = 1;
+    return c;
+}
+
+// Letters and digits count as word characters, including the Latin-1
+// and Latin Extended-A/B letters used by the German and other files.
+// Typographic quotes and dashes (U+2013..U+201E) are separators.
+static bool is_word_cp(uint32_t cp) {
+    if(cp < 0x80)
+        return (cp >= 'a' && cp <= 'z') || (cp >= 'A' && cp <= 'Z') ||
+               (cp >= '0' && cp <= '9');
+    if(cp == 0xAA || cp == 0xB5 || cp == 0xBA) return true;
+    if(cp >= 0xC0 && cp <= 0x24F) return cp != 0xD7 && cp != 0xF7;
+    return false;
+}
+
+// Is there a word character ending just before s[i]?
+static bool word_before(const char* s, size_t i, size_t n) {
+    if(i == 0) return false;
+    size_t st = i - 1;
+    while(st > 0 && ((uint8_t)s[st] & 0xC0) == 0x80) st--;
+    uint8_t len;
+    return is_word_cp(utf8_decode(s, st, n, &len));
+}
+
+// Is there a word character starting at s[i]?
+static bool word_at(const char* s, size_t i, size_t n) {
+    if(i >= n) return false;
+    uint8_t len;
+    return is_word_cp(utf8_decode(s, i, n, &len));
+}
+
+// Case-insensitive find from `from`; returns match index or -1.
+// In whole-word mode the match must sit on word boundaries.
+static long find(const char* hay, size_t hlen, size_t from,
+                 const char* needle, size_t nlen, SearchMode mode) {
+    if(!nlen || nlen > hlen) return -1;
+    for(size_t i = from; i <= hlen - nlen; i++) {
+        size_t j = 0;
+        while(j < nlen && fold_at(hay, i + j) == fold_at(needle, j)) j++;
+        if(j != nlen) continue;
+        if(mode == SearchModeWholeWord &&
+           (word_before(hay, i, hlen) || word_at(hay, i + nlen, hlen)))
+            continue;
+        return (long)i;
+    }
+    return -1;
+}
+
+const char* search_text_field(const char* line) {
+    const char* p1 = strchr(line, '|');
+    if(!p1) return NULL;
+    const char* p2 = strchr(p1 + 1, '|');
+    return p2 ? p2 + 1 : NULL;
+}
+
+bool search_line(const char* line, const char* query, SearchMode mode,
+                 MatchSpan* spans, uint8_t max_spans, uint8_t* span_count) {
+    if(span_count) *span_count = 0;
+    if(!line || !query || !query[0]) return false;
+    size_t nlen = strlen(query), hlen = strlen(line);
+    if(find(line, hlen, 0, query, nlen, mode) < 0) return false;
+
+    const char* text = search_text_field(line);
+    if(!text || !spans || !span_count) return true;
+
+    size_t toff = (size_t)(text - line);
+    size_t pos  = toff;
+    while(*span_count < max_spans) {
+        long m = find(line, hlen, pos, query, nlen, mode);
+        if(m < 0) break;
+        spans[*span_count].off = (uint16_t)((size_t)m - toff);
+        spans[*span_count].len = (uint8_t)nlen;
+        (*span_count)++;
+        pos = (size_t)m + nlen;
+    }
+    return true;
+}
+
+bool search_next_word(const char* s, size_t n, size_t* pos, size_t* start, size_t* len) {
+    size_t i = *pos;
+    uint8_t cl;
+    while(i < n && !is_word_cp(utf8_decode(s, i, n, &cl))) i += cl;
+    if(i >= n) { *pos = n; return false; }
+    *start = i;
+    while(i < n && is_word_cp(utf8_decode(s, i, n, &cl))) i += cl;
+    *len = i - *start;
+    *pos = i;
+    return true;
+}
+
+uint32_t search_word_hash(const char* word, size_t len) {
+    uint32_t h = 0x811C9DC5U;
+    for(size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)fold_at(word, i);
+        h *= 0x01000193U;
+    }
+    return h;
+}
+
+bool search_word_capitalized(const char* word) {
+    uint8_t c = (uint8_t)word[0];
+    if(c >= 'A' && c <= 'Z') return true;
+    uint8_t d = (uint8_t)word[1];
+    return c == 0xC3 && d >= 0x80 && d <= 0x9E && d != 0x97;
+}
@@ -0,0 +1,55 @@
+// search.h — Verse text matching engine for Bible Verse Viewer
+// Pure C (no Furi dependencies) so it can be shared with host tools.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Query size, hits kept per search (the rest are only counted) and
+// highlight spans recorded per hit
+#define MAX_SEARCH_LEN     64
+#define MAX_SEARCH_RESULTS 50
+#define MAX_HIT_SPANS       4
+
+typedef enum {
+    SearchModeSubstring = 0,   // any occurrence, e.g. "art" hits "heart"
+    SearchModeWholeWord = 1,   // occurrence bounded by non-word characters
+    SearchModePhonetic  = 2,   // sound-alike lookup of capitalized names
+    SearchModeCount,
+} SearchMode;
+
+// A match inside the verse text field (byte offsets, not characters)
+typedef struct {
+    uint16_t off;
+    uint8_t  len;
+} MatchSpan;
+
+// Returns a pointer to the text field of a "Reference|Book|Text" line,
+// or NULL if the line is malformed.
+const char* search_text_field(const char* line);
+
+// Case-insensitive match over a whole verse line (ASCII and Latin-1 folding).
+// Returns true if the query occurs anywhere in the line; occurrences inside
+// the text field are recorded in spans (offsets relative to the text field).
+// Word boundaries are Unicode-aware: umlauts and accented letters are word
+// characters, typographic quotes and dashes are not.
+bool search_line(const char* line, const char* query, SearchMode mode,
+                 MatchSpan* spans, uint8_t max_spans, uint8_t* span_count);
+
+// Advance *pos to the next word in s[0..n) using the same Unicode-aware
+// word characters as whole-word matching. Returns false at end of text.
+bool search_next_word(const char* s, size_t n, size_t* pos, size_t* start, size_t* len);
+
+// FNV-1a hash of a word after case folding, so "Lord" and "LORD" agree
+uint32_t search_word_hash(const char* word, size_t len);
+
+// True if the word starts with an uppercase ASCII or Latin-1 letter
+bool search_word_capitalized(const char* word);
+
+#ifdef __cplusplus
+}
+#endif
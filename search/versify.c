@@ -0,0 +1,317 @@
+// versify.c — Versification maps between translations
+//
+// Each scheme is a table of ranges sorted by both its own and the
+// canonical reference: src..src+len-1 in the scheme is dst..dst+len-1
+// canonically, within one chapter of one book. lead counts title verses
+// just before src that have no canonical counterpart. A range may run
+// past the end of its chapter (len up to the verse field's limit), so a
+// whole renumbered chapter needs no verse counts.
+//
+// The tables cover the differences that move whole chapters or every
+// verse of a psalm; single verses moved across a chapter boundary are
+// not mapped.
+
+#include "versify.h"
+#include <string.h>
+
+#define V(c, v) (uint16_t)(((c) << 8) | (v))
+#define PS 18   // Psalms
+#define JL 28   // Joel
+#define ML 38   // Malachi
+
+typedef struct {
+    uint8_t  book;   // BIBLE_BOOKS index
+    uint8_t  lead;   // title verses before src
+    uint16_t src;    // chapter << 8 | verse in the scheme
+    uint16_t dst;    // same, canonical
+    uint8_t  len;
+} VersifyRange;
+
+static const VersifyRange HEBREW[] = {
+    { PS, 1, V(  3,  2), V(  3,  1), 253 },
+    { PS, 1, V(  4,  2), V(  4,  1), 253 },
+    { PS, 1, V(  5,  2), V(  5,  1), 253 },
+    { PS, 1, V(  6,  2), V(  6,  1), 253 },
+    { PS, 1, V(  7,  2), V(  7,  1), 253 },
+    { PS, 1, V(  8,  2), V(  8,  1), 253 },
+    { PS, 1, V(  9,  2), V(  9,  1), 253 },
+    { PS, 1, V( 12,  2), V( 12,  1), 253 },
+    { PS, 1, V( 13,  2), V( 13,  1), 253 },
+    { PS, 1, V( 18,  2), V( 18,  1), 253 },
+    { PS, 1, V( 19,  2), V( 19,  1), 253 },
+    { PS, 1, V( 20,  2), V( 20,  1), 253 },
+    { PS, 1, V( 21,  2), V( 21,  1), 253 },
+    { PS, 1, V( 22,  2), V( 22,  1), 253 },
+    { PS, 1, V( 30,  2), V( 30,  1), 253 },
+    { PS, 1, V( 31,  2), V( 31,  1), 253 },
+    { PS, 1, V( 34,  2), V( 34,  1), 253 },
+    { PS, 1, V( 36,  2), V( 36,  1), 253 },
+    { PS, 1, V( 38,  2), V( 38,  1), 253 },
+    { PS, 1, V( 39,  2), V( 39,  1), 253 },
+    { PS, 1, V( 40,  2), V( 40,  1), 253 },
+    { PS, 1, V( 41,  2), V( 41,  1), 253 },
+    { PS, 1, V( 42,  2), V( 42,  1), 253 },
+    { PS, 1, V( 44,  2), V( 44,  1), 253 },
+    { PS, 1, V( 45,  2), V( 45,  1), 253 },
+    { PS, 1, V( 46,  2), V( 46,  1), 253 },
+    { PS, 1, V( 47,  2), V( 47,  1), 253 },
+    { PS, 1, V( 48,  2), V( 48,  1), 253 },
+    { PS, 1, V( 49,  2), V( 49,  1), 253 },
+    { PS, 2, V( 51,  3), V( 51,  1), 252 },
+    { PS, 2, V( 52,  3), V( 52,  1), 252 },
+    { PS, 1, V( 53,  2), V( 53,  1), 253 },
+    { PS, 2, V( 54,  3), V( 54,  1), 252 },
+    { PS, 1, V( 55,  2), V( 55,  1), 253 },
+    { PS, 1, V( 56,  2), V( 56,  1), 253 },
+    { PS, 1, V( 57,  2), V( 57,  1), 253 },
+    { PS, 1, V( 58,  2), V( 58,  1), 253 },
+    { PS, 1, V( 59,  2), V( 59,  1), 253 },
+    { PS, 2, V( 60,  3), V( 60,  1), 252 },
+    { PS, 1, V( 61,  2), V( 61,  1), 253 },
+    { PS, 1, V( 62,  2), V( 62,  1), 253 },
+    { PS, 1, V( 63,  2), V( 63,  1), 253 },
+    { PS, 1, V( 64,  2), V( 64,  1), 253 },
+    { PS, 1, V( 65,  2), V( 65,  1), 253 },
+    { PS, 1, V( 67,  2), V( 67,  1), 253 },
+    { PS, 1, V( 68,  2), V( 68,  1), 253 },
+    { PS, 1, V( 69,  2), V( 69,  1), 253 },
+    { PS, 1, V( 70,  2), V( 70,  1), 253 },
+    { PS, 1, V( 75,  2), V( 75,  1), 253 },
+    { PS, 1, V( 76,  2), V( 76,  1), 253 },
+    { PS, 1, V( 77,  2), V( 77,  1), 253 },
+    { PS, 1, V( 80,  2), V( 80,  1), 253 },
+    { PS, 1, V( 81,  2), V( 81,  1), 253 },
+    { PS, 1, V( 83,  2), V( 83,  1), 253 },
+    { PS, 1, V( 84,  2), V( 84,  1), 253 },
+    { PS, 1, V( 85,  2), V( 85,  1), 253 },
+    { PS, 1, V( 88,  2), V( 88,  1), 253 },
+    { PS, 1, V( 89,  2), V( 89,  1), 253 },
+    { PS, 1, V( 92,  2), V( 92,  1), 253 },
+    { PS, 1, V(102,  2), V(102,  1), 253 },
+    { PS, 1, V(108,  2), V(108,  1), 253 },
+    { PS, 1, V(140,  2), V(140,  1), 253 },
+    { PS, 1, V(142,  2), V(142,  1), 253 },
+    { JL, 0, V(  3,  1), V(  2, 28),   5 },
+    { JL, 0, V(  4,  1), V(  3,  1), 254 },
+    { ML, 0, V(  3, 19), V(  4,  1),   6 },
+};
+
+// Psalms 9-10 and 114-115 are one psalm each, 116 and 147 two, so most
+// psalms are one behind the Hebrew number; titles count as in HEBREW
+static const VersifyRange VULGATE[] = {
+    { PS, 1, V(  3,  2), V(  3,  1), 253 },
+    { PS, 1, V(  4,  2), V(  4,  1), 253 },
+    { PS, 1, V(  5,  2), V(  5,  1), 253 },
+    { PS, 1, V(  6,  2), V(  6,  1), 253 },
+    { PS, 1, V(  7,  2), V(  7,  1), 253 },
+    { PS, 1, V(  8,  2), V(  8,  1), 253 },
+    { PS, 1, V(  9,  2), V(  9,  1),  20 },
+    { PS, 0, V(  9, 22), V( 10,  1),  18 },
+    { PS, 0, V( 10,  1), V( 11,  1), 254 },
+    { PS, 1, V( 11,  2), V( 12,  1), 253 },
+    { PS, 1, V( 12,  2), V( 13,  1), 253 },
+    { PS, 0, V( 13,  1), V( 14,  1), 254 },
+    { PS, 0, V( 14,  1), V( 15,  1), 254 },
+    { PS, 0, V( 15,  1), V( 16,  1), 254 },
+    { PS, 0, V( 16,  1), V( 17,  1), 254 },
+    { PS, 1, V( 17,  2), V( 18,  1), 253 },
+    { PS, 1, V( 18,  2), V( 19,  1), 253 },
+    { PS, 1, V( 19,  2), V( 20,  1), 253 },
+    { PS, 1, V( 20,  2), V( 21,  1), 253 },
+    { PS, 1, V( 21,  2), V( 22,  1), 253 },
+    { PS, 0, V( 22,  1), V( 23,  1), 254 },
+    { PS, 0, V( 23,  1), V( 24,  1), 254 },
+    { PS, 0, V( 24,  1), V( 25,  1), 254 },
+    { PS, 0, V( 25,  1), V( 26,  1), 254 },
+    { PS, 0, V( 26,  1), V( 27,  1), 254 },
+    { PS, 0, V( 27,  1), V( 28,  1), 254 },
+    { PS, 0, V( 28,  1), V( 29,  1), 254 },
+    { PS, 1, V( 29,  2), V( 30,  1), 253 },
+    { PS, 1, V( 30,  2), V( 31,  1), 253 },
+    { PS, 0, V( 31,  1), V( 32,  1), 254 },
+    { PS, 0, V( 32,  1), V( 33,  1), 254 },
+    { PS, 1, V( 33,  2), V( 34,  1), 253 },
+    { PS, 0, V( 34,  1), V( 35,  1), 254 },
+    { PS, 1, V( 35,  2), V( 36,  1), 253 },
+    { PS, 0, V( 36,  1), V( 37,  1), 254 },
+    { PS, 1, V( 37,  2), V( 38,  1), 253 },
+    { PS, 1, V( 38,  2), V( 39,  1), 253 },
+    { PS, 1, V( 39,  2), V( 40,  1), 253 },
+    { PS, 1, V( 40,  2), V( 41,  1), 253 },
+    { PS, 1, V( 41,  2), V( 42,  1), 253 },
+    { PS, 0, V( 42,  1), V( 43,  1), 254 },
+    { PS, 1, V( 43,  2), V( 44,  1), 253 },
+    { PS, 1, V( 44,  2), V( 45,  1), 253 },
+    { PS, 1, V( 45,  2), V( 46,  1), 253 },
+    { PS, 1, V( 46,  2), V( 47,  1), 253 },
+    { PS, 1, V( 47,  2), V( 48,  1), 253 },
+    { PS, 1, V( 48,  2), V( 49,  1), 253 },
+    { PS, 0, V( 49,  1), V( 50,  1), 254 },
+    { PS, 2, V( 50,  3), V( 51,  1), 252 },
+    { PS, 2, V( 51,  3), V( 52,  1), 252 },
+    { PS, 1, V( 52,  2), V( 53,  1), 253 },
+    { PS, 2, V( 53,  3), V( 54,  1), 252 },
+    { PS, 1, V( 54,  2), V( 55,  1), 253 },
+    { PS, 1, V( 55,  2), V( 56,  1), 253 },
+    { PS, 1, V( 56,  2), V( 57,  1), 253 },
+    { PS, 1, V( 57,  2), V( 58,  1), 253 },
+    { PS, 1, V( 58,  2), V( 59,  1), 253 },
+    { PS, 2, V( 59,  3), V( 60,  1), 252 },
+    { PS, 1, V( 60,  2), V( 61,  1), 253 },
+    { PS, 1, V( 61,  2), V( 62,  1), 253 },
+    { PS, 1, V( 62,  2), V( 63,  1), 253 },
+    { PS, 1, V( 63,  2), V( 64,  1), 253 },
+    { PS, 1, V( 64,  2), V( 65,  1), 253 },
+    { PS, 0, V( 65,  1), V( 66,  1), 254 },
+    { PS, 1, V( 66,  2), V( 67,  1), 253 },
+    { PS, 1, V( 67,  2), V( 68,  1), 253 },
+    { PS, 1, V( 68,  2), V( 69,  1), 253 },
+    { PS, 1, V( 69,  2), V( 70,  1), 253 },
+    { PS, 0, V( 70,  1), V( 71,  1), 254 },
+    { PS, 0, V( 71,  1), V( 72,  1), 254 },
+    { PS, 0, V( 72,  1), V( 73,  1), 254 },
+    { PS, 0, V( 73,  1), V( 74,  1), 254 },
+    { PS, 1, V( 74,  2), V( 75,  1), 253 },
+    { PS, 1, V( 75,  2), V( 76,  1), 253 },
+    { PS, 1, V( 76,  2), V( 77,  1), 253 },
+    { PS, 0, V( 77,  1), V( 78,  1), 254 },
+    { PS, 0, V( 78,  1), V( 79,  1), 254 },
+    { PS, 1, V( 79,  2), V( 80,  1), 253 },
+    { PS, 1, V( 80,  2), V( 81,  1), 253 },
+    { PS, 0, V( 81,  1), V( 82,  1), 254 },
+    { PS, 1, V( 82,  2), V( 83,  1), 253 },
+    { PS, 1, V( 83,  2), V( 84,  1), 253 },
+    { PS, 1, V( 84,  2), V( 85,  1), 253 },
+    { PS, 0, V( 85,  1), V( 86,  1), 254 },
+    { PS, 0, V( 86,  1), V( 87,  1), 254 },
+    { PS, 1, V( 87,  2), V( 88,  1), 253 },
+    { PS, 1, V( 88,  2), V( 89,  1), 253 },
+    { PS, 0, V( 89,  1), V( 90,  1), 254 },
+    { PS, 0, V( 90,  1), V( 91,  1), 254 },
+    { PS, 1, V( 91,  2), V( 92,  1), 253 },
+    { PS, 0, V( 92,  1), V( 93,  1), 254 },
+    { PS, 0, V( 93,  1), V( 94,  1), 254 },
+    { PS, 0, V( 94,  1), V( 95,  1), 254 },
+    { PS, 0, V( 95,  1), V( 96,  1), 254 },
+    { PS, 0, V( 96,  1), V( 97,  1), 254 },
+    { PS, 0, V( 97,  1), V( 98,  1), 254 },
+    { PS, 0, V( 98,  1), V( 99,  1), 254 },
+    { PS, 0, V( 99,  1), V(100,  1), 254 },
+    { PS, 0, V(100,  1), V(101,  1), 254 },
+    { PS, 1, V(101,  2), V(102,  1), 253 },
+    { PS, 0, V(102,  1), V(103,  1), 254 },
+    { PS, 0, V(103,  1), V(104,  1), 254 },
+    { PS, 0, V(104,  1), V(105,  1), 254 },
+    { PS, 0, V(105,  1), V(106,  1), 254 },
+    { PS, 0, V(106,  1), V(107,  1), 254 },
+    { PS, 1, V(107,  2), V(108,  1), 253 },
+    { PS, 0, V(108,  1), V(109,  1), 254 },
+    { PS, 0, V(109,  1), V(110,  1), 254 },
+    { PS, 0, V(110,  1), V(111,  1), 254 },
+    { PS, 0, V(111,  1), V(112,  1), 254 },
+    { PS, 0, V(112,  1), V(113,  1), 254 },
+    { PS, 0, V(113,  1), V(114,  1),   8 },
+    { PS, 0, V(113,  9), V(115,  1),  18 },
+    { PS, 0, V(114,  1), V(116,  1),   9 },
+    { PS, 0, V(115,  1), V(116, 10),  10 },
+    { PS, 0, V(116,  1), V(117,  1), 254 },
+    { PS, 0, V(117,  1), V(118,  1), 254 },
+    { PS, 0, V(118,  1), V(119,  1), 254 },
+    { PS, 0, V(119,  1), V(120,  1), 254 },
+    { PS, 0, V(120,  1), V(121,  1), 254 },
+    { PS, 0, V(121,  1), V(122,  1), 254 },
+    { PS, 0, V(122,  1), V(123,  1), 254 },
+    { PS, 0, V(123,  1), V(124,  1), 254 },
+    { PS, 0, V(124,  1), V(125,  1), 254 },
+    { PS, 0, V(125,  1), V(126,  1), 254 },
+    { PS, 0, V(126,  1), V(127,  1), 254 },
+    { PS, 0, V(127,  1), V(128,  1), 254 },
+    { PS, 0, V(128,  1), V(129,  1), 254 },
+    { PS, 0, V(129,  1), V(130,  1), 254 },
+    { PS, 0, V(130,  1), V(131,  1), 254 },
+    { PS, 0, V(131,  1), V(132,  1), 254 },
+    { PS, 0, V(132,  1), V(133,  1), 254 },
+    { PS, 0, V(133,  1), V(134,  1), 254 },
+    { PS, 0, V(134,  1), V(135,  1), 254 },
+    { PS, 0, V(135,  1), V(136,  1), 254 },
+    { PS, 0, V(136,  1), V(137,  1), 254 },
+    { PS, 0, V(137,  1), V(138,  1), 254 },
+    { PS, 0, V(138,  1), V(139,  1), 254 },
+    { PS, 1, V(139,  2), V(140,  1), 253 },
+    { PS, 0, V(140,  1), V(141,  1), 254 },
+    { PS, 1, V(141,  2), V(142,  1), 253 },
+    { PS, 0, V(142,  1), V(143,  1), 254 },
+    { PS, 0, V(143,  1), V(144,  1), 254 },
+    { PS, 0, V(144,  1), V(145,  1), 254 },
+    { PS, 0, V(145,  1), V(146,  1), 254 },
+    { PS, 0, V(146,  1), V(147,  1),  11 },
+    { PS, 0, V(147,  1), V(147, 12),   9 },
+};
+
+typedef struct {
+    const char*         name;
+    const VersifyRange* ranges;
+    uint16_t            count;
+} VersifyMap;
+
+static const VersifyMap MAPS[VersifyCount] = {
+    [VersifyKjv]     = { "kjv",     NULL,    0 },
+    [VersifyHebrew]  = { "hebrew",  HEBREW,  sizeof(HEBREW)  / sizeof(VersifyRange) },
+    [VersifyVulgate] = { "vulgate", VULGATE, sizeof(VULGATE) / sizeof(VersifyRange) },
+};
+
+static inline uint32_t range_key(uint8_t book, uint16_t cv) {
+    return ((uint32_t)book << 16) | cv;
+}
+
+VersifyScheme versify_scheme(const char* name, size_t len) {
+    for(uint8_t s = 0; s < VersifyCount; s++)
+        if(strlen(MAPS[s].name) == len && strncmp(MAPS[s].name, name, len) == 0)
+            return (VersifyScheme)s;
+    return VersifyKjv;
+}
+
+const char* versify_name(VersifyScheme s) {
+    return s < VersifyCount ? MAPS[s].name : MAPS[VersifyKjv].name;
+}
+
+// Last range whose start is at or before key, on the scheme side
+// (to_canon) or the canonical side; -1 if none
+static int32_t range_floor(const VersifyMap* m, uint32_t key, bool to_canon) {
+    int32_t lo = 0, hi = (int32_t)m->count - 1, found = -1;
+    while(lo <= hi) {
+        int32_t mid = (lo + hi) / 2;
+        const VersifyRange* r = &m->ranges[mid];
+        uint32_t start = to_canon ? range_key(r->book, (uint16_t)(r->src - r->lead)) :
+                                    range_key(r->book, r->dst);
+        if(start <= key) { found = mid; lo = mid + 1; }
+        else hi = mid - 1;
+    }
+    return found;
+}
+
+uint32_t versify_to_canon(VersifyScheme s, uint32_t id) {
+    if(s >= VersifyCount || !id) return id;
+    const VersifyMap* m = &MAPS[s];
+    uint32_t key = id - 0x10000;   // ids count books from 1
+    int32_t i = range_floor(m, key, true);
+    if(i < 0) return id;
+    const VersifyRange* r = &m->ranges[i];
+    uint32_t src = range_key(r->book, r->src);
+    uint32_t dst = range_key(r->book, r->dst) + 0x10000;
+    if(key < src) return dst;                       // title
+    if(key - src < r->len) return dst + (key - src);
+    return id;
+}
+
+uint32_t versify_from_canon(VersifyScheme s, uint32_t id) {
+    if(s >= VersifyCount || !id) return id;
+    const VersifyMap* m = &MAPS[s];
+    uint32_t key = id - 0x10000;
+    int32_t i = range_floor(m, key, false);
+    if(i < 0) return id;
+    const VersifyRange* r = &m->ranges[i];
+    uint32_t dst = range_key(r->book, r->dst);
+    if(key - dst < r->len) return range_key(r->book, r->src) + 0x10000 + (key - dst);
+    return id;
+}
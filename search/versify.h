@@ -0,0 +1,37 @@
+// versify.h — Versification maps between translations
+// Pure C (no Furi dependencies) so it can be shared with host tools.
+//
+// Verse ids are (book + 1) << 16 | chapter << 8 | verse, book in
+// BIBLE_BOOKS order. The canonical numbering is the KJV one the app's
+// chapter and verse tables use; a scheme maps its own ids onto it.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    VersifyKjv = 0,   // English Protestant numbering (canonical)
+    VersifyHebrew,    // Masoretic: Psalm titles are verses, Joel 4, Malachi 3:19-24
+    VersifyVulgate,   // Latin/Greek Psalm numbering with titles (Douay-Rheims)
+    VersifyCount,
+} VersifyScheme;
+
+// Scheme named by a verse file's "#versification=" line; VersifyKjv for
+// an unknown name
+VersifyScheme versify_scheme(const char* name, size_t len);
+const char*   versify_name(VersifyScheme s);
+
+// A verse id in scheme s to the canonical id, and back. Both are binary
+// searches over the scheme's ranges; ids outside every range map to
+// themselves. A Psalm title, which has no canonical verse, maps to the
+// first verse of its psalm.
+uint32_t versify_to_canon(VersifyScheme s, uint32_t id);
+uint32_t versify_from_canon(VersifyScheme s, uint32_t id);
+
+#ifdef __cplusplus
+}
+#endif
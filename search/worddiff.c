@@ -0,0 +1,126 @@
+// worddiff.c — Word-level diff of two verse texts
+//
+// Myers' O(ND) algorithm in its linear-space form: find the middle snake
+// of the edit graph with a forward and a reverse search, keep it, and
+// recurse on the two halves. Common prefixes and suffixes are trimmed
+// first, which settles most verse pairs without a search at all.
+
+#include "worddiff.h"
+
+#define V_OFF (WORDDIFF_MAX_WORDS + 1)
+
+typedef struct {
+    int16_t x0, y0, x1, y1;
+} Snake;
+
+static uint8_t tokenize(WordDiff* d, uint8_t side, const char* s, size_t n) {
+    size_t pos = 0, start, len;
+    uint8_t count = 0;
+    while(count < WORDDIFF_MAX_WORDS && search_next_word(s, n, &pos, &start, &len)) {
+        d->tok[side][count].off  = (uint16_t)start;
+        d->tok[side][count].len  = (uint8_t)(len > 255 ? 255 : len);
+        d->hash[side][count]     = search_word_hash(s + start, len);
+        d->same[side][count]     = 0;
+        count++;
+    }
+    return count;
+}
+
+static bool middle_snake(WordDiff* d, int16_t a0, int16_t a1, int16_t b0, int16_t b1, Snake* s) {
+    const uint32_t* A = d->hash[0];
+    const uint32_t* B = d->hash[1];
+    int16_t* fv = d->fv + V_OFF;
+    int16_t* rv = d->rv + V_OFF;
+    int16_t n = (int16_t)(a1 - a0), m = (int16_t)(b1 - b0);
+    int16_t delta = (int16_t)(n - m);
+    bool odd = delta & 1;
+    int16_t max = (int16_t)((n + m + 1) / 2);
+
+    fv[1] = 0;
+    rv[1] = 0;
+    for(int16_t e = 0; e <= max; e++) {
+        // Forward: furthest x on each diagonal k = x - y after e edits
+        for(int16_t k = (int16_t)-e; k <= e; k += 2) {
+            int16_t x = (k == -e || (k != e && fv[k - 1] < fv[k + 1])) ?
+                fv[k + 1] : (int16_t)(fv[k - 1] + 1);
+            int16_t y = (int16_t)(x - k), x0 = x, y0 = y;
+            while(x < n && y < m && A[a0 + x] == B[b0 + y]) { x++; y++; }
+            fv[k] = x;
+            int16_t kr = (int16_t)(delta - k);
+            if(odd && kr >= -(e - 1) && kr <= e - 1 && fv[k] + rv[kr] >= n) {
+                s->x0 = (int16_t)(a0 + x0); s->y0 = (int16_t)(b0 + y0);
+                s->x1 = (int16_t)(a0 + x);  s->y1 = (int16_t)(b0 + y);
+                return true;
+            }
+        }
+        // Reverse: the same search from the far corner
+        for(int16_t k = (int16_t)-e; k <= e; k += 2) {
+            int16_t x = (k == -e || (k != e && rv[k - 1] < rv[k + 1])) ?
+                rv[k + 1] : (int16_t)(rv[k - 1] + 1);
+            int16_t y = (int16_t)(x - k), x0 = x, y0 = y;
+            while(x < n && y < m && A[a1 - 1 - x] == B[b1 - 1 - y]) { x++; y++; }
+            rv[k] = x;
+            int16_t kf = (int16_t)(delta - k);
+            if(!odd && kf >= -e && kf <= e && rv[k] + fv[kf] >= n) {
+                s->x0 = (int16_t)(a1 - x);  s->y0 = (int16_t)(b1 - y);
+                s->x1 = (int16_t)(a1 - x0); s->y1 = (int16_t)(b1 - y0);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Each level halves the edit count, so recursion depth is O(log D)
+static void diff_rec(WordDiff* d, int16_t a0, int16_t a1, int16_t b0, int16_t b1) {
+    const uint32_t* A = d->hash[0];
+    const uint32_t* B = d->hash[1];
+    while(a0 < a1 && b0 < b1 && A[a0] == B[b0]) {
+        d->same[0][a0++] = 1;
+        d->same[1][b0++] = 1;
+    }
+    while(a0 < a1 && b0 < b1 && A[a1 - 1] == B[b1 - 1]) {
+        d->same[0][--a1] = 1;
+        d->same[1][--b1] = 1;
+    }
+    if(a0 == a1 || b0 == b1) return;
+
+    Snake s;
+    if(!middle_snake(d, a0, a1, b0, b1, &s)) return;
+    diff_rec(d, a0, s.x0, b0, s.y0);
+    for(int16_t i = 0; i < s.x1 - s.x0; i++) {
+        d->same[0][s.x0 + i] = 1;
+        d->same[1][s.y0 + i] = 1;
+    }
+    diff_rec(d, s.x1, a1, s.y1, b1);
+}
+
+uint16_t worddiff_run(WordDiff* d, const char* a, size_t na, const char* b, size_t nb) {
+    d->n[0] = tokenize(d, 0, a, na);
+    d->n[1] = tokenize(d, 1, b, nb);
+    diff_rec(d, 0, d->n[0], 0, d->n[1]);
+
+    uint16_t changed = 0;
+    for(uint8_t side = 0; side < 2; side++)
+        for(uint8_t i = 0; i < d->n[side]; i++)
+            if(!d->same[side][i]) changed++;
+    return changed;
+}
+
+uint8_t worddiff_spans(const WordDiff* d, uint8_t side, MatchSpan* out, uint8_t cap) {
+    uint8_t count = 0;
+    bool open = false;
+    for(uint8_t i = 0; i < d->n[side]; i++) {
+        const MatchSpan* t = &d->tok[side][i];
+        if(d->same[side][i]) { open = false; continue; }
+        uint16_t end = (uint16_t)(t->off + t->len);
+        if(open && end - out[count - 1].off <= 255) {
+            out[count - 1].len = (uint8_t)(end - out[count - 1].off);
+            continue;
+        }
+        if(count >= cap) break;
+        out[count++] = *t;
+        open = true;
+    }
+    return count;
+}
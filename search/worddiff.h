@@ -0,0 +1,40 @@
+// worddiff.h — Word-level diff of two verse texts
+// Pure C (no Furi dependencies) so it can be shared with host tools.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "search.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Words per side; later words are left unmarked. The longest verse in
+// the shipped files has about 45.
+#define WORDDIFF_MAX_WORDS 96
+
+// All working memory for one diff (about 2.5 KB). Myers' linear-space
+// variant needs only the two diagonal arrays on top of the tokens, so
+// nothing is allocated while diffing.
+typedef struct {
+    MatchSpan tok[2][WORDDIFF_MAX_WORDS];
+    uint32_t  hash[2][WORDDIFF_MAX_WORDS];
+    uint8_t   same[2][WORDDIFF_MAX_WORDS];   // 1 = word is in the common subsequence
+    uint8_t   n[2];
+    int16_t   fv[2 * WORDDIFF_MAX_WORDS + 4];
+    int16_t   rv[2 * WORDDIFF_MAX_WORDS + 4];
+} WordDiff;
+
+// Split both texts into words (case-folded comparison, punctuation
+// ignored) and mark the longest common word subsequence. Returns the
+// number of words that differ across both sides.
+uint16_t worddiff_run(WordDiff* d, const char* a, size_t na, const char* b, size_t nb);
+
+// Spans of differing words on one side (0 = a, 1 = b). Adjacent changed
+// words merge into one span, including the gap between them.
+uint8_t worddiff_spans(const WordDiff* d, uint8_t side, MatchSpan* out, uint8_t cap);
+
+#ifdef __cplusplus
+}
+#endif
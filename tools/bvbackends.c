@@ -0,0 +1,230 @@
+// bvbackends.c — Host check for the verse API backends in api/
+//
+// Runs api/backends.c as the app does: the pick order, the latency
+// EWMA, the cool-down and its restart, and both providers' URLs and
+// response parsing. Ticks are milliseconds here. Exits nonzero if any
+// check fails.
+//
+// Build from the repository root:
+//   cc -O2 -Iapi -o bvbackends tools/bvbackends.c api/backends.c
+//
+// Usage:
+//   bvbackends
+
+#include "backends.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define COOL 60000u
+
+static unsigned checks, failures;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        checks++;                                                            \
+        if(!(cond)) {                                                        \
+            failures++;                                                      \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+        }                                                                    \
+    } while(0)
+
+#define BIBLEAPI 0
+#define MIRROR   1
+
+// ============================================================
+// Setup
+// ============================================================
+
+static void check_init(void) {
+    printf("init\n");
+    ApiBackends bs;
+    backends_init(&bs, NULL, COOL);
+    CHECK(bs.count == 1 && strcmp(bs.list[BIBLEAPI].name, "bible-api") == 0);
+    CHECK(bs.cool_ticks == COOL);
+
+    backends_init(&bs, "  \r\n", COOL);
+    CHECK(bs.count == 1);
+    backends_init(&bs, "///\n", COOL);
+    CHECK(bs.count == 1);
+
+    // First line only, trailing slashes and spaces dropped
+    backends_init(&bs, "http://10.0.0.2:8080/ /\r\nignored\n", COOL);
+    CHECK(bs.count == 2 && strcmp(bs.list[MIRROR].name, "mirror") == 0);
+    CHECK(strcmp(bs.list[MIRROR].base, "http://10.0.0.2:8080") == 0);
+
+    // A base that doesn't fit is left out rather than cut short
+    char longbase[API_BACKEND_BASE_LEN + 10];
+    memset(longbase, 'a', sizeof(longbase) - 1);
+    longbase[sizeof(longbase) - 1] = '\0';
+    backends_init(&bs, longbase, COOL);
+    CHECK(bs.count == 1);
+}
+
+// ============================================================
+// Pick order
+// ============================================================
+
+static void check_pick(void) {
+    printf("pick\n");
+    ApiBackends bs;
+    backends_init(&bs, "http://mirror", COOL);
+    uint32_t now = 1000;
+
+    // Unmeasured first: both are, so the first in the list
+    CHECK(backends_pick(&bs, 0, now) == BIBLEAPI);
+    CHECK(backends_pick(&bs, 1u << BIBLEAPI, now) == MIRROR);
+    CHECK(backends_pick(&bs, 3, now) == -1);
+
+    // A measured backend goes after one that isn't
+    backends_report(&bs, BIBLEAPI, true, 400, now);
+    CHECK(backends_pick(&bs, 0, now) == MIRROR);
+
+    // then the fastest
+    backends_report(&bs, MIRROR, true, 900, now);
+    CHECK(backends_pick(&bs, 0, now) == BIBLEAPI);
+    CHECK(backends_pick(&bs, 1u << BIBLEAPI, now) == MIRROR);
+
+    // A cooling-down backend goes last even when it is faster
+    backends_report(&bs, BIBLEAPI, false, 0, now);
+    CHECK(backends_pick(&bs, 0, now) == BIBLEAPI);   // one failure isn't enough
+    backends_report(&bs, BIBLEAPI, false, 0, now);
+    CHECK(backends_pick(&bs, 0, now) == MIRROR);
+    CHECK(backends_pick(&bs, 1u << MIRROR, now) == BIBLEAPI);
+
+    // and comes back once the cool-down is over
+    CHECK(backends_pick(&bs, 0, now + COOL - 1) == MIRROR);
+    CHECK(backends_pick(&bs, 0, now + COOL) == BIBLEAPI);
+}
+
+// ============================================================
+// Latency and cool-down
+// ============================================================
+
+static void check_ewma(void) {
+    printf("ewma\n");
+    ApiBackends bs;
+    backends_init(&bs, NULL, COOL);
+    ApiBackend* b = &bs.list[BIBLEAPI];
+
+    // The first answer seeds the average, later ones weigh 1/4
+    backends_report(&bs, BIBLEAPI, true, 800, 0);
+    CHECK(b->ewma == 800);
+    backends_report(&bs, BIBLEAPI, true, 400, 0);
+    CHECK(b->ewma == 700);
+    backends_report(&bs, BIBLEAPI, true, 700, 0);
+    CHECK(b->ewma == 700);
+    for(int i = 0; i < 40; i++) backends_report(&bs, BIBLEAPI, true, 100, 0);
+    CHECK(b->ewma >= 100 && b->ewma < 105);
+
+    // A zero-tick answer still counts as measured
+    backends_init(&bs, NULL, COOL);
+    backends_report(&bs, BIBLEAPI, true, 0, 0);
+    CHECK(bs.list[BIBLEAPI].ewma == 1);
+
+    // Failures leave the average alone; an answer clears the count
+    backends_report(&bs, BIBLEAPI, false, 0, 0);
+    CHECK(bs.list[BIBLEAPI].ewma == 1 && bs.list[BIBLEAPI].fails == 1);
+    backends_report(&bs, BIBLEAPI, true, 5, 0);
+    CHECK(bs.list[BIBLEAPI].fails == 0);
+
+    // Out-of-range index is ignored
+    backends_report(&bs, 7, true, 5, 0);
+    CHECK(bs.count == 1);
+}
+
+static void check_cooldown(void) {
+    printf("cooldown\n");
+    ApiBackends bs;
+    backends_init(&bs, "http://mirror", COOL);
+    ApiBackend* b = &bs.list[MIRROR];
+
+    backends_report(&bs, MIRROR, false, 0, 100);
+    CHECK(b->fails == 1);
+    backends_report(&bs, MIRROR, false, 0, 200);
+    CHECK(b->fails == API_BACKEND_FAILS && b->down_until == 200 + COOL);
+
+    // Every failure past the threshold restarts the cool-down
+    backends_report(&bs, MIRROR, false, 0, 200 + COOL);
+    CHECK(b->down_until == 200 + 2 * COOL);
+    CHECK(backends_pick(&bs, 1u << BIBLEAPI, 200 + COOL + 1) == MIRROR);
+    backends_report(&bs, BIBLEAPI, true, 5000, 0);
+    CHECK(backends_pick(&bs, 0, 200 + COOL + 1) == BIBLEAPI);
+    CHECK(backends_pick(&bs, 0, 200 + 2 * COOL) == MIRROR);
+
+    // The tick counter wrapping doesn't end a cool-down early
+    backends_init(&bs, "http://mirror", COOL);
+    uint32_t late = 0xFFFFFFFFu - 1000;
+    backends_report(&bs, MIRROR, false, 0, late);
+    backends_report(&bs, MIRROR, false, 0, late);
+    backends_report(&bs, BIBLEAPI, true, 10, 0);
+    CHECK(backends_pick(&bs, 0, late + 5000) == BIBLEAPI);
+    CHECK(backends_pick(&bs, 0, late + COOL) == MIRROR);
+}
+
+// ============================================================
+// Providers
+// ============================================================
+
+static void check_bibleapi(void) {
+    printf("bible-api\n");
+    ApiBackends bs;
+    backends_init(&bs, NULL, COOL);
+    const ApiBackend* b = &bs.list[BIBLEAPI];
+    char url[128], ref[48], text[256];
+
+    CHECK(b->url(b, "kjv", "John 3:16", url, sizeof(url)));
+    CHECK(strcmp(url, "https://bible-api.com/John+3:16?translation=kjv") == 0);
+    CHECK(!b->url(b, "kjv", "John 3:16", url, 20));
+
+    CHECK(b->parse("{\"reference\":\"John 3:16\",\"verses\":[{\"text\":\"inner\"}],"
+                   "\"text\":\"For God so loved \\\"the\\\" world\\n\"}",
+                   ref, sizeof(ref), text, sizeof(text)) == ApiAnswerFound);
+    CHECK(strcmp(ref, "John 3:16") == 0);
+    CHECK(strcmp(text, "For God so loved \"the\" world") == 0);
+    CHECK(b->parse("{\"error\":\"not found\"}", ref, sizeof(ref), text, sizeof(text)) ==
+          ApiAnswerMissing);
+    CHECK(b->parse("<html>502</html>", ref, sizeof(ref), text, sizeof(text)) == ApiAnswerBad);
+    CHECK(b->parse("{\"reference\":\"John 3:16\",\"text\":\"\"}", ref, sizeof(ref), text,
+                   sizeof(text)) == ApiAnswerBad);
+
+    // Long text is cut to the buffer
+    CHECK(b->parse("{\"reference\":\"Ps 119:1\",\"text\":\"abcdefghijklmnop\"}", ref,
+                   sizeof(ref), text, 8) == ApiAnswerFound);
+    CHECK(strcmp(text, "abcdefg") == 0);
+}
+
+static void check_mirror(void) {
+    printf("mirror\n");
+    ApiBackends bs;
+    backends_init(&bs, "http://mirror.lan/", COOL);
+    const ApiBackend* b = &bs.list[MIRROR];
+    char url[128], ref[48], text[256];
+
+    CHECK(b->url(b, "web", "1 John 4:8", url, sizeof(url)));
+    CHECK(strcmp(url, "http://mirror.lan/web/1+John+4:8") == 0);
+
+    CHECK(b->parse("John 11:35|Jesus wept.  \r\n", ref, sizeof(ref), text, sizeof(text)) ==
+          ApiAnswerFound);
+    CHECK(strcmp(ref, "John 11:35") == 0 && strcmp(text, "Jesus wept.") == 0);
+    // Only the first bar splits
+    CHECK(b->parse("Ref|a|b", ref, sizeof(ref), text, sizeof(text)) == ApiAnswerFound);
+    CHECK(strcmp(ref, "Ref") == 0 && strcmp(text, "a|b") == 0);
+    CHECK(b->parse("-", ref, sizeof(ref), text, sizeof(text)) == ApiAnswerMissing);
+    CHECK(b->parse("-\r\n", ref, sizeof(ref), text, sizeof(text)) == ApiAnswerMissing);
+    CHECK(b->parse("-5 degrees", ref, sizeof(ref), text, sizeof(text)) == ApiAnswerBad);
+    CHECK(b->parse("no bar here", ref, sizeof(ref), text, sizeof(text)) == ApiAnswerBad);
+    CHECK(b->parse("|text only", ref, sizeof(ref), text, sizeof(text)) == ApiAnswerBad);
+    CHECK(b->parse("Ref|   ", ref, sizeof(ref), text, sizeof(text)) == ApiAnswerBad);
+}
+
+int main(void) {
+    check_init();
+    check_pick();
+    check_ewma();
+    check_cooldown();
+    check_bibleapi();
+    check_mirror();
+    printf("%u checks, %u failed\n", checks, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,186 @@
+// bvbench.c — Host runner for the benchmark suite in bench/
+//
+// Runs BENCH_CASES against a copy of the app's data directory (the
+// verse files from the SD card) and appends the results to bench.csv in
+// that directory, in the same format the device's Benchmark view writes.
+// The index scan, wrap and worddiff cases run the same code as the
+// device (core/, search/); the other storage cases simulate the app's
+// reads and writes with stdio.
+//
+// Build from the repository root:
+//   cc -O2 -o bvbench tools/bvbench.c bench/bench.c core/core.c search/search.c search/worddiff.c meta/bible_meta.c
+//
+// Usage:
+//   bvbench [-f verse_file] data_dir
+//     -f  verse file inside data_dir (default verses_en.txt)
+
+#include "../bench/bench.h"
+#include "../core/core.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    char       path[4096];
+    char       bm_path[4096];     // scratch bookmark list, removed afterwards
+    FILE*      vfile;
+    VerseIndex index[MAX_VERSES];
+    uint16_t   verse_count;
+    uint16_t   bmarks[MAX_BOOKMARKS];
+    uint8_t    bm_count;
+    char       line[LINE_BUF_LEN];
+    WrapState  wrap;
+} Host;
+
+// Monotonic ns, truncated; one iteration stays far below the 4 s wrap
+static uint32_t host_now(void* ctx) {
+    (void)ctx;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+// ============================================================
+// Simulated app operations
+// ============================================================
+
+static size_t host_scan_read(void* ctx, void* buf, size_t n) {
+    return fread(buf, 1, n, ((Host*)ctx)->vfile);
+}
+
+// build_index without the section tables, as the device's bench runs it
+static bool host_index_build(Host* h) {
+    h->verse_count = 0;
+    if(fseek(h->vfile, 0, SEEK_SET) != 0) return false;
+    VerseScan scan = { h, host_scan_read, NULL };
+    h->verse_count = verse_index_scan(&scan, h->index);
+    return h->verse_count > 0;
+}
+
+static bool host_read_verse(Host* h, FILE* f, uint16_t vi) {
+    if(fseek(f, (long)h->index[vi].offset, SEEK_SET) != 0) return false;
+    size_t n = fread(h->line, 1, LINE_BUF_LEN - 1, f);
+    h->line[n] = '\0';
+    h->line[strcspn(h->line, "\r\n")] = '\0';
+    return n > 0;
+}
+
+// toggle_bmark and bmarks_save
+static bool host_toggle_bmark(Host* h, uint16_t vi) {
+    bool found = false;
+    for(uint8_t i = 0; i < h->bm_count && !found; i++) {
+        if(h->bmarks[i] != vi) continue;
+        memmove(h->bmarks + i, h->bmarks + i + 1, (size_t)(h->bm_count - i - 1) * sizeof(uint16_t));
+        h->bm_count--;
+        found = true;
+    }
+    if(!found) {
+        if(h->bm_count >= MAX_BOOKMARKS) return false;
+        h->bmarks[h->bm_count++] = vi;
+    }
+    FILE* f = fopen(h->bm_path, "wb");
+    if(!f) return false;
+    for(uint8_t i = 0; i < h->bm_count; i++) fprintf(f, "%u\n", h->bmarks[i]);
+    return fclose(f) == 0;
+}
+
+static bool host_run_op(void* ctx, const BenchCase* c, uint16_t iter) {
+    Host* h = ctx;
+    if(!h->verse_count) return false;
+    switch(c->op) {
+    case BenchOpIndexBuild:
+        return host_index_build(h);
+    case BenchOpVerseCold: {
+        FILE* f = fopen(h->path, "rb");
+        if(!f) return false;
+        bool ok = host_read_verse(h, f, (uint16_t)((iter * 7919u) % h->verse_count));
+        fclose(f);
+        return ok;
+    }
+    case BenchOpVerseWarm:
+        return host_read_verse(h, h->vfile, (uint16_t)(h->verse_count / 2));
+    case BenchOpSearch: {
+        MatchSpan spans[MAX_HIT_SPANS];
+        uint8_t   span_count;
+        for(uint16_t vi = 0; vi < h->verse_count; vi++) {
+            if(!host_read_verse(h, h->vfile, vi)) return false;
+            search_line(h->line, c->query, SearchModeSubstring, spans, MAX_HIT_SPANS, &span_count);
+        }
+        return true;
+    }
+    case BenchOpWrap:
+        word_wrap(&h->wrap, BENCH_WRAP_TEXT, FONT_CHARS[c->font]);
+        return true;
+    case BenchOpBookmarkToggle:
+        return host_toggle_bmark(h, 0);
+    default:
+        return false;
+    }
+}
+
+// ============================================================
+// Main
+// ============================================================
+
+int main(int argc, char** argv) {
+    const char* vname = "verses_en.txt";
+    int opt;
+    while((opt = getopt(argc, argv, "f:h")) != -1) {
+        switch(opt) {
+        case 'f': vname = optarg; break;
+        default:
+            fprintf(stderr, "usage: bvbench [-f verse_file] data_dir\n");
+            return 2;
+        }
+    }
+    if(argc - optind != 1) {
+        fprintf(stderr, "usage: bvbench [-f verse_file] data_dir\n");
+        return 2;
+    }
+    const char* dir = argv[optind];
+
+    Host* h = calloc(1, sizeof(Host));
+    if(!h) return 1;
+    snprintf(h->path,    sizeof(h->path),    "%s/%s", dir, vname);
+    snprintf(h->bm_path, sizeof(h->bm_path), "%s/bench_bookmarks.txt", dir);
+    h->vfile = fopen(h->path, "rb");
+    if(!h->vfile || !host_index_build(h)) {
+        fprintf(stderr, "bvbench: %s: no verses\n", h->path);
+        return 1;
+    }
+
+    BenchResult res[BENCH_CASE_COUNT];
+    BenchHooks hooks = { .ctx = h, .now = host_now, .ticks_per_us = 1000, .run = host_run_op };
+    for(uint8_t i = 0; i < BENCH_CASE_COUNT; i++) {
+        bench_run_case(&hooks, &BENCH_CASES[i], &res[i]);
+        char mean[24];
+        if(res[i].ok && bench_fmt_us(mean, sizeof(mean), bench_mean_ns(&res[i])))
+            printf("%-16s %12s us\n", BENCH_CASES[i].name, mean);
+        else
+            printf("%-16s     fail\n", BENCH_CASES[i].name);
+    }
+    fclose(h->vfile);
+    remove(h->bm_path);
+
+    char csv_path[4096];
+    snprintf(csv_path, sizeof(csv_path), "%s/%s", dir, BENCH_CSV_NAME);
+    FILE* csv = fopen(csv_path, "ab");
+    if(!csv) {
+        fprintf(stderr, "bvbench: cannot write %s\n", csv_path);
+        return 1;
+    }
+    char row[160];
+    size_t n;
+    if(ftell(csv) == 0 && (n = bench_csv_header(row, sizeof(row))) > 0) fwrite(row, 1, n, csv);
+    uint32_t now = (uint32_t)time(NULL);
+    for(uint8_t i = 0; i < BENCH_CASE_COUNT; i++) {
+        n = bench_csv_row(row, sizeof(row), now, "host", APP_VERSION, vname, &BENCH_CASES[i], &res[i]);
+        if(n) fwrite(row, 1, n, csv);
+    }
+    fclose(csv);
+    free(h);
+    return 0;
+}
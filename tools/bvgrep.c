@@ -0,0 +1,297 @@
+// bvgrep.c — Desktop verse search over the device's verse files and .idx caches
+//
+// Runs the device search engine (search/search.c, search/phonetic.c) over
+// one or more verse files, one worker thread per file up to the core
+// count. Each verse file needs the <file>.idx cache the app writes next to
+// it on the SD card: verses are read at the offsets it records, and
+// phonetic lookups use its PHON table, so the hits are the ones the device
+// finds. Output uses the Search Results screen's header and references.
+//
+// Build from the repository root:
+//   cc -O2 -pthread -Isearch -o bvgrep tools/bvgrep.c search/search.c search/phonetic.c search/idxfmt.c
+//
+// Usage:
+//   bvgrep [-w | -p] [-a] [-j threads] query file.txt...
+//     -w  whole-word mode     -p  phonetic (sound-alike names) mode
+//     -a  print every hit, not only the first MAX_SEARCH_RESULTS
+//     -j  worker threads (default: online cores)
+
+#include "search.h"
+#include "phonetic.h"
+#include "idxfmt.h"
+#include "../core/core.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// One verse file: inputs, and the results its worker fills in
+typedef struct {
+    const char* path;
+    VerseIndex* verses;
+    uint16_t    verse_count;
+    uint8_t*    phon;          // raw PHON entries from the .idx
+    uint16_t    phon_count;
+    uint8_t     phon_algo;
+    uint16_t*   hits;          // verse numbers in file order
+    uint16_t    hit_count;
+    uint16_t    total;
+    char        error[96];
+} Job;
+
+static const char* g_query;
+static size_t      g_query_len;
+static SearchMode  g_mode = SearchModeSubstring;
+static bool        g_all;
+
+static Job*            g_jobs;
+static int             g_job_count;
+static int             g_next_job;
+static pthread_mutex_t g_next_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// ============================================================
+// .idx cache
+// ============================================================
+
+// The same checks as index_cache_load: magic, version, source size and
+// verse count. A stale cache is refused rather than searched.
+static bool idx_file_read(void* ctx, void* buf, uint32_t len) {
+    return fread(buf, 1, len, ctx) == len;
+}
+
+static bool idx_file_seek(void* ctx, uint32_t offset) {
+    return fseek(ctx, (long)offset, SEEK_SET) == 0;
+}
+
+static bool idx_load(Job* j) {
+    FILE* src = fopen(j->path, "rb");
+    if(!src) {
+        snprintf(j->error, sizeof(j->error), "cannot open");
+        return false;
+    }
+    fseek(src, 0, SEEK_END);
+    long src_size = ftell(src);
+    fclose(src);
+
+    char idx_path[4096];
+    snprintf(idx_path, sizeof(idx_path), "%s.idx", j->path);
+    FILE* f = fopen(idx_path, "rb");
+    if(!f) {
+        snprintf(j->error, sizeof(j->error), "no .idx (open the file on the device once)");
+        return false;
+    }
+
+    bool ok = false;
+    uint8_t hdr[IDX_HDR_SZ];
+    uint16_t count = 0;
+    uint32_t cached_src = 0;
+    if(fread(hdr, 1, sizeof(hdr), f) != sizeof(hdr) ||
+       !idx_header_get(hdr, &count, &cached_src)) {
+        snprintf(j->error, sizeof(j->error), ".idx is from another app version");
+        goto done;
+    }
+    if(cached_src != (uint32_t)src_size) {
+        snprintf(j->error, sizeof(j->error), ".idx is stale (verse file changed)");
+        goto done;
+    }
+    if(count == 0 || count > MAX_VERSES) {
+        snprintf(j->error, sizeof(j->error), ".idx verse count out of range");
+        goto done;
+    }
+
+    j->verses = calloc(count, sizeof(VerseIndex));
+    if(!j->verses) goto done;
+    for(uint16_t i = 0; i < count; i++) {
+        uint8_t e[IDX_ENTRY_SZ];
+        if(fread(e, 1, sizeof(e), f) != sizeof(e)) {
+            snprintf(j->error, sizeof(j->error), ".idx is truncated");
+            goto done;
+        }
+        j->verses[i].offset = idx_entry_get(e, j->verses[i].ref, &j->verses[i].book);
+    }
+    j->verse_count = count;
+    ok = true;
+
+    // Only the PHON section matters here
+    IdxReader rd = { f, idx_file_read, idx_file_seek };
+    IdxSections sec;
+    idx_sections_read(&rd, IDX_HDR_SZ + (uint32_t)count * IDX_ENTRY_SZ, &sec);
+    if(sec.phon_off && fseek(f, (long)sec.phon_off, SEEK_SET) == 0) {
+        uint16_t n = sec.phon_count;
+        j->phon = malloc((size_t)n * PHON_ENTRY_SZ + 1);
+        if(j->phon && fread(j->phon, PHON_ENTRY_SZ, n, f) == n) {
+            j->phon_algo  = sec.phon_algo;
+            j->phon_count = n;
+        }
+    }
+
+done:
+    fclose(f);
+    return ok;
+}
+
+// ============================================================
+// Search
+// ============================================================
+
+// search_add_hit: ordered by verse, merged, capped like the device
+static void add_hit(Job* j, uint16_t vi) {
+    uint16_t i = 0;
+    while(i < j->hit_count && j->hits[i] < vi) i++;
+    if(i < j->hit_count && j->hits[i] == vi) return;
+    if(!g_all && j->hit_count >= MAX_SEARCH_RESULTS) return;
+    memmove(j->hits + i + 1, j->hits + i, (size_t)(j->hit_count - i) * sizeof(uint16_t));
+    j->hits[i] = vi;
+    j->hit_count++;
+}
+
+// phon_search: binary search for each query key, then the run of equal
+// keys. The device counts only the hits it keeps in this mode.
+static void search_phonetic(Job* j) {
+    uint32_t keys[2];
+    uint8_t nk = phonetic_keys(g_query, g_query_len, (PhoneticAlgo)j->phon_algo, keys);
+    for(uint8_t k = 0; k < nk; k++) {
+        uint16_t lo = 0, hi = j->phon_count;
+        while(lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            if(idx_get_u32(j->phon + (size_t)mid * PHON_ENTRY_SZ) < keys[k]) lo = mid + 1; else hi = mid;
+        }
+        for(uint16_t i = lo; i < j->phon_count; i++) {
+            const uint8_t* e = j->phon + (size_t)i * PHON_ENTRY_SZ;
+            if(idx_get_u32(e) != keys[k]) break;
+            uint16_t verse = idx_get_u16(e + 4);
+            if(verse < j->verse_count) add_hit(j, verse);
+        }
+    }
+    j->total = j->hit_count;
+}
+
+// search_job_step: every verse line read at its .idx offset, cut at the
+// line buffer size and the first line break
+static void search_text(Job* j) {
+    FILE* f = fopen(j->path, "rb");
+    if(!f) {
+        snprintf(j->error, sizeof(j->error), "cannot open");
+        return;
+    }
+    char line[LINE_BUF_LEN];
+    MatchSpan spans[MAX_HIT_SPANS];
+    uint8_t span_count;
+    for(uint16_t vi = 0; vi < j->verse_count; vi++) {
+        if(fseek(f, (long)j->verses[vi].offset, SEEK_SET) != 0) break;
+        size_t got = fread(line, 1, LINE_BUF_LEN - 1, f);
+        line[got] = '\0';
+        line[strcspn(line, "\r\n")] = '\0';
+        if(!search_line(line, g_query, g_mode, spans, MAX_HIT_SPANS, &span_count)) continue;
+        j->total++;
+        if(g_all || j->hit_count < MAX_SEARCH_RESULTS) j->hits[j->hit_count++] = vi;
+    }
+    fclose(f);
+}
+
+static void* worker(void* arg) {
+    (void)arg;
+    for(;;) {
+        pthread_mutex_lock(&g_next_lock);
+        int n = g_next_job < g_job_count ? g_next_job++ : -1;
+        pthread_mutex_unlock(&g_next_lock);
+        if(n < 0) return NULL;
+
+        Job* j = &g_jobs[n];
+        if(!idx_load(j)) continue;
+        j->hits = malloc((size_t)j->verse_count * sizeof(uint16_t));
+        if(!j->hits) {
+            snprintf(j->error, sizeof(j->error), "out of memory");
+            continue;
+        }
+        if(g_mode == SearchModePhonetic)
+            search_phonetic(j);
+        else
+            search_text(j);
+    }
+}
+
+// ============================================================
+// Output — the Search Results screen, one block per file
+// ============================================================
+
+static void print_job(const Job* j) {
+    if(j->error[0]) {
+        fprintf(stderr, "bvgrep: %s: %s\n", j->path, j->error);
+        return;
+    }
+    if(j->total == 0)
+        printf("== %s: Not found\n", j->path);
+    else if(j->total > j->hit_count)
+        printf("== %s: Found: %u (%u)\n", j->path, (unsigned)j->total, (unsigned)j->hit_count);
+    else
+        printf("== %s: Found: %d\n", j->path, (int)j->hit_count);
+    for(uint16_t i = 0; i < j->hit_count; i++)
+        printf("%s\n", j->verses[j->hits[i]].ref);
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: bvgrep [-w | -p] [-a] [-j threads] query file.txt...\n"
+            "  -w  whole-word mode\n"
+            "  -p  phonetic (sound-alike names) mode\n"
+            "  -a  print every hit, not only the first %d\n"
+            "  -j  worker threads (default: online cores)\n",
+            MAX_SEARCH_RESULTS);
+}
+
+int main(int argc, char** argv) {
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int opt;
+    while((opt = getopt(argc, argv, "wpaj:h")) != -1) {
+        switch(opt) {
+        case 'w': g_mode = SearchModeWholeWord; break;
+        case 'p': g_mode = SearchModePhonetic;  break;
+        case 'a': g_all  = true;                break;
+        case 'j': threads = strtol(optarg, NULL, 10); break;
+        default:  usage(); return 2;
+        }
+    }
+    if(argc - optind < 2) { usage(); return 2; }
+
+    // The keyboard holds at most MAX_SEARCH_LEN - 1 characters
+    g_query     = argv[optind++];
+    g_query_len = strlen(g_query);
+    if(g_query_len == 0 || g_query_len >= MAX_SEARCH_LEN) {
+        fprintf(stderr, "bvgrep: query must be 1..%d bytes\n", MAX_SEARCH_LEN - 1);
+        return 2;
+    }
+
+    g_job_count = argc - optind;
+    g_jobs = calloc((size_t)g_job_count, sizeof(Job));
+    if(!g_jobs) return 1;
+    for(int i = 0; i < g_job_count; i++) g_jobs[i].path = argv[optind + i];
+
+    size_t nthreads = threads < 1 ? 1 : (size_t)threads;
+    if(nthreads > (size_t)g_job_count) nthreads = (size_t)g_job_count;
+    pthread_t* tids = calloc(nthreads, sizeof(pthread_t));
+    if(!tids) return 1;
+    size_t started = 0;
+    for(; started < nthreads; started++)
+        if(pthread_create(&tids[started], NULL, worker, NULL) != 0) break;
+    if(started == 0) worker(NULL);
+    for(size_t i = 0; i < started; i++) pthread_join(tids[i], NULL);
+
+    // Printed in argument order whatever order the workers finished in
+    int status = 1;
+    for(int i = 0; i < g_job_count; i++) {
+        print_job(&g_jobs[i]);
+        if(g_jobs[i].error[0]) status = 2;
+        else if(g_jobs[i].total && status == 1) status = 0;
+    }
+    for(int i = 0; i < g_job_count; i++) {
+        free(g_jobs[i].verses);
+        free(g_jobs[i].phon);
+        free(g_jobs[i].hits);
+    }
+    free(g_jobs);
+    free(tids);
+    return status;
+}
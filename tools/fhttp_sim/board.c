@@ -0,0 +1,268 @@
+// board.c — Simulated FlipperHTTP WiFi board
+
+#define _GNU_SOURCE
+#include "board.h"
+#include "furi_hal_serial.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Must match flipper_http.h
+#define SIM_BAUDRATE   115200
+#define SIM_FRAME_SOF  0xA5
+#define SIM_FRAME_LINE 0x01
+#define SIM_FRAME_DATA 0x02
+#define SIM_FRAME_END  0x03
+#define SIM_DATA_CHUNK 512
+
+static uint64_t board_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
+
+// Rates past what the wiring carries come out garbled both ways
+static bool board_line_ok(const SimBoard* b, uint32_t rate) {
+    return rate == b->rate && (!b->max_rate || b->rate <= b->max_rate);
+}
+
+// ============================================================
+// Sending
+// ============================================================
+
+static void board_write(SimBoard* b, const void* data, size_t len) {
+    if(b->max_rate && b->rate > b->max_rate) {
+        uint8_t* junk = malloc(len);
+        if(!junk) return;
+        for(size_t i = 0; i < len; i++) junk[i] = (uint8_t)~((const uint8_t*)data)[i];
+        furi_shim_link_write(b->fd, b->rate, junk, len);
+        free(junk);
+    } else {
+        furi_shim_link_write(b->fd, b->rate, data, len);
+    }
+    b->tx_bytes += len;
+}
+
+static uint16_t board_crc16(uint16_t crc, uint8_t v) {
+    crc ^= (uint16_t)v << 8;
+    for(uint8_t i = 0; i < 8; i++)
+        crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    return crc;
+}
+
+static void board_frame(SimBoard* b, uint8_t type, const void* payload, uint16_t len, bool bad_crc) {
+    uint8_t* f = malloc((size_t)len + 6);
+    if(!f) return;
+    f[0] = SIM_FRAME_SOF;
+    f[1] = type;
+    f[2] = (uint8_t)len;
+    f[3] = (uint8_t)(len >> 8);
+    memcpy(f + 4, payload, len);
+    uint16_t crc = 0xFFFF;
+    for(size_t i = 1; i < (size_t)len + 4; i++) crc = board_crc16(crc, f[i]);
+    if(bad_crc) crc ^= 0x0101;
+    f[len + 4] = (uint8_t)crc;
+    f[len + 5] = (uint8_t)(crc >> 8);
+    board_write(b, f, (size_t)len + 6);
+    free(f);
+}
+
+// One response line: a text line, or a FRAME_LINE in framed mode
+static void board_say(SimBoard* b, const char* text) {
+    size_t n = strlen(text);
+    if(b->framed) {
+        board_frame(b, SIM_FRAME_LINE, text, (uint16_t)n, false);
+        return;
+    }
+    char* l = malloc(n + 1);
+    if(!l) return;
+    memcpy(l, text, n);
+    l[n] = '\n';
+    board_write(b, l, n + 1);
+    free(l);
+}
+
+// ============================================================
+// Commands
+// ============================================================
+
+static long board_url_arg(const char* url, const char* key, long def) {
+    const char* p = strstr(url, key);
+    return p ? strtol(p + strlen(key), NULL, 10) : def;
+}
+
+static void board_get(SimBoard* b, const char* url, bool bytes) {
+    b->gets++;
+    if(strstr(url, "hang")) {
+        b->hung = true;
+        return;
+    }
+    if(strstr(url, "error")) {
+        board_say(b, "[ERROR] GET request failed");
+        return;
+    }
+    bool end     = !strstr(url, "noend");
+    bool corrupt = b->framed && strstr(url, "corrupt");
+    long lines   = board_url_arg(url, "lines=", 0);
+    long pad     = board_url_arg(url, "len=", 0);
+    long nbytes  = board_url_arg(url, "bytes=", 0);
+    if(pad > 1000) pad = 1000;
+
+    char hdr[96];
+    snprintf(hdr, sizeof(hdr), "[GET/SUCCESS]{\"Status-Code\":200,\"Content-Length\":%ld}",
+             bytes ? nbytes : lines * (pad + 1) + (long)strlen(url) + 1);
+    board_say(b, hdr);
+
+    if(corrupt) {
+        // A line with a bad CRC, then a header claiming 4 KB with a bit
+        // of payload; the decoder must drop both and resync on the next SOF
+        board_frame(b, SIM_FRAME_LINE, "bogus line", 10, true);
+        uint8_t big[] = { SIM_FRAME_SOF, SIM_FRAME_LINE, 0x00, 0x10, 'j', 'u', 'n', 'k' };
+        board_write(b, big, sizeof(big));
+    }
+
+    if(bytes) {
+        uint8_t chunk[SIM_DATA_CHUNK];
+        for(long off = 0; off < nbytes; off += SIM_DATA_CHUNK) {
+            uint16_t n = (uint16_t)(nbytes - off < SIM_DATA_CHUNK ? nbytes - off : SIM_DATA_CHUNK);
+            for(uint16_t i = 0; i < n; i++) chunk[i] = (uint8_t)(off + i);
+            if(b->framed) board_frame(b, SIM_FRAME_DATA, chunk, n, false);
+            else board_write(b, chunk, n);
+        }
+    } else {
+        char body[1100];
+        for(long i = 0; i < lines; i++) {
+            int n = snprintf(body, sizeof(body), "line %ld", i);
+            while(n < pad) body[n++] = '.';
+            body[n] = '\0';
+            board_say(b, body);
+        }
+        board_say(b, url);
+    }
+
+    if(!end) return;
+    if(b->framed) board_frame(b, SIM_FRAME_END, NULL, 0, false);
+    else board_say(b, "[GET/END]");
+}
+
+// The url field of a [GET/HTTP] or [GET/BYTES] JSON argument
+static bool board_json_url(const char* json, char* url, size_t url_sz) {
+    const char* p = strstr(json, "\"url\":\"");
+    if(!p) return false;
+    p += 7;
+    const char* e = strchr(p, '"');
+    if(!e || (size_t)(e - p) >= url_sz) return false;
+    memcpy(url, p, (size_t)(e - p));
+    url[e - p] = '\0';
+    return true;
+}
+
+static void board_command(SimBoard* b, const char* cmd) {
+    if(b->hung) return;
+    if(cmd[0] != '[') {
+        b->garbage++;
+        return;
+    }
+    b->cmds++;
+    char url[512];
+    if(strcmp(cmd, "[PING]") == 0) {
+        b->pings++;
+        // A PING heard at a new rate confirms it
+        if(b->unconfirmed) {
+            b->confirmed   = b->rate;
+            b->unconfirmed = false;
+        }
+        board_say(b, "[PONG]");
+    } else if(strncmp(cmd, "[BAUD]", 6) == 0) {
+        b->baud_cmds++;
+        uint32_t rate = (uint32_t)strtoul(cmd + 6, NULL, 10);
+        if(!b->can_baud || (rate != SIM_BAUDRATE && rate != 230400 && rate != 460800 &&
+                            rate != 921600)) {
+            board_say(b, "[ERROR] Unsupported baud rate");
+            return;
+        }
+        // Acknowledged at the old rate, then switched until confirmed
+        board_say(b, "[BAUD/OK]");
+        b->rate = rate;
+        b->unconfirmed = rate != b->confirmed;
+        b->unconfirmed_since_ms = board_now_ms();
+    } else if(strcmp(cmd, "[FRAME/ON]") == 0) {
+        if(!b->can_frame) {
+            board_say(b, "[ERROR] Unknown command");
+            return;
+        }
+        board_say(b, "[FRAME/OK]");
+        b->framed = true;
+    } else if(strcmp(cmd, "[FRAME/OFF]") == 0) {
+        board_say(b, "[FRAME/OFF]");
+        b->framed = false;
+    } else if(strncmp(cmd, "[GET/HTTP]", 10) == 0 && board_json_url(cmd + 10, url, sizeof(url))) {
+        board_get(b, url, false);
+    } else if(strncmp(cmd, "[GET/BYTES]", 11) == 0 && board_json_url(cmd + 11, url, sizeof(url))) {
+        board_get(b, url, true);
+    } else if(strncmp(cmd, "[GET]", 5) == 0) {
+        board_get(b, cmd + 5, false);
+    } else {
+        b->cmds--;
+        b->garbage++;
+    }
+}
+
+// ============================================================
+// Thread
+// ============================================================
+
+static void* board_main(void* arg) {
+    SimBoard* b = arg;
+    uint8_t* buf = malloc(0x10000);
+    if(!buf) return NULL;
+    while(b->run) {
+        if(b->unconfirmed && board_now_ms() - b->unconfirmed_since_ms >= b->revert_ms) {
+            b->rate        = b->confirmed;
+            b->unconfirmed = false;
+        }
+        uint32_t rate;
+        size_t   len;
+        int r = furi_shim_link_read(b->fd, 5, &rate, buf, &len);
+        if(r < 0) break;
+        if(r == 0) continue;
+        // Bytes at the wrong rate are framing errors; the UART drops them
+        if(!board_line_ok(b, rate)) {
+            b->garbage++;
+            continue;
+        }
+        for(size_t i = 0; i < len; i++) {
+            uint8_t c = buf[i];
+            if(c == '\r') continue;
+            if(c != '\n') {
+                if(b->line_len < sizeof(b->line) - 1) b->line[b->line_len++] = (char)c;
+                continue;
+            }
+            b->line[b->line_len] = '\0';
+            b->line_len = 0;
+            board_command(b, b->line);
+        }
+    }
+    free(buf);
+    return NULL;
+}
+
+void board_start(SimBoard* b, int fd, uint32_t rate) {
+    b->fd        = fd;
+    b->rate      = rate;
+    b->confirmed = rate;
+    if(!b->revert_ms) b->revert_ms = 600;
+    b->run = true;
+    pthread_create(&b->tid, NULL, board_main, b);
+}
+
+void board_stop(SimBoard* b) {
+    b->run = false;
+    pthread_join(b->tid, NULL);
+}
+
+void board_unhang(SimBoard* b) {
+    b->hung = false;
+}
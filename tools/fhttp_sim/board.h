@@ -0,0 +1,65 @@
+// board.h — Simulated FlipperHTTP WiFi board for the host tests
+//
+// Runs on its own thread at the far end of the shim UART and answers the
+// commands flipper_http.c sends: [PING], [BAUD]<rate>, [FRAME/ON] and
+// [FRAME/OFF], [GET/HTTP] and [GET/BYTES]. Commands are read one line at
+// a time and answered in order, as the firmware does.
+//
+// A GET answers with its URL as the last body line, so tests can match
+// responses to requests. Words in the URL script the answer:
+//   lines=N    N body lines before the URL line (default 0)
+//   len=N      pad each body line to N bytes
+//   bytes=N    N bytes of data for [GET/BYTES] (pattern i & 0xFF)
+//   noend      leave out the end marker or FRAME_END
+//   corrupt    framed mode: send a frame with a bad CRC and one with a
+//              bad length ahead of the real ones
+//   error      answer [ERROR] instead
+//   hang       stop answering anything until board_unhang
+#pragma once
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    int       fd;
+    pthread_t tid;
+    volatile bool run;
+
+    // Firmware features
+    bool     can_frame;    // knows [FRAME/ON]
+    bool     can_baud;     // knows [BAUD]
+    uint32_t max_rate;     // fastest rate the wiring carries; 0 = any
+    uint32_t revert_ms;    // silence after which an unconfirmed rate is dropped
+
+    // Line state; the test thread only reads these
+    volatile uint32_t rate;          // current rate
+    volatile uint32_t confirmed;     // rate kept if the current one is dropped
+    volatile bool     unconfirmed;   // switched, no [PING] heard at the new rate yet
+    volatile bool     framed;
+    volatile bool     hung;
+
+    // Counters
+    volatile uint32_t cmds;          // command lines understood
+    volatile uint32_t pings;
+    volatile uint32_t baud_cmds;
+    volatile uint32_t gets;
+    volatile uint32_t garbage;       // chunks heard at the wrong rate, lines that didn't parse
+    volatile uint64_t tx_bytes;      // bytes put on the wire
+
+    uint64_t unconfirmed_since_ms;
+    char     line[1024];
+    uint16_t line_len;
+} SimBoard;
+
+// Start the board at rate on fd (the socketpair end the Flipper doesn't use)
+void board_start(SimBoard* b, int fd, uint32_t rate);
+void board_stop(SimBoard* b);
+void board_unhang(SimBoard* b);
+
+#ifdef __cplusplus
+}
+#endif
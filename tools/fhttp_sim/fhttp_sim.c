@@ -0,0 +1,696 @@
+// fhttp_sim.c — Host tests for flipper_http.c against a simulated board
+//
+// Runs the FlipperHTTP library unchanged on the Furi stand-ins in shim/,
+// with its UART wired through a socketpair to the board in board.c.
+// Each test gets a fresh board and connection.
+//
+// Build from the repository root:
+//   cc -O2 -pthread -Itools/fhttp_sim/shim -I. -o fhttp_sim tools/fhttp_sim/fhttp_sim.c
+//      tools/fhttp_sim/board.c tools/fhttp_sim/shim/furi_shim.c flipper_http/flipper_http.c
+//
+// Usage:
+//   fhttp_sim [group]
+//     group  queue, frame, baud or iter; all groups when left out
+// Set FHTTP_SIM_LOG=1 to see the library's log lines.
+
+#define _GNU_SOURCE
+#include "board.h"
+
+#include <flipper_http/flipper_http.h>
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+static unsigned checks, failures;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        checks++;                                                            \
+        if(!(cond)) {                                                        \
+            failures++;                                                      \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+        }                                                                    \
+    } while(0)
+
+static uint64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
+
+// ============================================================
+// Connection
+// ============================================================
+
+typedef struct {
+    SimBoard     board;
+    FlipperHTTP* fhttp;
+    int          fds[2];
+} Sim;
+
+// A board with the given features at BAUDRATE, and a connection to it
+static bool sim_open(Sim* s, const SimBoard* features) {
+    memset(s, 0, sizeof(*s));
+    if(features) s->board = *features;
+    if(socketpair(AF_UNIX, SOCK_STREAM, 0, s->fds) != 0) return false;
+    board_start(&s->board, s->fds[1], BAUDRATE);
+    furi_shim_serial_attach(s->fds[0]);
+    s->fhttp = flipper_http_alloc();
+    return s->fhttp != NULL;
+}
+
+static void sim_close(Sim* s) {
+    if(s->fhttp) flipper_http_free(s->fhttp);
+    s->fhttp = NULL;
+    shutdown(s->fds[0], SHUT_RDWR);
+    board_stop(&s->board);
+    close(s->fds[0]);
+    close(s->fds[1]);
+}
+
+// ============================================================
+// Tagged responses
+// ============================================================
+
+#define LOG_MAX 16
+
+typedef struct {
+    pthread_mutex_t mx;
+    volatile uint8_t n;
+    uint16_t id[LOG_MAX];
+    bool     ok[LOG_MAX];
+    char     resp[LOG_MAX][128];
+} Log;
+
+static void log_init(Log* l) {
+    memset(l, 0, sizeof(*l));
+    pthread_mutex_init(&l->mx, NULL);
+}
+
+static void log_response(uint16_t id, bool ok, const char* response, void* context) {
+    Log* l = context;
+    pthread_mutex_lock(&l->mx);
+    if(l->n < LOG_MAX) {
+        l->id[l->n] = id;
+        l->ok[l->n] = ok;
+        snprintf(l->resp[l->n], sizeof(l->resp[0]), "%s", response ? response : "");
+        l->n++;
+    }
+    pthread_mutex_unlock(&l->mx);
+}
+
+// Wait until n responses are logged; false after timeout_ms
+static bool log_wait(Log* l, uint8_t n, uint32_t timeout_ms) {
+    uint64_t end = now_ms() + timeout_ms;
+    while(l->n < n) {
+        if(now_ms() > end) return false;
+        usleep(5000);
+    }
+    return true;
+}
+
+static uint16_t get(Sim* s, const char* url, Log* l) {
+    return flipper_http_request_tagged(s->fhttp, GET, url, NULL, NULL, log_response, l);
+}
+
+// An untagged [GET/BYTES] into path; false if it didn't end in timeout_ms
+static bool get_bytes(Sim* s, const char* url, const char* path, uint32_t timeout_ms) {
+    snprintf(s->fhttp->file_path, sizeof(s->fhttp->file_path), "%s", path);
+    if(!flipper_http_request(s->fhttp, BYTES, url, "{}", NULL)) return false;
+    uint64_t end = now_ms() + timeout_ms;
+    while(s->fhttp->is_bytes_request) {
+        if(now_ms() > end) return false;
+        usleep(2000);
+    }
+    return true;
+}
+
+// The file holds n bytes of the board's i & 0xFF pattern, then tail
+static bool file_is_pattern(const char* path, long n, const char* tail) {
+    FILE* f = fopen(path, "rb");
+    if(!f) return false;
+    long i = 0, t = (long)strlen(tail);
+    int c;
+    bool ok = true;
+    while((c = fgetc(f)) != EOF) {
+        if(i >= n + t || c != (i < n ? (int)(i & 0xFF) : (uint8_t)tail[i - n])) ok = false;
+        i++;
+    }
+    fclose(f);
+    return ok && i == n + t;
+}
+
+// ============================================================
+// Request queue
+// ============================================================
+
+static void test_fifo(void) {
+    printf("fifo\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, NULL));
+
+    // The first response is long enough that the queue is still full
+    // when the fifth request comes in
+    static const char* urls[] = {
+        "http://sim/a?lines=40&len=100", "http://sim/b?lines=2",
+        "http://sim/c",                  "http://sim/d?lines=5&len=50",
+    };
+    uint16_t ids[4];
+    for(int i = 0; i < 4; i++) {
+        ids[i] = get(&s, urls[i], &l);
+        CHECK(ids[i] != 0);
+    }
+    CHECK(flipper_http_pending_count(s.fhttp) == 4);
+    CHECK(get(&s, "http://sim/e", &l) == 0);
+
+    CHECK(log_wait(&l, 4, 3000));
+    for(int i = 0; i < 4 && i < l.n; i++) {
+        CHECK(l.id[i] == ids[i]);
+        CHECK(l.ok[i]);
+        CHECK(strcmp(l.resp[i], urls[i]) == 0);
+    }
+    CHECK(flipper_http_pending_count(s.fhttp) == 0);
+    CHECK(s.board.gets == 4);
+    sim_close(&s);
+}
+
+static void test_error(void) {
+    printf("error\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, NULL));
+
+    // [ERROR] fails the oldest request only
+    uint16_t a = get(&s, "http://sim/error", &l);
+    uint16_t b = get(&s, "http://sim/b?lines=3", &l);
+    CHECK(log_wait(&l, 2, 3000));
+    CHECK(l.id[0] == a && !l.ok[0]);
+    CHECK(l.id[1] == b && l.ok[1] && strcmp(l.resp[1], "http://sim/b?lines=3") == 0);
+    sim_close(&s);
+}
+
+static void test_cancel(void) {
+    printf("cancel\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, NULL));
+
+    uint16_t a = get(&s, "http://sim/a?lines=20&len=100", &l);
+    uint16_t b = get(&s, "http://sim/b?lines=3", &l);
+    uint16_t c = get(&s, "http://sim/c", &l);
+    flipper_http_cancel(s.fhttp, b);
+
+    // b's response still takes its turn, so c gets its own
+    CHECK(log_wait(&l, 2, 3000));
+    CHECK(!log_wait(&l, 3, 300));
+    CHECK(l.id[0] == a && l.ok[0] && strcmp(l.resp[0], "http://sim/a?lines=20&len=100") == 0);
+    CHECK(l.id[1] == c && l.ok[1] && strcmp(l.resp[1], "http://sim/c") == 0);
+    CHECK(flipper_http_pending_count(s.fhttp) == 0);
+    CHECK(s.board.gets == 3);
+    sim_close(&s);
+}
+
+static void test_timeout(void) {
+    printf("timeout\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, NULL));
+
+    // A board that stops answering fails the whole queue, in order
+    uint64_t t0 = now_ms();
+    uint16_t ids[3];
+    ids[0] = get(&s, "http://sim/hang", &l);
+    ids[1] = get(&s, "http://sim/b", &l);
+    ids[2] = get(&s, "http://sim/c", &l);
+    CHECK(log_wait(&l, 3, TIMEOUT_DURATION_TICKS + 2000));
+    uint64_t took = now_ms() - t0;
+    CHECK(took >= TIMEOUT_DURATION_TICKS - 100 && took < TIMEOUT_DURATION_TICKS + 1000);
+    for(int i = 0; i < 3; i++) CHECK(l.id[i] == ids[i] && !l.ok[i]);
+    CHECK(flipper_http_pending_count(s.fhttp) == 0);
+
+    // and the connection is usable once the board answers again
+    board_unhang(&s.board);
+    uint16_t d = get(&s, "http://sim/d?lines=2", &l);
+    CHECK(d != 0);
+    CHECK(log_wait(&l, 4, 3000));
+    CHECK(l.id[3] == d && l.ok[3] && strcmp(l.resp[3], "http://sim/d?lines=2") == 0);
+    sim_close(&s);
+}
+
+static void group_queue(void) {
+    test_fifo();
+    test_error();
+    test_cancel();
+    test_timeout();
+}
+
+// ============================================================
+// Framed mode
+// ============================================================
+
+static const SimBoard FRAMING = { .can_frame = true, .can_baud = true };
+
+static void test_frame_negotiate(void) {
+    printf("frame negotiate\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+
+    // Old firmware answers [ERROR] and the link stays in text mode
+    CHECK(sim_open(&s, NULL));
+    CHECK(!flipper_http_frame_negotiate(s.fhttp));
+    CHECK(!s.fhttp->framed && !s.board.framed);
+    CHECK(get(&s, "http://sim/a?lines=2", &l) != 0);
+    CHECK(log_wait(&l, 1, 3000) && l.ok[0] && strcmp(l.resp[0], "http://sim/a?lines=2") == 0);
+    sim_close(&s);
+
+    CHECK(sim_open(&s, &FRAMING));
+    CHECK(flipper_http_frame_negotiate(s.fhttp));
+    CHECK(s.fhttp->framed && s.board.framed);
+    sim_close(&s);
+}
+
+static void test_frame_lines(void) {
+    printf("frame lines\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, &FRAMING));
+    CHECK(flipper_http_frame_negotiate(s.fhttp));
+
+    // FRAME_END finishes each response in turn
+    uint16_t a = get(&s, "http://sim/a?lines=30&len=200", &l);
+    uint16_t b = get(&s, "http://sim/b", &l);
+    CHECK(log_wait(&l, 2, 3000));
+    CHECK(l.id[0] == a && l.ok[0] && strcmp(l.resp[0], "http://sim/a?lines=30&len=200") == 0);
+    CHECK(l.id[1] == b && l.ok[1] && strcmp(l.resp[1], "http://sim/b") == 0);
+    CHECK(s.fhttp->frame_errors == 0);
+    sim_close(&s);
+}
+
+static void test_frame_data(void) {
+    printf("frame data\n");
+    const char* path = "/tmp/fhttp_sim_data.bin";
+    Sim s;
+    CHECK(sim_open(&s, &FRAMING));
+    CHECK(flipper_http_frame_negotiate(s.fhttp));
+
+    // DATA frames go to the file as they are, whatever bytes they carry
+    CHECK(get_bytes(&s, "http://sim/x?bytes=5000", path, 3000));
+    CHECK(file_is_pattern(path, 5000, ""));
+    CHECK(get_bytes(&s, "http://sim/y?bytes=512", path, 3000));
+    CHECK(file_is_pattern(path, 512, ""));
+    CHECK(s.fhttp->frame_errors == 0);
+    remove(path);
+    sim_close(&s);
+}
+
+static void test_frame_corrupt(void) {
+    printf("frame corrupt\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, &FRAMING));
+    CHECK(flipper_http_frame_negotiate(s.fhttp));
+
+    // A bad CRC and an oversized length are dropped; the decoder finds
+    // the next frame and the response still completes
+    uint16_t a = get(&s, "http://sim/a?corrupt&lines=3", &l);
+    CHECK(log_wait(&l, 1, 3000));
+    CHECK(l.id[0] == a && l.ok[0] && strcmp(l.resp[0], "http://sim/a?corrupt&lines=3") == 0);
+    CHECK(s.fhttp->frame_errors == 2);
+    sim_close(&s);
+}
+
+static void test_frame_lost_end(void) {
+    printf("frame lost end\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, &FRAMING));
+    CHECK(flipper_http_frame_negotiate(s.fhttp));
+
+    // Without FRAME_END the request timer fails it
+    uint64_t t0 = now_ms();
+    uint16_t a = get(&s, "http://sim/a?noend&lines=2", &l);
+    CHECK(log_wait(&l, 1, TIMEOUT_DURATION_TICKS + 2000));
+    CHECK(now_ms() - t0 >= TIMEOUT_DURATION_TICKS - 100);
+    CHECK(l.id[0] == a && !l.ok[0]);
+    CHECK(!s.fhttp->started_receiving);
+
+    uint16_t b = get(&s, "http://sim/b?lines=2", &l);
+    CHECK(log_wait(&l, 2, 3000));
+    CHECK(l.id[1] == b && l.ok[1] && strcmp(l.resp[1], "http://sim/b?lines=2") == 0);
+    sim_close(&s);
+}
+
+static void test_frame_off(void) {
+    printf("frame off\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, &FRAMING));
+    CHECK(flipper_http_frame_negotiate(s.fhttp));
+
+    // [FRAME/OFF] comes back as the last frame, then text resumes
+    CHECK(flipper_http_send_data(s.fhttp, "[FRAME/OFF]"));
+    uint64_t end = now_ms() + 1000;
+    while(s.fhttp->framed && now_ms() < end) usleep(2000);
+    CHECK(!s.fhttp->framed && !s.board.framed);
+    CHECK(get(&s, "http://sim/a?lines=2", &l) != 0);
+    CHECK(log_wait(&l, 1, 3000) && l.ok[0] && strcmp(l.resp[0], "http://sim/a?lines=2") == 0);
+    sim_close(&s);
+}
+
+// Payload, wire bytes and time for one response in each mode and rate.
+// Lines are 100 bytes of body; bytes responses are a multiple of 256 so
+// the text-mode stream ends in a line without a NUL, which the text
+// parser needs to find [GET/END]. Text mode cuts the marker out of the
+// file but keeps the newline after it; frames carry the data exactly.
+static void test_frame_throughput(void) {
+    printf("throughput\n");
+    static const uint32_t rates[] = { BAUDRATE, 921600 };
+    const char* path = "/tmp/fhttp_sim_tp.bin";
+    printf("  %-6s %-6s %7s %9s %7s %8s %9s\n", "kind", "mode", "rate", "payload", "wire",
+           "ms", "payload/s");
+    for(int kind = 0; kind < 2; kind++) {
+        for(size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+            for(int framed = 0; framed < 2; framed++) {
+                Sim s;
+                Log l;
+                log_init(&l);
+                CHECK(sim_open(&s, &FRAMING));
+                CHECK(flipper_http_set_baudrate(s.fhttp, rates[r]));
+                if(framed) CHECK(flipper_http_frame_negotiate(s.fhttp));
+                uint64_t wire0 = s.board.tx_bytes;
+                uint64_t t0    = now_ms();
+                long payload;
+                bool done;
+                if(kind == 0) {
+                    payload = 200 * 101;
+                    CHECK(get(&s, "http://sim/t?lines=200&len=100", &l) != 0);
+                    done = log_wait(&l, 1, 10000) && l.ok[0];
+                } else {
+                    payload = 80 * 256;
+                    done = get_bytes(&s, "http://sim/t?bytes=20480", path, 10000) &&
+                           file_is_pattern(path, payload, framed ? "" : "\n");
+                }
+                CHECK(done);
+                uint64_t ms   = now_ms() - t0;
+                uint64_t wire = s.board.tx_bytes - wire0;
+                printf("  %-6s %-6s %7u %9ld %7llu %8llu %7.1f KB\n", kind ? "bytes" : "lines",
+                       framed ? "framed" : "text", (unsigned)rates[r], payload,
+                       (unsigned long long)wire, (unsigned long long)ms,
+                       ms ? payload / 1.024 / (double)ms : 0.0);
+                remove(path);
+                sim_close(&s);
+            }
+        }
+    }
+}
+
+static void group_frame(void) {
+    test_frame_negotiate();
+    test_frame_lines();
+    test_frame_data();
+    test_frame_corrupt();
+    test_frame_lost_end();
+    test_frame_off();
+    test_frame_throughput();
+}
+
+// ============================================================
+// Baud rate
+// ============================================================
+
+static void test_baud_set(void) {
+    printf("baud set\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, &FRAMING));
+    CHECK(flipper_http_set_baudrate(s.fhttp, 921600));
+    CHECK(s.fhttp->baudrate == 921600);
+    CHECK(s.board.rate == 921600 && s.board.confirmed == 921600 && !s.board.unconfirmed);
+    CHECK(get(&s, "http://sim/a?lines=10&len=100", &l) != 0);
+    CHECK(log_wait(&l, 1, 3000) && l.ok[0] && strcmp(l.resp[0], "http://sim/a?lines=10&len=100") == 0);
+    sim_close(&s);
+
+    // Firmware without [BAUD] answers [ERROR]; nothing changes
+    SimBoard old = { .can_frame = false, .can_baud = false };
+    CHECK(sim_open(&s, &old));
+    CHECK(!flipper_http_set_baudrate(s.fhttp, 921600));
+    CHECK(s.fhttp->baudrate == BAUDRATE && s.board.rate == BAUDRATE);
+    CHECK(get(&s, "http://sim/b?lines=2", &l) != 0);
+    CHECK(log_wait(&l, 2, 3000) && l.ok[1] && strcmp(l.resp[1], "http://sim/b?lines=2") == 0);
+    sim_close(&s);
+}
+
+static void test_baud_fallback(void) {
+    printf("baud fallback\n");
+    Sim s;
+    Log l;
+    log_init(&l);
+
+    // The wiring carries 460800 but not 921600: the PING at 921600 is
+    // garbage to the board, both ends fall back and the ladder stops
+    SimBoard slow = FRAMING;
+    slow.max_rate = 460800;
+    CHECK(sim_open(&s, &slow));
+    CHECK(flipper_http_negotiate_baudrate(s.fhttp, 0) == 460800);
+    CHECK(s.board.baud_cmds == 3);
+    CHECK(s.board.garbage > 0);
+    CHECK(s.fhttp->baudrate == 460800);
+    CHECK(s.board.rate == 460800 && s.board.confirmed == 460800 && !s.board.unconfirmed);
+    CHECK(get(&s, "http://sim/a?lines=10&len=100", &l) != 0);
+    CHECK(log_wait(&l, 1, 3000) && l.ok[0] && strcmp(l.resp[0], "http://sim/a?lines=10&len=100") == 0);
+    sim_close(&s);
+}
+
+static void test_baud_remember(void) {
+    printf("baud remember\n");
+    Sim s;
+
+    // A remembered rate is tried first and caps the ladder: one [BAUD]
+    SimBoard slow = FRAMING;
+    slow.max_rate = 460800;
+    CHECK(sim_open(&s, &slow));
+    CHECK(flipper_http_negotiate_baudrate(s.fhttp, 460800) == 460800);
+    CHECK(s.board.baud_cmds == 1 && s.board.garbage == 0);
+    sim_close(&s);
+
+    CHECK(sim_open(&s, &FRAMING));
+    CHECK(flipper_http_negotiate_baudrate(s.fhttp, 230400) == 230400);
+    CHECK(s.board.baud_cmds == 1 && s.board.rate == 230400);
+    sim_close(&s);
+
+    // A remembered rate that no longer works falls back to the ladder
+    // below it
+    CHECK(sim_open(&s, &slow));
+    CHECK(flipper_http_negotiate_baudrate(s.fhttp, 921600) == 460800);
+    CHECK(s.board.baud_cmds == 3);
+    CHECK(s.board.rate == 460800 && !s.board.unconfirmed);
+    sim_close(&s);
+}
+
+static void test_baud_free(void) {
+    printf("baud free\n");
+    Sim s;
+
+    // Closing the connection leaves the board at the connect rate in
+    // text mode, still there after the board's revert window
+    CHECK(sim_open(&s, &FRAMING));
+    CHECK(flipper_http_set_baudrate(s.fhttp, 921600));
+    CHECK(flipper_http_frame_negotiate(s.fhttp));
+    flipper_http_free(s.fhttp);
+    s.fhttp = NULL;
+    usleep((BAUD_REVERT_MS + 200) * 1000);
+    CHECK(s.board.rate == BAUDRATE && s.board.confirmed == BAUDRATE && !s.board.unconfirmed);
+    CHECK(!s.board.framed);
+    sim_close(&s);
+
+    // and a new connection at BAUDRATE finds it
+    Log l;
+    log_init(&l);
+    CHECK(sim_open(&s, NULL));
+    CHECK(get(&s, "http://sim/a?lines=2", &l) != 0);
+    CHECK(log_wait(&l, 1, 3000) && l.ok[0]);
+    sim_close(&s);
+}
+
+static void group_baud(void) {
+    test_baud_set();
+    test_baud_fallback();
+    test_baud_remember();
+    test_baud_free();
+}
+
+// ============================================================
+// File iterator
+// ============================================================
+
+#define ITER_PATH "/tmp/fhttp_sim_iter.txt"
+
+// Write content to ITER_PATH, read it back line by line with a buffer of
+// buf_size and check the lines joined with '|' come out as want
+static bool iter_lines(const char* content, size_t len, size_t buf_size, const char* want) {
+    FILE* f = fopen(ITER_PATH, "wb");
+    if(!f) return false;
+    fwrite(content, 1, len, f);
+    fclose(f);
+
+    char buf[64], got[512];
+    size_t got_len = 0;
+    bool first = true, ok = true;
+    FlipperHTTPFileIter it;
+    if(buf_size > sizeof(buf) || !flipper_http_iter_open(&it, ITER_PATH, buf, buf_size)) {
+        flipper_http_iter_close(&it);
+        return false;
+    }
+    const char* line;
+    size_t n;
+    while(flipper_http_iter_next_line(&it, &line, &n)) {
+        if(strlen(line) != n || n > buf_size - 1 || got_len + n + 2 > sizeof(got)) {
+            ok = false;
+            break;
+        }
+        if(!first) got[got_len++] = '|';
+        memcpy(got + got_len, line, n);
+        got_len += n;
+        first = false;
+    }
+    ok = ok && !it.error;
+    flipper_http_iter_close(&it);
+    remove(ITER_PATH);
+    got[got_len] = '\0';
+    if(ok && strcmp(got, want) != 0) {
+        printf("  buf %zu: got \"%s\", want \"%s\"\n", buf_size, got, want);
+        ok = false;
+    }
+    return ok;
+}
+
+#define ITER(content, buf_size, want) iter_lines(content, sizeof(content) - 1, buf_size, want)
+
+static void test_iter_short(void) {
+    printf("iter short\n");
+    CHECK(ITER("one\ntwo\n", 16, "one|two"));
+    CHECK(ITER("one\r\ntwo\r\n", 16, "one|two"));
+    CHECK(ITER("a\n\nb\r\n\r\nc\n", 16, "a||b||c"));
+    // Buffer-sized lines fit whole, terminator included
+    CHECK(ITER("abc\ndef\n", 4, "abc|def"));
+    CHECK(ITER("ab\r\ncd\r\n", 4, "ab|cd"));
+}
+
+static void test_iter_long(void) {
+    printf("iter long\n");
+    CHECK(ITER("abcdefgh\nxy\n", 4, "abc|def|gh|xy"));
+    CHECK(ITER("abcdef\nxy\n", 4, "abc|def|xy"));
+    CHECK(ITER("abcdefg\r\n", 2, "a|b|c|d|e|f|g"));
+    CHECK(ITER("0123456789012345678901234567890123456789\n", 16,
+               "012345678901234|567890123456789|0123456789"));
+}
+
+static void test_iter_crlf_split(void) {
+    printf("iter crlf at the split\n");
+    CHECK(ITER("abcdef\r\nxy\r\n", 4, "abc|def|xy"));
+    CHECK(ITER("abc\r\n", 4, "abc"));
+    CHECK(ITER("abc\r\n\r\nd\r\n", 4, "abc||d"));
+    CHECK(ITER("ab\r\nc\n", 2, "a|b|c"));
+    // A '\r' inside a line stays in the next piece
+    CHECK(ITER("abc\rde\n", 4, "abc|\rde"));
+    CHECK(ITER("abc\r", 4, "abc"));
+}
+
+static void test_iter_ends(void) {
+    printf("iter ends\n");
+    CHECK(ITER("a\nlast", 16, "a|last"));
+    CHECK(ITER("abcdefg", 4, "abc|def|g"));
+    CHECK(ITER("", 16, ""));
+    CHECK(ITER("\n", 16, ""));
+    CHECK(ITER("\r\n", 16, ""));
+
+    FlipperHTTPFileIter it;
+    char buf[8];
+    remove(ITER_PATH);
+    CHECK(!flipper_http_iter_open(&it, ITER_PATH, buf, sizeof(buf)));
+    flipper_http_iter_close(&it);
+}
+
+// Random lines of letters with LF or CRLF endings at every small buffer
+// size, against pieces of buf_size - 1 cut from each line
+static void test_iter_random(void) {
+    printf("iter random\n");
+    srand(7);
+    for(int round = 0; round < 200; round++) {
+        char content[256], want[512];
+        size_t clen = 0, wlen = 0;
+        size_t buf_size = 2 + (size_t)(rand() % 8);
+        int lines = 1 + rand() % 8;
+        for(int l = 0; l < lines; l++) {
+            int n = rand() % 13;
+            if(l) want[wlen++] = '|';
+            for(int i = 0; i < n; i++) {
+                char c = (char)('a' + rand() % 26);
+                content[clen++] = c;
+                if(i && i % (int)(buf_size - 1) == 0) want[wlen++] = '|';
+                want[wlen++] = c;
+            }
+            bool last = l == lines - 1;
+            if(last && n && rand() % 3 == 0) break;   // unterminated
+            if(rand() % 2) content[clen++] = '\r';
+            content[clen++] = '\n';
+        }
+        want[wlen] = '\0';
+        CHECK(iter_lines(content, clen, buf_size, want));
+    }
+}
+
+static void group_iter(void) {
+    test_iter_short();
+    test_iter_long();
+    test_iter_crlf_split();
+    test_iter_ends();
+    test_iter_random();
+}
+
+// ============================================================
+// Main
+// ============================================================
+
+static const struct {
+    const char* name;
+    void (*run)(void);
+} GROUPS[] = {
+    { "queue", group_queue },
+    { "frame", group_frame },
+    { "baud", group_baud },
+    { "iter", group_iter },
+};
+
+int main(int argc, char** argv) {
+    const char* only = argc > 1 ? argv[1] : NULL;
+    bool ran = false;
+    for(size_t i = 0; i < sizeof(GROUPS) / sizeof(GROUPS[0]); i++) {
+        if(only && strcmp(only, GROUPS[i].name) != 0) continue;
+        printf("== %s\n", GROUPS[i].name);
+        GROUPS[i].run();
+        ran = true;
+    }
+    if(!ran) {
+        fprintf(stderr, "usage: %s [group]\n", argv[0]);
+        return 2;
+    }
+    printf("%u checks, %u failed\n", checks, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,150 @@
+// furi.h — Host stand-in for the parts of the Furi API flipper_http.c uses
+//
+// Threads, thread flags, mutexes, timers and stream buffers run on
+// pthreads; ticks are milliseconds. Only what the FlipperHTTP library
+// and the simulator need is here.
+#pragma once
+#include <ctype.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UNUSED(x) (void)(x)
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+// Logs go to stderr when FHTTP_SIM_LOG is set in the environment
+void furi_shim_log(char level, const char* tag, const char* fmt, ...);
+#define FURI_LOG_E(tag, ...) furi_shim_log('E', tag, __VA_ARGS__)
+#define FURI_LOG_I(tag, ...) furi_shim_log('I', tag, __VA_ARGS__)
+#define FURI_LOG_W(tag, ...) furi_shim_log('W', tag, __VA_ARGS__)
+#define FURI_LOG_D(tag, ...) furi_shim_log('D', tag, __VA_ARGS__)
+
+#define furi_check(x)                                                           \
+    do {                                                                        \
+        if(!(x)) {                                                              \
+            fprintf(stderr, "furi_check failed: %s:%d %s\n", __FILE__, __LINE__, #x); \
+            abort();                                                            \
+        }                                                                       \
+    } while(0)
+#define furi_assert(x) furi_check(x)
+
+#define FuriWaitForever 0xFFFFFFFFU
+
+typedef enum {
+    FuriStatusOk = 0,
+    FuriStatusError = -1,
+    FuriStatusErrorTimeout = -2,
+} FuriStatus;
+
+typedef enum {
+    FuriFlagWaitAny = 0,
+    FuriFlagWaitAll = 1,
+    FuriFlagNoClear = 2,
+    FuriFlagError = 0x80000000U,
+} FuriFlag;
+
+// Threads
+typedef struct FuriThread FuriThread;
+typedef FuriThread* FuriThreadId;
+typedef int32_t (*FuriThreadCallback)(void* context);
+
+FuriThread*  furi_thread_alloc(void);
+FuriThread*  furi_thread_alloc_ex(const char* name, uint32_t stack_size,
+                                  FuriThreadCallback callback, void* context);
+void         furi_thread_free(FuriThread* thread);
+void         furi_thread_set_name(FuriThread* thread, const char* name);
+void         furi_thread_set_stack_size(FuriThread* thread, size_t stack_size);
+void         furi_thread_set_context(FuriThread* thread, void* context);
+void         furi_thread_set_callback(FuriThread* thread, FuriThreadCallback callback);
+void         furi_thread_start(FuriThread* thread);
+bool         furi_thread_join(FuriThread* thread);
+FuriThreadId furi_thread_get_id(FuriThread* thread);
+FuriThreadId furi_thread_get_current_id(void);
+uint32_t     furi_thread_flags_set(FuriThreadId thread_id, uint32_t flags);
+uint32_t     furi_thread_flags_wait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+// Mutexes
+typedef enum {
+    FuriMutexTypeNormal,
+    FuriMutexTypeRecursive,
+} FuriMutexType;
+typedef struct FuriMutex FuriMutex;
+
+FuriMutex* furi_mutex_alloc(FuriMutexType type);
+void       furi_mutex_free(FuriMutex* mutex);
+FuriStatus furi_mutex_acquire(FuriMutex* mutex, uint32_t timeout);
+FuriStatus furi_mutex_release(FuriMutex* mutex);
+
+// Timers; each runs its callback on its own thread
+typedef enum {
+    FuriTimerTypeOnce,
+    FuriTimerTypePeriodic,
+} FuriTimerType;
+typedef enum {
+    FuriTimerThreadPriorityNormal,
+    FuriTimerThreadPriorityElevated,
+} FuriTimerThreadPriority;
+typedef struct FuriTimer FuriTimer;
+typedef void (*FuriTimerCallback)(void* context);
+
+FuriTimer* furi_timer_alloc(FuriTimerCallback callback, FuriTimerType type, void* context);
+void       furi_timer_free(FuriTimer* timer);
+FuriStatus furi_timer_start(FuriTimer* timer, uint32_t ticks);
+FuriStatus furi_timer_restart(FuriTimer* timer, uint32_t ticks);
+FuriStatus furi_timer_stop(FuriTimer* timer);
+uint32_t   furi_timer_is_running(FuriTimer* timer);
+void       furi_timer_set_thread_priority(FuriTimerThreadPriority priority);
+
+// Stream buffers; sends never block, as from an ISR
+typedef struct FuriStreamBuffer FuriStreamBuffer;
+
+FuriStreamBuffer* furi_stream_buffer_alloc(size_t size, size_t trigger_level);
+void              furi_stream_buffer_free(FuriStreamBuffer* buffer);
+size_t furi_stream_buffer_send(FuriStreamBuffer* buffer, const void* data, size_t length,
+                               uint32_t timeout);
+size_t furi_stream_buffer_receive(FuriStreamBuffer* buffer, void* data, size_t length,
+                                  uint32_t timeout);
+bool   furi_stream_buffer_is_empty(FuriStreamBuffer* buffer);
+
+// Time
+void     furi_delay_ms(uint32_t milliseconds);
+uint32_t furi_get_tick(void);
+uint32_t furi_ms_to_ticks(uint32_t milliseconds);
+
+// Records
+void* furi_record_open(const char* name);
+void  furi_record_close(const char* name);
+
+// Strings
+typedef struct FuriString FuriString;
+#define FURI_STRING_FAILURE ((size_t)-1)
+
+FuriString* furi_string_alloc(void);
+FuriString* furi_string_alloc_set_str(const char* cstr);
+void        furi_string_free(FuriString* string);
+void        furi_string_reserve(FuriString* string, size_t size);
+void        furi_string_push_back(FuriString* string, char c);
+void        furi_string_right(FuriString* string, size_t index);
+void        furi_string_set_n(FuriString* string, const FuriString* source, size_t offset,
+                              size_t length);
+size_t      furi_string_search_str(const FuriString* string, const char* needle, size_t start);
+const char* furi_string_get_cstr(const FuriString* string);
+size_t      furi_string_size(const FuriString* string);
+
+size_t memmgr_heap_get_max_free_block(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,3 @@
+// furi_hal.h — Host stand-in; the UART is all flipper_http.c needs
+#pragma once
+#include "furi_hal_serial.h"
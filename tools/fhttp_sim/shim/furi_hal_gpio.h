@@ -0,0 +1,2 @@
+// furi_hal_gpio.h — Host stand-in; flipper_http.c includes it but uses no GPIO
+#pragma once
@@ -0,0 +1,66 @@
+// furi_hal_serial.h — Host stand-in for the Flipper UART
+//
+// The UART is one end of a socketpair attached with furi_shim_serial_attach.
+// Every write is tagged with the sender's baud rate, and bytes that arrive
+// at another rate than the receiver's are garbled, as on a real line. RX
+// is paced at the current rate (10 bits a byte) and delivered a byte at a
+// time to the async callback from a thread standing in for the interrupt.
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FuriHalSerialHandle FuriHalSerialHandle;
+
+typedef enum {
+    FuriHalSerialIdUsart,
+    FuriHalSerialIdLpuart,
+} FuriHalSerialId;
+
+typedef enum {
+    FuriHalSerialDirectionTx = 1,
+    FuriHalSerialDirectionRx = 2,
+} FuriHalSerialDirection;
+
+typedef enum {
+    FuriHalSerialRxEventData = 1,
+    FuriHalSerialRxEventIdle = 2,
+} FuriHalSerialRxEvent;
+
+typedef void (*FuriHalSerialAsyncRxCallback)(FuriHalSerialHandle* handle,
+                                             FuriHalSerialRxEvent event, void* context);
+
+bool furi_hal_serial_control_is_busy(FuriHalSerialId serial_id);
+FuriHalSerialHandle* furi_hal_serial_control_acquire(FuriHalSerialId serial_id);
+void furi_hal_serial_control_release(FuriHalSerialHandle* handle);
+void furi_hal_serial_init(FuriHalSerialHandle* handle, uint32_t baud);
+void furi_hal_serial_deinit(FuriHalSerialHandle* handle);
+void furi_hal_serial_set_br(FuriHalSerialHandle* handle, uint32_t baud);
+void furi_hal_serial_enable_direction(FuriHalSerialHandle* handle,
+                                      FuriHalSerialDirection direction);
+void furi_hal_serial_disable_direction(FuriHalSerialHandle* handle,
+                                       FuriHalSerialDirection direction);
+void furi_hal_serial_async_rx_start(FuriHalSerialHandle* handle,
+                                    FuriHalSerialAsyncRxCallback callback, void* context,
+                                    bool report_errors);
+void    furi_hal_serial_async_rx_stop(FuriHalSerialHandle* handle);
+uint8_t furi_hal_serial_async_rx(FuriHalSerialHandle* handle);
+void    furi_hal_serial_tx(FuriHalSerialHandle* handle, const uint8_t* buffer, size_t size);
+void    furi_hal_serial_tx_wait_complete(FuriHalSerialHandle* handle);
+
+// Simulator side: the socket the next acquired UART talks through
+void furi_shim_serial_attach(int fd);
+
+// Both ends' wire format: u32 rate (LE), u16 length (LE), bytes
+bool furi_shim_link_write(int fd, uint32_t rate, const void* data, size_t len);
+// One chunk into buf (at least 65535 bytes). 1 for a chunk, 0 after
+// timeout_ms without one, -1 once the other end is closed.
+int furi_shim_link_read(int fd, uint32_t timeout_ms, uint32_t* rate, uint8_t* buf, size_t* len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,797 @@
+// furi_shim.c — Host implementations behind the headers in this directory
+
+#define _GNU_SOURCE
+#include "furi.h"
+#include "furi_hal.h"
+#include "storage/storage.h"
+#include "gui/view_dispatcher.h"
+#include "gui/modules/loading.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+// ============================================================
+// Time and logging
+// ============================================================
+
+static uint64_t shim_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static void shim_sleep_us(uint64_t us) {
+    struct timespec ts = { (time_t)(us / 1000000u), (long)(us % 1000000u) * 1000 };
+    while(nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+// Absolute CLOCK_MONOTONIC deadline timeout_ms from now, for timed waits
+static struct timespec shim_deadline(uint32_t timeout_ms) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_sec += timeout_ms / 1000;
+    ts.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+    if(ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+    return ts;
+}
+
+static void shim_cond_init(pthread_cond_t* cv) {
+    pthread_condattr_t a;
+    pthread_condattr_init(&a);
+    pthread_condattr_setclock(&a, CLOCK_MONOTONIC);
+    pthread_cond_init(cv, &a);
+    pthread_condattr_destroy(&a);
+}
+
+void furi_delay_ms(uint32_t milliseconds) {
+    shim_sleep_us((uint64_t)milliseconds * 1000u);
+}
+
+uint32_t furi_get_tick(void) {
+    return (uint32_t)(shim_now_us() / 1000u);
+}
+
+uint32_t furi_ms_to_ticks(uint32_t milliseconds) {
+    return milliseconds;
+}
+
+void furi_shim_log(char level, const char* tag, const char* fmt, ...) {
+    static int enabled = -1;
+    if(enabled < 0) enabled = getenv("FHTTP_SIM_LOG") != NULL;
+    if(!enabled) return;
+    va_list ap;
+    va_start(ap, fmt);
+    fprintf(stderr, "%lu [%c][%s] ", (unsigned long)furi_get_tick(), level, tag);
+    vfprintf(stderr, fmt, ap);
+    fputc('\n', stderr);
+    va_end(ap);
+}
+
+// ============================================================
+// Threads and flags
+// ============================================================
+
+struct FuriThread {
+    pthread_t          tid;
+    bool               started;
+    FuriThreadCallback callback;
+    void*              context;
+    pthread_mutex_t    mx;
+    pthread_cond_t     cv;
+    uint32_t           flags;
+};
+
+static __thread FuriThread* shim_self;
+
+static void shim_thread_init(FuriThread* t) {
+    memset(t, 0, sizeof(*t));
+    pthread_mutex_init(&t->mx, NULL);
+    shim_cond_init(&t->cv);
+}
+
+static void* shim_thread_main(void* arg) {
+    FuriThread* t = arg;
+    shim_self = t;
+    t->callback(t->context);
+    return NULL;
+}
+
+FuriThread* furi_thread_alloc(void) {
+    FuriThread* t = malloc(sizeof(FuriThread));
+    if(t) shim_thread_init(t);
+    return t;
+}
+
+FuriThread* furi_thread_alloc_ex(const char* name, uint32_t stack_size,
+                                 FuriThreadCallback callback, void* context) {
+    UNUSED(name);
+    UNUSED(stack_size);
+    FuriThread* t = furi_thread_alloc();
+    if(!t) return NULL;
+    t->callback = callback;
+    t->context  = context;
+    return t;
+}
+
+void furi_thread_free(FuriThread* thread) {
+    pthread_mutex_destroy(&thread->mx);
+    pthread_cond_destroy(&thread->cv);
+    free(thread);
+}
+
+void furi_thread_set_name(FuriThread* thread, const char* name) {
+    UNUSED(thread);
+    UNUSED(name);
+}
+
+void furi_thread_set_stack_size(FuriThread* thread, size_t stack_size) {
+    UNUSED(thread);
+    UNUSED(stack_size);
+}
+
+void furi_thread_set_context(FuriThread* thread, void* context) {
+    thread->context = context;
+}
+
+void furi_thread_set_callback(FuriThread* thread, FuriThreadCallback callback) {
+    thread->callback = callback;
+}
+
+void furi_thread_start(FuriThread* thread) {
+    thread->started = pthread_create(&thread->tid, NULL, shim_thread_main, thread) == 0;
+    furi_check(thread->started);
+}
+
+bool furi_thread_join(FuriThread* thread) {
+    if(thread->started) pthread_join(thread->tid, NULL);
+    thread->started = false;
+    return true;
+}
+
+FuriThreadId furi_thread_get_id(FuriThread* thread) {
+    return thread;
+}
+
+// Threads the shim didn't start (main, the simulator's) get a record on
+// first use so they can wait for flags too
+FuriThreadId furi_thread_get_current_id(void) {
+    if(!shim_self) {
+        shim_self = malloc(sizeof(FuriThread));
+        furi_check(shim_self);
+        shim_thread_init(shim_self);
+    }
+    return shim_self;
+}
+
+uint32_t furi_thread_flags_set(FuriThreadId thread_id, uint32_t flags) {
+    pthread_mutex_lock(&thread_id->mx);
+    thread_id->flags |= flags;
+    uint32_t now = thread_id->flags;
+    pthread_cond_broadcast(&thread_id->cv);
+    pthread_mutex_unlock(&thread_id->mx);
+    return now;
+}
+
+uint32_t furi_thread_flags_wait(uint32_t flags, uint32_t options, uint32_t timeout) {
+    FuriThread* t = furi_thread_get_current_id();
+    struct timespec until = shim_deadline(timeout == FuriWaitForever ? 0 : timeout);
+    pthread_mutex_lock(&t->mx);
+    for(;;) {
+        uint32_t got = t->flags & flags;
+        bool done = (options & FuriFlagWaitAll) ? got == flags : got != 0;
+        if(done) {
+            if(!(options & FuriFlagNoClear)) t->flags &= ~got;
+            pthread_mutex_unlock(&t->mx);
+            return got;
+        }
+        if(timeout == FuriWaitForever) {
+            pthread_cond_wait(&t->cv, &t->mx);
+        } else if(pthread_cond_timedwait(&t->cv, &t->mx, &until) == ETIMEDOUT) {
+            pthread_mutex_unlock(&t->mx);
+            return (uint32_t)FuriFlagError | 2u;
+        }
+    }
+}
+
+// ============================================================
+// Mutexes
+// ============================================================
+
+struct FuriMutex {
+    pthread_mutex_t mx;
+};
+
+FuriMutex* furi_mutex_alloc(FuriMutexType type) {
+    FuriMutex* m = malloc(sizeof(FuriMutex));
+    if(!m) return NULL;
+    pthread_mutexattr_t a;
+    pthread_mutexattr_init(&a);
+    pthread_mutexattr_settype(&a, type == FuriMutexTypeRecursive ? PTHREAD_MUTEX_RECURSIVE :
+                                                                   PTHREAD_MUTEX_ERRORCHECK);
+    pthread_mutex_init(&m->mx, &a);
+    pthread_mutexattr_destroy(&a);
+    return m;
+}
+
+void furi_mutex_free(FuriMutex* mutex) {
+    pthread_mutex_destroy(&mutex->mx);
+    free(mutex);
+}
+
+FuriStatus furi_mutex_acquire(FuriMutex* mutex, uint32_t timeout) {
+    furi_check(timeout == FuriWaitForever);
+    // A normal mutex taken twice by one thread deadlocks on the device
+    furi_check(pthread_mutex_lock(&mutex->mx) == 0);
+    return FuriStatusOk;
+}
+
+FuriStatus furi_mutex_release(FuriMutex* mutex) {
+    furi_check(pthread_mutex_unlock(&mutex->mx) == 0);
+    return FuriStatusOk;
+}
+
+// ============================================================
+// Timers
+// ============================================================
+
+struct FuriTimer {
+    pthread_t         tid;
+    pthread_mutex_t   mx;
+    pthread_cond_t    cv;
+    FuriTimerCallback callback;
+    void*             context;
+    FuriTimerType     type;
+    uint32_t          period;
+    uint64_t          deadline_us;
+    bool              running;
+    bool              quit;
+};
+
+static void* shim_timer_main(void* arg) {
+    FuriTimer* t = arg;
+    pthread_mutex_lock(&t->mx);
+    while(!t->quit) {
+        if(!t->running) {
+            pthread_cond_wait(&t->cv, &t->mx);
+            continue;
+        }
+        uint64_t now = shim_now_us();
+        if(now < t->deadline_us) {
+            struct timespec until = shim_deadline((uint32_t)((t->deadline_us - now + 999) / 1000));
+            pthread_cond_timedwait(&t->cv, &t->mx, &until);
+            continue;
+        }
+        if(t->type == FuriTimerTypeOnce)
+            t->running = false;
+        else
+            t->deadline_us += (uint64_t)t->period * 1000u;
+        pthread_mutex_unlock(&t->mx);
+        t->callback(t->context);
+        pthread_mutex_lock(&t->mx);
+    }
+    pthread_mutex_unlock(&t->mx);
+    return NULL;
+}
+
+FuriTimer* furi_timer_alloc(FuriTimerCallback callback, FuriTimerType type, void* context) {
+    FuriTimer* t = calloc(1, sizeof(FuriTimer));
+    if(!t) return NULL;
+    t->callback = callback;
+    t->context  = context;
+    t->type     = type;
+    pthread_mutex_init(&t->mx, NULL);
+    shim_cond_init(&t->cv);
+    if(pthread_create(&t->tid, NULL, shim_timer_main, t) != 0) {
+        free(t);
+        return NULL;
+    }
+    return t;
+}
+
+void furi_timer_free(FuriTimer* timer) {
+    pthread_mutex_lock(&timer->mx);
+    timer->quit = true;
+    pthread_cond_signal(&timer->cv);
+    pthread_mutex_unlock(&timer->mx);
+    pthread_join(timer->tid, NULL);
+    pthread_mutex_destroy(&timer->mx);
+    pthread_cond_destroy(&timer->cv);
+    free(timer);
+}
+
+FuriStatus furi_timer_start(FuriTimer* timer, uint32_t ticks) {
+    pthread_mutex_lock(&timer->mx);
+    timer->period      = ticks;
+    timer->deadline_us = shim_now_us() + (uint64_t)ticks * 1000u;
+    timer->running     = true;
+    pthread_cond_signal(&timer->cv);
+    pthread_mutex_unlock(&timer->mx);
+    return FuriStatusOk;
+}
+
+FuriStatus furi_timer_restart(FuriTimer* timer, uint32_t ticks) {
+    return furi_timer_start(timer, ticks);
+}
+
+FuriStatus furi_timer_stop(FuriTimer* timer) {
+    pthread_mutex_lock(&timer->mx);
+    timer->running = false;
+    pthread_cond_signal(&timer->cv);
+    pthread_mutex_unlock(&timer->mx);
+    return FuriStatusOk;
+}
+
+uint32_t furi_timer_is_running(FuriTimer* timer) {
+    pthread_mutex_lock(&timer->mx);
+    uint32_t r = timer->running;
+    pthread_mutex_unlock(&timer->mx);
+    return r;
+}
+
+void furi_timer_set_thread_priority(FuriTimerThreadPriority priority) {
+    UNUSED(priority);
+}
+
+// ============================================================
+// Stream buffers
+// ============================================================
+
+struct FuriStreamBuffer {
+    pthread_mutex_t mx;
+    pthread_cond_t  cv;
+    uint8_t*        data;
+    size_t          size;
+    size_t          head;
+    size_t          count;
+};
+
+FuriStreamBuffer* furi_stream_buffer_alloc(size_t size, size_t trigger_level) {
+    UNUSED(trigger_level);
+    FuriStreamBuffer* b = calloc(1, sizeof(FuriStreamBuffer));
+    if(!b) return NULL;
+    b->data = malloc(size);
+    if(!b->data) {
+        free(b);
+        return NULL;
+    }
+    b->size = size;
+    pthread_mutex_init(&b->mx, NULL);
+    shim_cond_init(&b->cv);
+    return b;
+}
+
+void furi_stream_buffer_free(FuriStreamBuffer* buffer) {
+    pthread_mutex_destroy(&buffer->mx);
+    pthread_cond_destroy(&buffer->cv);
+    free(buffer->data);
+    free(buffer);
+}
+
+// What doesn't fit is dropped, as an ISR would with timeout 0
+size_t furi_stream_buffer_send(FuriStreamBuffer* buffer, const void* data, size_t length,
+                               uint32_t timeout) {
+    UNUSED(timeout);
+    pthread_mutex_lock(&buffer->mx);
+    size_t n = 0;
+    while(n < length && buffer->count < buffer->size) {
+        buffer->data[(buffer->head + buffer->count) % buffer->size] = ((const uint8_t*)data)[n++];
+        buffer->count++;
+    }
+    pthread_cond_broadcast(&buffer->cv);
+    pthread_mutex_unlock(&buffer->mx);
+    return n;
+}
+
+size_t furi_stream_buffer_receive(FuriStreamBuffer* buffer, void* data, size_t length,
+                                  uint32_t timeout) {
+    struct timespec until = shim_deadline(timeout == FuriWaitForever ? 0 : timeout);
+    pthread_mutex_lock(&buffer->mx);
+    while(!buffer->count && timeout) {
+        if(timeout == FuriWaitForever)
+            pthread_cond_wait(&buffer->cv, &buffer->mx);
+        else if(pthread_cond_timedwait(&buffer->cv, &buffer->mx, &until) == ETIMEDOUT)
+            break;
+    }
+    size_t n = 0;
+    while(n < length && buffer->count) {
+        ((uint8_t*)data)[n++] = buffer->data[buffer->head];
+        buffer->head = (buffer->head + 1) % buffer->size;
+        buffer->count--;
+    }
+    pthread_mutex_unlock(&buffer->mx);
+    return n;
+}
+
+bool furi_stream_buffer_is_empty(FuriStreamBuffer* buffer) {
+    pthread_mutex_lock(&buffer->mx);
+    bool empty = buffer->count == 0;
+    pthread_mutex_unlock(&buffer->mx);
+    return empty;
+}
+
+// ============================================================
+// Records and memory
+// ============================================================
+
+static char shim_record;
+
+void* furi_record_open(const char* name) {
+    UNUSED(name);
+    return &shim_record;
+}
+
+void furi_record_close(const char* name) {
+    UNUSED(name);
+}
+
+size_t memmgr_heap_get_max_free_block(void) {
+    return (size_t)1 << 30;
+}
+
+// ============================================================
+// Strings
+// ============================================================
+
+struct FuriString {
+    char*  s;
+    size_t len;
+    size_t cap;
+};
+
+static void shim_string_grow(FuriString* string, size_t need) {
+    if(need + 1 <= string->cap) return;
+    size_t cap = string->cap ? string->cap : 16;
+    while(cap < need + 1) cap *= 2;
+    string->s = realloc(string->s, cap);
+    furi_check(string->s);
+    string->cap = cap;
+}
+
+FuriString* furi_string_alloc(void) {
+    FuriString* string = calloc(1, sizeof(FuriString));
+    furi_check(string);
+    shim_string_grow(string, 0);
+    string->s[0] = '\0';
+    return string;
+}
+
+FuriString* furi_string_alloc_set_str(const char* cstr) {
+    FuriString* string = furi_string_alloc();
+    size_t n = strlen(cstr);
+    shim_string_grow(string, n);
+    memcpy(string->s, cstr, n + 1);
+    string->len = n;
+    return string;
+}
+
+void furi_string_free(FuriString* string) {
+    free(string->s);
+    free(string);
+}
+
+void furi_string_reserve(FuriString* string, size_t size) {
+    shim_string_grow(string, size);
+}
+
+void furi_string_push_back(FuriString* string, char c) {
+    shim_string_grow(string, string->len + 1);
+    string->s[string->len++] = c;
+    string->s[string->len]   = '\0';
+}
+
+void furi_string_right(FuriString* string, size_t index) {
+    if(index >= string->len) index = string->len;
+    memmove(string->s, string->s + index, string->len - index + 1);
+    string->len -= index;
+}
+
+void furi_string_set_n(FuriString* string, const FuriString* source, size_t offset,
+                       size_t length) {
+    if(offset > source->len) offset = source->len;
+    if(length > source->len - offset) length = source->len - offset;
+    // source may be string itself
+    char* tmp = malloc(length + 1);
+    furi_check(tmp);
+    memcpy(tmp, source->s + offset, length);
+    shim_string_grow(string, length);
+    memcpy(string->s, tmp, length);
+    string->s[length] = '\0';
+    string->len       = length;
+    free(tmp);
+}
+
+size_t furi_string_search_str(const FuriString* string, const char* needle, size_t start) {
+    if(start > string->len) return FURI_STRING_FAILURE;
+    const char* p = strstr(string->s + start, needle);
+    return p ? (size_t)(p - string->s) : FURI_STRING_FAILURE;
+}
+
+const char* furi_string_get_cstr(const FuriString* string) {
+    return string->s;
+}
+
+size_t furi_string_size(const FuriString* string) {
+    return string->len;
+}
+
+// ============================================================
+// Storage
+// ============================================================
+
+struct File {
+    FILE*    f;
+    FS_Error error;
+};
+
+File* storage_file_alloc(Storage* storage) {
+    UNUSED(storage);
+    File* file = calloc(1, sizeof(File));
+    furi_check(file);
+    return file;
+}
+
+void storage_file_free(File* file) {
+    if(file->f) fclose(file->f);
+    free(file);
+}
+
+bool storage_file_open(File* file, const char* path, FS_AccessMode access_mode,
+                       FS_OpenMode open_mode) {
+    const char* mode = "rb";
+    if(access_mode == FSAM_WRITE) mode = open_mode == FSOM_OPEN_APPEND ? "ab" : "wb";
+    file->f     = fopen(path, mode);
+    file->error = file->f ? FSE_OK : FSE_NOT_EXIST;
+    return file->f != NULL;
+}
+
+bool storage_file_close(File* file) {
+    bool ok = !file->f || fclose(file->f) == 0;
+    file->f = NULL;
+    return ok;
+}
+
+size_t storage_file_read(File* file, void* buff, size_t bytes_to_read) {
+    size_t n = fread(buff, 1, bytes_to_read, file->f);
+    file->error = ferror(file->f) ? FSE_INTERNAL : FSE_OK;
+    return n;
+}
+
+size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write) {
+    size_t n = fwrite(buff, 1, bytes_to_write, file->f);
+    file->error = n == bytes_to_write ? FSE_OK : FSE_INTERNAL;
+    return n;
+}
+
+uint64_t storage_file_size(File* file) {
+    struct stat st;
+    return fstat(fileno(file->f), &st) == 0 ? (uint64_t)st.st_size : 0;
+}
+
+FS_Error storage_file_get_error(File* file) {
+    return file->error;
+}
+
+bool storage_file_exists(Storage* storage, const char* path) {
+    UNUSED(storage);
+    return access(path, F_OK) == 0;
+}
+
+bool storage_simply_remove_recursive(Storage* storage, const char* path) {
+    UNUSED(storage);
+    return remove(path) == 0 || errno == ENOENT;
+}
+
+// ============================================================
+// GUI (unused by the simulator)
+// ============================================================
+
+void view_dispatcher_add_view(ViewDispatcher* view_dispatcher, uint32_t view_id, View* view) {
+    UNUSED(view_dispatcher);
+    UNUSED(view_id);
+    UNUSED(view);
+}
+
+void view_dispatcher_remove_view(ViewDispatcher* view_dispatcher, uint32_t view_id) {
+    UNUSED(view_dispatcher);
+    UNUSED(view_id);
+}
+
+void view_dispatcher_switch_to_view(ViewDispatcher* view_dispatcher, uint32_t view_id) {
+    UNUSED(view_dispatcher);
+    UNUSED(view_id);
+}
+
+Loading* loading_alloc(void) {
+    return (Loading*)&shim_record;
+}
+
+void loading_free(Loading* instance) {
+    UNUSED(instance);
+}
+
+View* loading_get_view(Loading* instance) {
+    UNUSED(instance);
+    return NULL;
+}
+
+// ============================================================
+// UART
+// ============================================================
+
+struct FuriHalSerialHandle {
+    int                          fd;
+    bool                         acquired;
+    volatile uint32_t            rate;
+    pthread_t                    rx_tid;
+    volatile bool                rx_run;
+    FuriHalSerialAsyncRxCallback callback;
+    void*                        context;
+    uint8_t                      rx_byte;
+    pthread_mutex_t              tx_mx;
+};
+
+static FuriHalSerialHandle shim_uart = { .fd = -1, .tx_mx = PTHREAD_MUTEX_INITIALIZER };
+static int shim_uart_fd = -1;
+
+void furi_shim_serial_attach(int fd) {
+    shim_uart_fd = fd;
+}
+
+static bool shim_read_all(int fd, void* buf, size_t len) {
+    uint8_t* p = buf;
+    while(len) {
+        ssize_t n = read(fd, p, len);
+        if(n < 0 && errno == EINTR) continue;
+        if(n <= 0) return false;
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+bool furi_shim_link_write(int fd, uint32_t rate, const void* data, size_t len) {
+    const uint8_t* p = data;
+    while(len) {
+        size_t n = len > 0xFFFF ? 0xFFFF : len;
+        uint8_t chunk[6 + 0xFFFF];
+        chunk[0] = (uint8_t)rate;
+        chunk[1] = (uint8_t)(rate >> 8);
+        chunk[2] = (uint8_t)(rate >> 16);
+        chunk[3] = (uint8_t)(rate >> 24);
+        chunk[4] = (uint8_t)n;
+        chunk[5] = (uint8_t)(n >> 8);
+        memcpy(chunk + 6, p, n);
+        size_t off = 0;
+        while(off < 6 + n) {
+            ssize_t w = write(fd, chunk + off, 6 + n - off);
+            if(w < 0 && errno == EINTR) continue;
+            if(w <= 0) return false;
+            off += (size_t)w;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+int furi_shim_link_read(int fd, uint32_t timeout_ms, uint32_t* rate, uint8_t* buf, size_t* len) {
+    *len = 0;
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    int r = poll(&pfd, 1, (int)timeout_ms);
+    if(r == 0 || (r < 0 && errno == EINTR)) return 0;
+    uint8_t hdr[6];
+    if(r < 0 || !shim_read_all(fd, hdr, sizeof(hdr))) return -1;
+    *rate = (uint32_t)hdr[0] | (uint32_t)hdr[1] << 8 | (uint32_t)hdr[2] << 16 |
+            (uint32_t)hdr[3] << 24;
+    *len = (size_t)hdr[4] | (size_t)hdr[5] << 8;
+    return shim_read_all(fd, buf, *len) ? 1 : -1;
+}
+
+// Stands in for the UART interrupt: bytes come in at the line rate, and
+// bytes sent at another rate arrive as garbage
+static void* shim_uart_rx_main(void* arg) {
+    FuriHalSerialHandle* h = arg;
+    static uint8_t buf[0x10000];
+    uint64_t wire_free = shim_now_us();
+    while(h->rx_run) {
+        uint32_t rate;
+        size_t len;
+        int r = furi_shim_link_read(h->fd, 20, &rate, buf, &len);
+        if(r < 0) break;
+        if(r == 0) continue;
+        uint32_t own = h->rate;
+        uint64_t now = shim_now_us();
+        if(wire_free < now) wire_free = now;
+        for(size_t i = 0; i < len && h->rx_run; i += 64) {
+            size_t n = len - i < 64 ? len - i : 64;
+            wire_free += (uint64_t)n * 10u * 1000000u / own;
+            now = shim_now_us();
+            if(wire_free > now) shim_sleep_us(wire_free - now);
+            for(size_t k = 0; k < n; k++) {
+                h->rx_byte = rate == own ? buf[i + k] : (uint8_t)~buf[i + k];
+                h->callback(h, FuriHalSerialRxEventData, h->context);
+            }
+        }
+    }
+    return NULL;
+}
+
+bool furi_hal_serial_control_is_busy(FuriHalSerialId serial_id) {
+    UNUSED(serial_id);
+    return shim_uart.acquired;
+}
+
+FuriHalSerialHandle* furi_hal_serial_control_acquire(FuriHalSerialId serial_id) {
+    UNUSED(serial_id);
+    if(shim_uart.acquired || shim_uart_fd < 0) return NULL;
+    shim_uart.acquired = true;
+    shim_uart.fd       = shim_uart_fd;
+    return &shim_uart;
+}
+
+void furi_hal_serial_control_release(FuriHalSerialHandle* handle) {
+    handle->acquired = false;
+}
+
+void furi_hal_serial_init(FuriHalSerialHandle* handle, uint32_t baud) {
+    handle->rate = baud;
+}
+
+void furi_hal_serial_deinit(FuriHalSerialHandle* handle) {
+    UNUSED(handle);
+}
+
+void furi_hal_serial_set_br(FuriHalSerialHandle* handle, uint32_t baud) {
+    handle->rate = baud;
+}
+
+void furi_hal_serial_enable_direction(FuriHalSerialHandle* handle,
+                                      FuriHalSerialDirection direction) {
+    UNUSED(handle);
+    UNUSED(direction);
+}
+
+void furi_hal_serial_disable_direction(FuriHalSerialHandle* handle,
+                                       FuriHalSerialDirection direction) {
+    UNUSED(handle);
+    UNUSED(direction);
+}
+
+void furi_hal_serial_async_rx_start(FuriHalSerialHandle* handle,
+                                    FuriHalSerialAsyncRxCallback callback, void* context,
+                                    bool report_errors) {
+    UNUSED(report_errors);
+    handle->callback = callback;
+    handle->context  = context;
+    handle->rx_run   = true;
+    furi_check(pthread_create(&handle->rx_tid, NULL, shim_uart_rx_main, handle) == 0);
+}
+
+void furi_hal_serial_async_rx_stop(FuriHalSerialHandle* handle) {
+    if(!handle->rx_run) return;
+    handle->rx_run = false;
+    pthread_join(handle->rx_tid, NULL);
+}
+
+uint8_t furi_hal_serial_async_rx(FuriHalSerialHandle* handle) {
+    return handle->rx_byte;
+}
+
+void furi_hal_serial_tx(FuriHalSerialHandle* handle, const uint8_t* buffer, size_t size) {
+    pthread_mutex_lock(&handle->tx_mx);
+    furi_shim_link_write(handle->fd, handle->rate, buffer, size);
+    pthread_mutex_unlock(&handle->tx_mx);
+}
+
+void furi_hal_serial_tx_wait_complete(FuriHalSerialHandle* handle) {
+    UNUSED(handle);
+}
@@ -0,0 +1,2 @@
+// gui.h — Host stand-in; flipper_http.c includes it but draws nothing
+#pragma once
@@ -0,0 +1,9 @@
+// loading.h — Host stand-in; the calls do nothing
+#pragma once
+#include "../view.h"
+
+typedef struct Loading Loading;
+
+Loading* loading_alloc(void);
+void     loading_free(Loading* instance);
+View*    loading_get_view(Loading* instance);
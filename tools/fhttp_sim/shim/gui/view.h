@@ -0,0 +1,4 @@
+// view.h — Host stand-in
+#pragma once
+
+typedef struct View View;
@@ -0,0 +1,10 @@
+// view_dispatcher.h — Host stand-in; the calls do nothing
+#pragma once
+#include <stdint.h>
+#include "view.h"
+
+typedef struct ViewDispatcher ViewDispatcher;
+
+void view_dispatcher_add_view(ViewDispatcher* view_dispatcher, uint32_t view_id, View* view);
+void view_dispatcher_remove_view(ViewDispatcher* view_dispatcher, uint32_t view_id);
+void view_dispatcher_switch_to_view(ViewDispatcher* view_dispatcher, uint32_t view_id);
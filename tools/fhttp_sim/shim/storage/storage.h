@@ -0,0 +1,49 @@
+// storage.h — Host stand-in for the Flipper storage API on stdio
+//
+// Paths are host paths; only the calls flipper_http.c makes are here.
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RECORD_STORAGE "storage"
+
+typedef struct Storage Storage;
+typedef struct File    File;
+
+typedef enum {
+    FSAM_READ = 1,
+    FSAM_WRITE = 2,
+} FS_AccessMode;
+
+typedef enum {
+    FSOM_OPEN_EXISTING = 1,
+    FSOM_OPEN_APPEND = 4,
+    FSOM_CREATE_ALWAYS = 16,
+} FS_OpenMode;
+
+typedef enum {
+    FSE_OK,
+    FSE_NOT_EXIST,
+    FSE_INTERNAL,
+} FS_Error;
+
+File*    storage_file_alloc(Storage* storage);
+void     storage_file_free(File* file);
+bool     storage_file_open(File* file, const char* path, FS_AccessMode access_mode,
+                           FS_OpenMode open_mode);
+bool     storage_file_close(File* file);
+size_t   storage_file_read(File* file, void* buff, size_t bytes_to_read);
+size_t   storage_file_write(File* file, const void* buff, size_t bytes_to_write);
+uint64_t storage_file_size(File* file);
+FS_Error storage_file_get_error(File* file);
+bool     storage_file_exists(Storage* storage, const char* path);
+bool     storage_simply_remove_recursive(Storage* storage, const char* path);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+# gen_meta.py — Generate meta/bible_meta.h and meta/bible_meta.c from meta/books.txt
+#
+# Run by fap_extbuild before every app build; also by hand:
+#   python3 tools/gen_meta.py meta/books.txt meta
+#
+# Every name (all languages and aliases) goes into one NUL-separated
+# pool addressed by u16 offsets, with duplicates shared. Verse counts
+# and chapter ordinals are flat per-chapter arrays indexed through
+# BIBLE_CHAPTER_START. Outputs are only rewritten when they change.
+
+import os
+import sys
+
+
+def fail(path, lineno, msg):
+    sys.exit("%s:%d: %s" % (path, lineno, msg))
+
+
+def parse(path):
+    langs, books = None, []
+    with open(path, encoding="utf-8") as f:
+        for lineno, raw in enumerate(f, 1):
+            line = raw.rstrip("\r\n")
+            if not line.strip() or line.startswith("#"):
+                continue
+            cols = line.split("|")
+            if cols[0] == "langs":
+                langs = cols[1:]
+                if not langs or any(not c.isalpha() or len(c) > 3 for c in langs):
+                    fail(path, lineno, "language codes are 1-3 letters")
+                continue
+            if langs is None:
+                fail(path, lineno, "book line before the langs line")
+            if len(cols) != len(langs) + 2:
+                fail(path, lineno, "expected %d columns" % (len(langs) + 2))
+            names = cols[: len(langs)]
+            aliases = [a.strip() for a in cols[len(langs)].split(",") if a.strip()]
+            try:
+                verses = [int(v) for v in cols[-1].split()]
+            except ValueError:
+                fail(path, lineno, "verse counts must be numbers")
+            if not verses or any(not 0 < v < 256 for v in verses):
+                fail(path, lineno, "verse counts are 1..255 per chapter")
+            if len(verses) > 255 or any(not n for n in names):
+                fail(path, lineno, "too many chapters or an empty name")
+            books.append((names, aliases, verses))
+    if not books or len(books) > 254:
+        sys.exit("%s: 1..254 books expected" % path)
+    return langs, books
+
+
+class Pool:
+    def __init__(self):
+        self.data = bytearray()
+        self.offsets = {}
+
+    def add(self, s):
+        if s not in self.offsets:
+            self.offsets[s] = len(self.data)
+            self.data += s.encode("utf-8") + b"\0"
+        return self.offsets[s]
+
+
+def c_string(data, indent):
+    # Split at every NUL so each name is one line; \ooo keeps the bytes exact
+    lines, cur = [], ""
+    for b in data:
+        if b == 0:
+            lines.append(cur + "\\0")
+            cur = ""
+        elif b in (0x22, 0x5C):
+            cur += "\\" + chr(b)
+        elif 0x20 <= b < 0x7F:
+            cur += chr(b)
+        else:
+            cur += "\\%03o" % b
+    return "\n".join('%s"%s"' % (indent, l) for l in lines)
+
+
+def rows(values, per_row, indent):
+    out = []
+    for i in range(0, len(values), per_row):
+        out.append(indent + ", ".join(str(v) for v in values[i : i + per_row]) + ",")
+    return "\n".join(out)
+
+
+def generate(langs, books, src):
+    pool = Pool()
+    names = [[pool.add(b[0][li]) for b in books] for li in range(len(langs))]
+    alias_off, alias_book = [], []
+    for bi, b in enumerate(books):
+        for a in b[1]:
+            alias_off.append(pool.add(a))
+            alias_book.append(bi)
+    if len(pool.data) > 0xFFFF:
+        sys.exit("name pool exceeds 64 KB")
+
+    chapters = [len(b[2]) for b in books]
+    start, counts, ordinal = [], [], []
+    total = 0
+    for b in books:
+        start.append(len(counts))
+        for v in b[2]:
+            counts.append(v)
+            ordinal.append(total)
+            total += v
+    start.append(len(counts))
+    ordinal.append(total)
+    if total > 0xFFFF:
+        sys.exit("verse ordinals exceed u16")
+
+    head = (
+        "// %s — Bible book metadata tables\n"
+        "// Generated by tools/gen_meta.py from %s; do not edit.\n"
+    )
+    lang_enum = "\n".join(
+        "    BibleLang%s,%s" % (c.capitalize(), "   // first column: the names the app shows" if i == 0 else "")
+        for i, c in enumerate(langs)
+    )
+
+    h = head % ("bible_meta.h", src) + """// Pure C (no Furi dependencies) so it can be shared with host tools.
+//
+// Names are offsets into one NUL-separated pool. Chapter tables are flat,
+// and BIBLE_CHAPTER_START gives each book's first chapter. Verse ordinals
+// count from Genesis 1:1 = 0, so ordinal math is two lookups.
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BIBLE_BOOKS_COUNT    %d
+#define BIBLE_CHAPTERS_COUNT %d
+#define BIBLE_VERSES_COUNT   %d
+#define BIBLE_LANG_COUNT     %d
+#define BIBLE_ALIAS_COUNT    %d
+
+typedef enum {
+%s
+} BibleLang;
+
+extern const char     BIBLE_NAME_POOL[];
+extern const char     BIBLE_LANG_CODES[BIBLE_LANG_COUNT][4];
+extern const uint16_t BIBLE_BOOK_NAME[BIBLE_LANG_COUNT][BIBLE_BOOKS_COUNT];
+extern const uint16_t BIBLE_ALIAS_NAME[BIBLE_ALIAS_COUNT];
+extern const uint8_t  BIBLE_ALIAS_BOOK[BIBLE_ALIAS_COUNT];
+extern const uint8_t  BIBLE_BOOK_CHAPTERS[BIBLE_BOOKS_COUNT];
+extern const uint16_t BIBLE_CHAPTER_START[BIBLE_BOOKS_COUNT + 1];
+extern const uint8_t  BIBLE_VERSE_COUNTS[BIBLE_CHAPTERS_COUNT];
+extern const uint16_t BIBLE_CHAPTER_ORDINAL[BIBLE_CHAPTERS_COUNT + 1];
+
+// Callers check book < BIBLE_BOOKS_COUNT and 1 <= chapter <= its count
+
+static inline const char* bible_meta_name(BibleLang lang, uint8_t book) {
+    return BIBLE_NAME_POOL + BIBLE_BOOK_NAME[lang][book];
+}
+
+static inline uint8_t bible_chapter_verses(uint8_t book, uint8_t chapter) {
+    return BIBLE_VERSE_COUNTS[BIBLE_CHAPTER_START[book] + chapter - 1];
+}
+
+// 0-based position of book chapter:verse in the whole Bible
+static inline uint16_t bible_verse_ordinal(uint8_t book, uint8_t chapter, uint8_t verse) {
+    return (uint16_t)(BIBLE_CHAPTER_ORDINAL[BIBLE_CHAPTER_START[book] + chapter - 1] + verse - 1);
+}
+
+#ifdef __cplusplus
+}
+#endif
+""" % (len(books), len(counts), total, len(langs), len(alias_off), lang_enum)
+
+    # An empty alias list still needs a definable array
+    alias_off_c = rows(alias_off, 12, "    ") if alias_off else "    0,"
+    alias_book_c = rows(alias_book, 12, "    ") if alias_book else "    0,"
+    alias_dim = "BIBLE_ALIAS_COUNT" if alias_off else "1"
+    if not alias_off:
+        h = h.replace("BIBLE_ALIAS_NAME[BIBLE_ALIAS_COUNT]", "BIBLE_ALIAS_NAME[1]")
+        h = h.replace("BIBLE_ALIAS_BOOK[BIBLE_ALIAS_COUNT]", "BIBLE_ALIAS_BOOK[1]")
+
+    c = head % ("bible_meta.c", src) + """
+#include "bible_meta.h"
+
+const char BIBLE_NAME_POOL[] =
+%s;
+
+const char BIBLE_LANG_CODES[BIBLE_LANG_COUNT][4] = { %s };
+
+const uint16_t BIBLE_BOOK_NAME[BIBLE_LANG_COUNT][BIBLE_BOOKS_COUNT] = {
+%s
+};
+
+const uint16_t BIBLE_ALIAS_NAME[%s] = {
+%s
+};
+
+const uint8_t BIBLE_ALIAS_BOOK[%s] = {
+%s
+};
+
+const uint8_t BIBLE_BOOK_CHAPTERS[BIBLE_BOOKS_COUNT] = {
+%s
+};
+
+const uint16_t BIBLE_CHAPTER_START[BIBLE_BOOKS_COUNT + 1] = {
+%s
+};
+
+const uint8_t BIBLE_VERSE_COUNTS[BIBLE_CHAPTERS_COUNT] = {
+%s
+};
+
+const uint16_t BIBLE_CHAPTER_ORDINAL[BIBLE_CHAPTERS_COUNT + 1] = {
+%s
+};
+""" % (
+        c_string(pool.data, "    "),
+        ", ".join('"%s"' % l for l in langs),
+        "\n".join("    {\n%s\n    }," % rows(n, 12, "        ") for n in names),
+        alias_dim,
+        alias_off_c,
+        alias_dim,
+        alias_book_c,
+        rows(chapters, 20, "    "),
+        rows(start, 12, "    "),
+        rows(counts, 20, "    "),
+        rows(ordinal, 12, "    "),
+    )
+    return h, c
+
+
+def write_if_changed(path, text):
+    try:
+        with open(path, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    except OSError:
+        pass
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: gen_meta.py books.txt out_dir")
+    src, out_dir = sys.argv[1], sys.argv[2]
+    langs, books = parse(src)
+    h, c = generate(langs, books, "meta/" + os.path.basename(src))
+    write_if_changed(os.path.join(out_dir, "bible_meta.h"), h)
+    write_if_changed(os.path.join(out_dir, "bible_meta.c"), c)
+
+
+if __name__ == "__main__":
+    main()